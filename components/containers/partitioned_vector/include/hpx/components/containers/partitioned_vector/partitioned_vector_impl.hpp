@@ -14,6 +14,7 @@
 #include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/modules/async_distributed.hpp>
@@ -357,6 +358,10 @@ namespace hpx {
         // possible reallocations during push back and the continuation
         // to set the local partition data
         partitions_.resize(num_parts);
+
+        std::vector<hpx::id_type> remote_partitions;
+        remote_partitions.reserve(num_parts);
+
         for (bulk_locality_result const& r : f.get())
         {
             using naming::get_locality_id_from_id;
@@ -373,6 +378,10 @@ namespace hpx {
                         get_ptr<partitioned_vector_partition_server>(id).then(
                             get_ptr_helper{l, partitions_}));
                 }
+                else
+                {
+                    remote_partitions.push_back(id);
+                }
                 ++l;
 
                 allocated_size += size;
@@ -398,6 +407,12 @@ namespace hpx {
         }
         HPX_ASSERT(l == num_parts);
 
+        // make the addresses of the remote partitions locally known
+        if (!remote_partitions.empty())
+        {
+            ptrs.push_back(agas::prefetch_gva_ranges(remote_partitions));
+        }
+
         hpx::wait_all(ptrs);
 
         // cache our partition size
@@ -56,6 +56,7 @@
 // Parallelism TS V2
 #include <hpx/parallel/algorithms/ends_with.hpp>
 #include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/generate_random.hpp>
 #include <hpx/parallel/algorithms/shift_left.hpp>
 #include <hpx/parallel/algorithms/shift_right.hpp>
 #include <hpx/parallel/algorithms/starts_with.hpp>
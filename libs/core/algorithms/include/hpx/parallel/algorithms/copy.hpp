@@ -318,6 +318,7 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/compress.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
@@ -596,32 +597,15 @@ namespace hpx::parallel {
                               proj = HPX_FORWARD(decltype(proj), proj)](
                               zip_iterator part_begin,
                               std::size_t part_size) -> std::size_t {
-                    std::size_t curr = 0;
-
-                    // Note: replacing the invoke() with HPX_INVOKE()
-                    // below makes gcc generate errors
-
-                    // MSVC complains if proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&pred, proj, &curr](zip_iterator it) mutable -> void {
-                            bool f = hpx::invoke(
-                                pred, hpx::invoke(proj, get<0>(*it)));
-
-                            if ((get<1>(*it) = f))
-                                ++curr;
-                        });
-
-                    return curr;
+                    return sequential_compress_flags<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, pred, proj);
                 };
                 auto f3 = [dest, flags](zip_iterator part_begin,
                               std::size_t part_size, std::size_t val) mutable {
                     HPX_UNUSED(flags);
                     std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest++ = get<0>(*it);
-                        });
+                    sequential_compress<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, dest);
                 };
 
                 auto f4 = [first, dest, flags](std::vector<std::size_t>&& items,
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// The parallel versions of copy_if, remove_if, unique_copy, and
+// partition_copy run two passes over each partition: the first evaluates the
+// predicate for all elements storing the results as flags, the second
+// compacts the selected elements to their final position. The customization
+// points below implement the two passes for a partition given as a
+// zip_iterator referring to the elements and their flags. They are
+// overloaded for vector-pack execution policies in
+// hpx/parallel/datapar/compress.hpp.
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Evaluate the predicate for all elements of the partition, store the
+    // results as flags, and return the number of elements for which the
+    // predicate returned true.
+    template <typename ExPolicy>
+    struct sequential_compress_flags_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_compress_flags_t<ExPolicy>>
+    {
+    private:
+        template <typename ZipIter, typename Pred, typename Proj>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_compress_flags_t, ZipIter part_begin,
+            std::size_t part_size, Pred&& pred, Proj&& proj)
+        {
+            using hpx::get;
+
+            std::size_t curr = 0;
+            util::loop_n<ExPolicy>(
+                part_begin, part_size, [&](ZipIter it) mutable -> void {
+                    bool const f =
+                        HPX_INVOKE(pred, HPX_INVOKE(proj, get<0>(*it)));
+
+                    if ((get<1>(*it) = f))
+                        ++curr;
+                });
+            return curr;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_compress_flags_t<ExPolicy>
+        sequential_compress_flags = sequential_compress_flags_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t sequential_compress_flags(
+        Args&&... args)
+    {
+        return sequential_compress_flags_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Flag all elements of the partition that are not equivalent to their
+    // predecessor (which is the element referred to by part_begin), and
+    // return the number of flagged elements. The predicate is required to be
+    // an equivalence relation, each element is compared to the last flagged
+    // element in the partition.
+    template <typename ExPolicy>
+    struct sequential_unique_flags_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_unique_flags_t<ExPolicy>>
+    {
+    private:
+        template <typename ZipIter, typename Pred, typename Proj>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_unique_flags_t, ZipIter part_begin,
+            std::size_t part_size, Pred&& pred, Proj&& proj)
+        {
+            using hpx::get;
+
+            auto base = get<0>(part_begin.get_iterator_tuple());
+            std::size_t curr = 0;
+
+            util::loop_n<ExPolicy>(
+                ++part_begin, part_size, [&](ZipIter it) mutable -> void {
+                    bool const r = HPX_INVOKE(pred, HPX_INVOKE(proj, *base),
+                        HPX_INVOKE(proj, get<0>(*it)));
+
+                    if ((get<1>(*it) = !r))
+                    {
+                        base = get<0>(it.get_iterator_tuple());
+                        ++curr;
+                    }
+                });
+            return curr;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_unique_flags_t<ExPolicy>
+        sequential_unique_flags = sequential_unique_flags_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t sequential_unique_flags(
+        Args&&... args)
+    {
+        return sequential_unique_flags_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy all flagged elements of the partition to consecutive positions
+    // starting at dest, return the iterator past the last copied element.
+    template <typename ExPolicy>
+    struct sequential_compress_t final
+      : hpx::functional::detail::tag_fallback<sequential_compress_t<ExPolicy>>
+    {
+    private:
+        template <typename ZipIter, typename OutIter>
+        friend constexpr OutIter tag_fallback_invoke(sequential_compress_t,
+            ZipIter part_begin, std::size_t part_size, OutIter dest)
+        {
+            using hpx::get;
+
+            util::loop_n<ExPolicy>(
+                part_begin, part_size, [&dest](ZipIter it) mutable {
+                    if (get<1>(*it))
+                        *dest++ = get<0>(*it);
+                });
+            return dest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_compress_t<ExPolicy> sequential_compress =
+        sequential_compress_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_compress(Args&&... args)
+    {
+        return sequential_compress_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy all flagged elements of the partition to consecutive positions
+    // starting at dest_true and all other elements to consecutive positions
+    // starting at dest_false, return the iterators past the last copied
+    // elements.
+    template <typename ExPolicy>
+    struct sequential_partition_compress_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_partition_compress_t<ExPolicy>>
+    {
+    private:
+        template <typename ZipIter, typename OutIter1, typename OutIter2>
+        friend constexpr std::pair<OutIter1, OutIter2> tag_fallback_invoke(
+            sequential_partition_compress_t, ZipIter part_begin,
+            std::size_t part_size, OutIter1 dest_true, OutIter2 dest_false)
+        {
+            using hpx::get;
+
+            util::loop_n<ExPolicy>(part_begin, part_size,
+                [&dest_true, &dest_false](ZipIter it) mutable {
+                    if (get<1>(*it))
+                        *dest_true++ = get<0>(*it);
+                    else
+                        *dest_false++ = get<0>(*it);
+                });
+            return {HPX_MOVE(dest_true), HPX_MOVE(dest_false)};
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_partition_compress_t<ExPolicy>
+        sequential_partition_compress =
+            sequential_partition_compress_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_partition_compress(
+        Args&&... args)
+    {
+        return sequential_partition_compress_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,251 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The bijections below operate on N counters at once. The counters are
+    // stored in structure-of-arrays layout (x[word][lane]) such that each
+    // round is a sequence of simple loops over the lanes which the compiler
+    // is able to vectorize.
+    //
+    // Both bijections are specified in: J. K. Salmon, M. A. Moraes,
+    // R. O. Dror, and D. E. Shaw, "Parallel random numbers: as easy as
+    // 1, 2, 3", SC'11.
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t Rounds>
+    struct philox4x32_bijection
+    {
+        static_assert(Rounds > 0, "Philox requires at least one round");
+
+        using key_type = std::array<std::uint32_t, 2>;
+
+        static constexpr key_type make_key(std::uint64_t seed) noexcept
+        {
+            return {{static_cast<std::uint32_t>(seed),
+                static_cast<std::uint32_t>(seed >> 32)}};
+        }
+
+        template <std::size_t N>
+        static void apply(
+            std::uint32_t (&x)[4][N], key_type const& key) noexcept
+        {
+            constexpr std::uint32_t m0 = 0xD2511F53;
+            constexpr std::uint32_t m1 = 0xCD9E8D57;
+            constexpr std::uint32_t w0 = 0x9E3779B9;
+            constexpr std::uint32_t w1 = 0xBB67AE85;
+
+            std::uint32_t k0 = key[0];
+            std::uint32_t k1 = key[1];
+
+            for (std::size_t r = 0; r != Rounds; ++r)
+            {
+                // clang-format off
+                HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    std::uint64_t const p0 = std::uint64_t(m0) * x[0][i];
+                    std::uint64_t const p1 = std::uint64_t(m1) * x[2][i];
+
+                    std::uint32_t const y0 =
+                        static_cast<std::uint32_t>(p1 >> 32) ^ x[1][i] ^ k0;
+                    std::uint32_t const y2 =
+                        static_cast<std::uint32_t>(p0 >> 32) ^ x[3][i] ^ k1;
+
+                    x[0][i] = y0;
+                    x[1][i] = static_cast<std::uint32_t>(p1);
+                    x[2][i] = y2;
+                    x[3][i] = static_cast<std::uint32_t>(p0);
+                }
+                // clang-format on
+
+                k0 += w0;
+                k1 += w1;
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t Rounds>
+    struct threefry4x32_bijection
+    {
+        using key_type = std::array<std::uint32_t, 4>;
+
+        static constexpr key_type make_key(std::uint64_t seed) noexcept
+        {
+            return {{static_cast<std::uint32_t>(seed),
+                static_cast<std::uint32_t>(seed >> 32), 0, 0}};
+        }
+
+        static constexpr std::uint32_t rotl(
+            std::uint32_t x, unsigned int n) noexcept
+        {
+            return (x << n) | (x >> (32 - n));
+        }
+
+        template <std::size_t N>
+        static void apply(
+            std::uint32_t (&x)[4][N], key_type const& key) noexcept
+        {
+            constexpr unsigned int rotations[8][2] = {{10, 26}, {11, 21},
+                {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+
+            std::uint32_t const ks[5] = {key[0], key[1], key[2], key[3],
+                0x1BD11BDA ^ key[0] ^ key[1] ^ key[2] ^ key[3]};
+
+            inject_key(x, ks, 0);
+
+            for (std::size_t r = 0; r != Rounds; ++r)
+            {
+                unsigned int const r0 = rotations[r % 8][0];
+                unsigned int const r1 = rotations[r % 8][1];
+
+                if (r % 2 == 0)
+                {
+                    // clang-format off
+                    HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+                    for (std::size_t i = 0; i != N; ++i)
+                    {
+                        x[0][i] += x[1][i];
+                        x[1][i] = rotl(x[1][i], r0) ^ x[0][i];
+                        x[2][i] += x[3][i];
+                        x[3][i] = rotl(x[3][i], r1) ^ x[2][i];
+                    }
+                    // clang-format on
+                }
+                else
+                {
+                    // clang-format off
+                    HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+                    for (std::size_t i = 0; i != N; ++i)
+                    {
+                        x[0][i] += x[3][i];
+                        x[3][i] = rotl(x[3][i], r0) ^ x[0][i];
+                        x[2][i] += x[1][i];
+                        x[1][i] = rotl(x[1][i], r1) ^ x[2][i];
+                    }
+                    // clang-format on
+                }
+
+                // the key is injected after every fourth round
+                if (r % 4 == 3)
+                {
+                    inject_key(x, ks, (r + 1) / 4);
+                }
+            }
+        }
+
+    private:
+        template <std::size_t N>
+        static void inject_key(std::uint32_t (&x)[4][N],
+            std::uint32_t const (&ks)[5], std::size_t s) noexcept
+        {
+            std::uint32_t const k0 = ks[s % 5];
+            std::uint32_t const k1 = ks[(s + 1) % 5];
+            std::uint32_t const k2 = ks[(s + 2) % 5];
+            std::uint32_t const k3 =
+                ks[(s + 3) % 5] + static_cast<std::uint32_t>(s);
+
+            // clang-format off
+            HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                x[0][i] += k0;
+                x[1][i] += k1;
+                x[2][i] += k2;
+                x[3][i] += k3;
+            }
+            // clang-format on
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers used by the distributions to convert random words
+
+    // upper half of the 128 bit product of a and b
+    constexpr std::uint64_t mulhi64(std::uint64_t a, std::uint64_t b) noexcept
+    {
+        std::uint64_t const a_lo = a & 0xffffffff;
+        std::uint64_t const a_hi = a >> 32;
+        std::uint64_t const b_lo = b & 0xffffffff;
+        std::uint64_t const b_hi = b >> 32;
+
+        std::uint64_t const hi_lo = a_hi * b_lo;
+        std::uint64_t const cross =
+            ((a_lo * b_lo) >> 32) + (hi_lo & 0xffffffff) + a_lo * b_hi;
+
+        return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    }
+
+    constexpr std::uint64_t make_uint64(
+        std::uint32_t lo, std::uint32_t hi) noexcept
+    {
+        return (std::uint64_t(hi) << 32) | lo;
+    }
+
+    // uniformly distributed in [0, 1) using the upper 24 bits of w
+    constexpr float unit_float(std::uint32_t w) noexcept
+    {
+        return static_cast<float>(w >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // uniformly distributed in [0, 1) using the upper 53 bits of w
+    constexpr double unit_double(std::uint64_t w) noexcept
+    {
+        return static_cast<double>(w >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // number of random blocks computed at once by generate_random
+    inline constexpr std::size_t generate_random_batch_size = 16;
+
+    // Fill [dest, dest + count) with the values with the indices
+    // [index, index + count) of the sequence defined by the given engine and
+    // distribution. Each value depends on its index only, which makes the
+    // result independent of how the overall sequence is partitioned.
+    template <typename Iter, typename Engine, typename Distribution>
+    Iter sequential_generate_random(Iter dest, std::uint64_t index,
+        std::size_t count, Engine const& engine,
+        Distribution const& dist)
+    {
+        using result_type = typename Distribution::result_type;
+
+        constexpr std::size_t N = generate_random_batch_size;
+        constexpr std::size_t values_per_block =
+            Distribution::values_per_block;
+        constexpr std::size_t values_per_batch = N * values_per_block;
+
+        std::uint64_t block = index / values_per_block;
+        std::size_t offset = index % values_per_block;
+
+        std::uint32_t words[4][N];
+        result_type values[values_per_batch];
+
+        while (count != 0)
+        {
+            engine.generate_blocks(block, words);
+            dist.convert(words, values);
+
+            std::size_t const n = (std::min) (count, values_per_batch - offset);
+            dest = std::copy_n(values + offset, n, dest);
+
+            count -= n;
+            block += N;
+            offset = 0;
+        }
+        return dest;
+    }
+}    // namespace hpx::parallel::detail
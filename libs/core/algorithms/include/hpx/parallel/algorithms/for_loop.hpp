@@ -733,6 +733,96 @@ namespace hpx { namespace experimental {
     hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
     for_loop_n_strided(
         ExPolicy&& policy, I first, Size size, S stride, Args&&... args);
+
+    /// The for_loop implements loop functionality over the index points of
+    /// a rectangular, \a N dimensional index space. The index space is split
+    /// into tiles which are visited in row-major order by the calling thread.
+    ///
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam I           The type of the indices of the index space.
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each index point, the
+    ///                     others have to be either conforming to the
+    ///                     induction or reduction concept.
+    ///
+    /// \param space        The index space describing the index points the
+    ///                     algorithm will be applied to.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     either induction or reduction objects.
+    ///                     The function (or function object) should expose a
+    ///                     signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(I i0, ..., I iN-1, ...);
+    ///                     \endcode \n
+    ///                     It will receive the \a N indices of the current
+    ///                     index point and one argument for each of the
+    ///                     induction or reduction objects passed to the
+    ///                     algorithms, representing their current values.
+    ///
+    /// The ordinal position of an index point used for the inductions is
+    /// its position in the row-major ordering of the whole index space.
+    ///
+    /// Complexity: Applies \a f exactly once for each index point of the
+    ///             index space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    template <std::size_t N, typename I, typename... Args>
+    void for_loop(index_space<N, I> const& space, Args&&... args);
+
+    /// The for_loop implements loop functionality over the index points of
+    /// a rectangular, \a N dimensional index space. The index space is split
+    /// into tiles (see \a index_space) which are the units of work
+    /// distributed onto the cores by the executor of the given execution
+    /// policy, the chunk sizes of the executor parameters are measured in
+    /// tiles. The index points of each tile are visited in row-major order.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam N           The number of dimensions of the index space.
+    /// \tparam I           The type of the indices of the index space.
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each index point, the
+    ///                     others have to be either conforming to the
+    ///                     induction or reduction concept.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param space        The index space describing the index points the
+    ///                     algorithm will be applied to.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     either induction or reduction objects.
+    ///                     The function (or function object) should expose a
+    ///                     signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(I i0, ..., I iN-1, ...);
+    ///                     \endcode \n
+    ///                     It will receive the \a N indices of the current
+    ///                     index point and one argument for each of the
+    ///                     induction or reduction objects passed to the
+    ///                     algorithms, representing their current values.
+    ///
+    /// The ordinal position of an index point used for the inductions is
+    /// its position in the row-major ordering of the whole index space.
+    ///
+    /// Complexity: Applies \a f exactly once for each index point of the
+    ///             index space.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    /// \returns  The \a for_loop algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a hpx::execution::sequenced_task_policy or
+    ///           \a hpx::execution::parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, std::size_t N, typename I, typename... Args>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> for_loop(
+        ExPolicy&& policy, index_space<N, I> const& space, Args&&... args);
 }}    // namespace hpx::experimental
 
 #else
@@ -748,6 +838,7 @@ namespace hpx { namespace experimental {
 #include <hpx/modules/executors.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/for_loop_index_space.hpp>
 #include <hpx/parallel/algorithms/for_loop_induction.hpp>
 #include <hpx/parallel/algorithms/for_loop_reduction.hpp>
 #include <hpx/parallel/util/adapt_sharing_mode.hpp>
@@ -759,6 +850,7 @@ namespace hpx { namespace experimental {
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -1419,6 +1511,261 @@ namespace hpx::parallel {
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Visits the index points of the tiles [part_begin, part_begin +
+        // part_steps) of an index space. The tiles are numbered in row-major
+        // order, the index points inside each tile are visited in row-major
+        // order as well.
+        template <typename ExPolicy, typename F, typename Space,
+            typename Tuple = hpx::tuple<>>
+        struct part_tiles;
+
+        template <typename ExPolicy, typename F, std::size_t N, typename I,
+            typename... Ts>
+        struct part_tiles<ExPolicy, F, hpx::experimental::index_space<N, I>,
+            hpx::tuple<Ts...>>
+        {
+            using fun_type = std::decay_t<F>;
+            using indices_type = std::array<I, N>;
+
+            fun_type f_;
+            indices_type first_;
+            indices_type last_;
+            indices_type tile_;
+            indices_type num_tiles_;
+            hpx::tuple<Ts...> args_;
+
+            template <typename F_, typename Args>
+            part_tiles(F_&& f,
+                hpx::experimental::index_space<N, I> const& space, Args&& args)
+              : f_(HPX_FORWARD(F_, f))
+              , first_(space.first())
+              , last_(space.last())
+              , tile_(space.tile_extents())
+              , num_tiles_()
+              , args_(HPX_FORWARD(Args, args))
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    num_tiles_[d] =
+                        (last_[d] - first_[d] + tile_[d] - 1) / tile_[d];
+                }
+            }
+
+            // the overall number of tiles
+            [[nodiscard]] constexpr std::size_t size() const noexcept
+            {
+                std::size_t size = 1;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    size *= static_cast<std::size_t>(num_tiles_[d]);
+                }
+                return size;
+            }
+
+            // the position of the given index point in row-major order
+            [[nodiscard]] constexpr std::size_t linear_index(
+                indices_type const& idx) const noexcept
+            {
+                std::size_t result = 0;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    result = result *
+                            static_cast<std::size_t>(last_[d] - first_[d]) +
+                        static_cast<std::size_t>(idx[d] - first_[d]);
+                }
+                return result;
+            }
+
+            template <std::size_t... Is, std::size_t... Js>
+            HPX_FORCEINLINE constexpr void invoke_point(
+                hpx::util::index_pack<Is...>, hpx::util::index_pack<Js...>,
+                indices_type const& idx)
+            {
+                HPX_INVOKE(
+                    f_, idx[Is]..., hpx::get<Js>(args_).iteration_value()...);
+            }
+
+            // visit the index points of the tile [lo, hi) row by row
+            template <std::size_t D>
+            constexpr void iterate(indices_type& idx, indices_type const& lo,
+                indices_type const& hi)
+            {
+                if constexpr (D + 1 == N)
+                {
+                    auto pack = hpx::util::make_index_pack_t<sizeof...(Ts)>();
+
+                    idx[D] = lo[D];
+                    if constexpr (sizeof...(Ts) != 0)
+                    {
+                        // inductions are based on the row-major position
+                        detail::init_iteration(args_, pack, linear_index(idx));
+                    }
+
+                    for (/**/; idx[D] != hi[D]; ++idx[D])
+                    {
+                        invoke_point(
+                            hpx::util::make_index_pack_t<N>(), pack, idx);
+                        detail::next_iteration(args_, pack);
+                    }
+                }
+                else
+                {
+                    for (idx[D] = lo[D]; idx[D] != hi[D]; ++idx[D])
+                    {
+                        iterate<D + 1>(idx, lo, hi);
+                    }
+                }
+            }
+
+            constexpr void invoke_tile(std::size_t tile)
+            {
+                indices_type lo{};
+                indices_type hi{};
+                for (std::size_t d = N; d-- != 0; /**/)
+                {
+                    auto const count = static_cast<std::size_t>(num_tiles_[d]);
+                    auto const t = static_cast<I>(tile % count);
+                    tile /= count;
+
+                    lo[d] = first_[d] + t * tile_[d];
+                    hi[d] = last_[d] - lo[d] > tile_[d] ? lo[d] + tile_[d] :
+                                                          last_[d];
+                }
+
+                indices_type idx = lo;
+                iterate<0>(idx, lo, hi);
+            }
+
+            template <typename B>
+            HPX_FORCEINLINE constexpr void operator()(
+                B part_begin, std::size_t part_steps)
+            {
+                auto tile = static_cast<std::size_t>(part_begin);
+                for (/**/; part_steps != 0; --part_steps)
+                {
+                    invoke_tile(tile++);
+                }
+            }
+
+            template <typename B>
+            HPX_FORCEINLINE constexpr void operator()(
+                B part_begin, std::size_t part_steps, std::size_t)
+            {
+                (*this)(part_begin, part_steps);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct for_loop_index_space_algo
+          : public detail::algorithm<for_loop_index_space_algo>
+        {
+            constexpr for_loop_index_space_algo() noexcept
+              : for_loop_index_space_algo::algorithm(
+                    "for_loop_index_space_algo")
+            {
+            }
+
+            template <typename ExPolicy, typename Space, typename F,
+                typename... Ts>
+            static constexpr hpx::util::unused_type sequential(
+                ExPolicy&&, Space const& space, F&& f, Ts&&... ts)
+            {
+                using args_type = hpx::tuple<std::decay_t<Ts>...>;
+
+                // perform iteration
+                auto tiles = part_tiles<ExPolicy, F, Space, args_type>(
+                    HPX_FORWARD(F, f), space,
+                    hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+                tiles(std::size_t(0), tiles.size());
+
+                if constexpr (sizeof...(Ts) != 0)
+                {
+                    // make sure live-out variables are properly set on return
+                    auto pack = hpx::util::make_index_pack_t<sizeof...(Ts)>();
+                    detail::exit_iteration(tiles.args_, pack, space.size());
+                }
+
+                return {};
+            }
+
+            template <typename ExPolicy, typename Space, typename F,
+                typename... Ts>
+            static auto parallel(
+                ExPolicy&& policy, Space const& space, F&& f, Ts&&... ts)
+            {
+                constexpr bool is_scheduler_policy =
+                    hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+                if constexpr (!is_scheduler_policy)
+                {
+                    if (space.empty())
+                    {
+                        return util::detail::algorithm_result<ExPolicy>::get();
+                    }
+                }
+
+                using policy_type = std::decay_t<ExPolicy>;
+
+                // we need to decay copy here to properly transport
+                // everything to a GPU device
+                using args_type = hpx::tuple<std::decay_t<Ts>...>;
+
+                args_type args = hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
+
+                // the tiles are the units of work distributed to the cores,
+                // chunk sizes are measured in tiles
+                auto tiles = part_tiles<policy_type, F, Space, args_type>(
+                    HPX_FORWARD(F, f), space, args);
+                std::size_t const num_tiles = tiles.size();
+
+                if constexpr (sizeof...(Ts) == 0)
+                {
+                    if constexpr (hpx::is_async_execution_policy_v<ExPolicy> ||
+                        is_scheduler_policy)
+                    {
+                        return util::detail::algorithm_result<ExPolicy>::get(
+                            util::partitioner<ExPolicy>::call(
+                                HPX_FORWARD(ExPolicy, policy), std::size_t(0),
+                                num_tiles, HPX_MOVE(tiles),
+                                hpx::util::empty_function{}));
+                    }
+                    else
+                    {
+                        util::partitioner<ExPolicy>::call(
+                            HPX_FORWARD(ExPolicy, policy), std::size_t(0),
+                            num_tiles, HPX_MOVE(tiles),
+                            hpx::util::empty_function{});
+                        return util::detail::algorithm_result<ExPolicy>::get();
+                    }
+                }
+                else
+                {
+                    // any of the induction or reduction operations prevent us
+                    // from sharing the part_tiles between threads
+                    decltype(auto) hinted_policy =
+                        parallel::util::adapt_sharing_mode(
+                            HPX_FORWARD(ExPolicy, policy),
+                            hpx::threads::thread_sharing_hint::
+                                do_not_share_function);
+
+                    std::size_t const size = space.size();
+                    return util::detail::algorithm_result<policy_type>::get(
+                        util::partitioner<policy_type>::call_with_index(
+                            hinted_policy, std::size_t(0), num_tiles, 1,
+                            HPX_MOVE(tiles), [=](auto&&) mutable {
+                                auto pack =
+                                    hpx::util::make_index_pack_t<sizeof...(
+                                        Ts)>();
+                                // make sure live-out variables are properly
+                                // set on return
+                                detail::exit_iteration(args, pack, size);
+                                return hpx::util::unused;
+                            }));
+                }
+            }
+        };
+
         // reshuffle arguments, last argument is function object, will go first
         template <typename ExPolicy, typename B, typename E, std::size_t... Is,
             typename... Args>
@@ -1590,6 +1937,21 @@ namespace hpx::parallel {
             return for_loop_strided_algo().call(HPX_FORWARD(ExPolicy, policy),
                 first, size, stride, HPX_MOVE(f), hpx::get<Is>(t)...);
         }
+
+        // reshuffle arguments, last argument is function object, will go first
+        template <typename ExPolicy, std::size_t N, typename I,
+            std::size_t... Is, typename... Args>
+        auto for_loop_index_space(ExPolicy&& policy,
+            hpx::experimental::index_space<N, I> const& space,
+            hpx::util::index_pack<Is...>, Args&&... args)
+        {
+            auto&& t = hpx::forward_as_tuple(HPX_FORWARD(Args, args)...);
+
+            auto f = hpx::get<sizeof...(Args) - 1>(t);
+            return for_loop_index_space_algo().call(
+                HPX_FORWARD(ExPolicy, policy), space, HPX_MOVE(f),
+                hpx::get<Is>(t)...);
+        }
         /// \endcond
     }    // namespace detail
 }    // namespace hpx::parallel
@@ -1638,6 +2000,40 @@ namespace hpx::experimental {
                 last, make_index_pack_t<sizeof...(Args) - 1>(),
                 HPX_FORWARD(Args, args)...);
         }
+
+        // clang-format off
+        template <typename ExPolicy, std::size_t N, typename I,
+            typename... Args,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(hpx::experimental::for_loop_t,
+            ExPolicy&& policy, index_space<N, I> const& space, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop must be called with at least a function object");
+
+            using hpx::util::make_index_pack_t;
+            return hpx::parallel::detail::for_loop_index_space(
+                HPX_FORWARD(ExPolicy, policy), space,
+                make_index_pack_t<sizeof...(Args) - 1>(),
+                HPX_FORWARD(Args, args)...);
+        }
+
+        template <std::size_t N, typename I, typename... Args>
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_t,
+            index_space<N, I> const& space, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop must be called with at least a function object");
+
+            using hpx::util::make_index_pack_t;
+            return hpx::parallel::detail::for_loop_index_space(
+                hpx::execution::seq, space,
+                make_index_pack_t<sizeof...(Args) - 1>(),
+                HPX_FORWARD(Args, args)...);
+        }
     } for_loop{};
 
     ///////////////////////////////////////////////////////////////////////////
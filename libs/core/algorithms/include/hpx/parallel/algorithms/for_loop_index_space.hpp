@@ -0,0 +1,220 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_index_space.hpp
+/// \page hpx::experimental::index_space
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // The number of index points a tile of an index space should contain
+        // by default. This is derived from the size of the L2 cache assuming
+        // that every index point touches a couple of (double precision)
+        // values.
+        HPX_CORE_EXPORT std::size_t get_default_tile_points() noexcept;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A rectangular, \a N dimensional index space [first, last) to be used
+    /// with \a for_loop. The algorithm splits the index space into tiles
+    /// (rectangular blocks of index points) that are distributed onto the
+    /// cores using the executor and the executor parameters (e.g. the chunk
+    /// size, which is measured in tiles) of the execution policy. The index
+    /// points of each tile are visited in row-major order, i.e. the last
+    /// dimension is the one varying fastest.
+    ///
+    /// Unless given explicitly, the tile sizes are chosen such that a tile
+    /// fits into the L2 cache: the last dimension is covered first, followed
+    /// by the preceding dimensions as long as the tile does not become too
+    /// large.
+    ///
+    /// \tparam N   The number of dimensions of the index space
+    /// \tparam I   The (integral) type of the indices
+    ///
+    template <std::size_t N, typename I = std::ptrdiff_t>
+    class index_space
+    {
+        static_assert(N != 0, "index_space requires at least one dimension");
+        static_assert(
+            std::is_integral_v<I>, "index_space requires integral indices");
+
+    public:
+        using index_type = I;
+        using indices_type = std::array<I, N>;
+
+        static constexpr std::size_t rank = N;
+
+        /// Create the index space [0, extents)
+        constexpr explicit index_space(indices_type const& extents) noexcept
+          : first_()
+          , last_(extents)
+          , tile_()
+        {
+        }
+
+        /// Create the index space [first, last)
+        constexpr index_space(
+            indices_type const& first, indices_type const& last) noexcept
+          : first_(first)
+          , last_(last)
+          , tile_()
+        {
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                HPX_ASSERT(first_[d] <= last_[d]);
+            }
+        }
+
+        /// Create the index space [first, last) which is split into tiles of
+        /// the given sizes (zero: choose the size for that dimension
+        /// automatically)
+        constexpr index_space(indices_type const& first,
+            indices_type const& last, indices_type const& tile) noexcept
+          : index_space(first, last)
+        {
+            tile_ = tile;
+        }
+
+        /// Return a copy of this index space split into tiles of the given
+        /// sizes (zero: choose the size for that dimension automatically)
+        [[nodiscard]] constexpr index_space with_tile(
+            indices_type const& tile) const noexcept
+        {
+            return index_space(first_, last_, tile);
+        }
+
+        [[nodiscard]] constexpr indices_type const& first() const noexcept
+        {
+            return first_;
+        }
+
+        [[nodiscard]] constexpr indices_type const& last() const noexcept
+        {
+            return last_;
+        }
+
+        /// Return the number of index points in the given dimension
+        [[nodiscard]] constexpr std::size_t extent(std::size_t d) const noexcept
+        {
+            return static_cast<std::size_t>(last_[d] - first_[d]);
+        }
+
+        /// Return the overall number of index points
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            std::size_t size = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                size *= extent(d);
+            }
+            return size;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /// Return the tile sizes as given on construction (zero: choose
+        /// automatically)
+        [[nodiscard]] constexpr indices_type const& tile() const noexcept
+        {
+            return tile_;
+        }
+
+        /// Return the tile sizes used for iterating over this index space,
+        /// tiles at the upper boundaries might be smaller
+        [[nodiscard]] indices_type tile_extents() const noexcept
+        {
+            return tile_extents(detail::get_default_tile_points());
+        }
+
+        /// Return the tile sizes used for iterating over this index space
+        /// assuming each automatically sized tile should contain about the
+        /// given number of index points
+        [[nodiscard]] constexpr indices_type tile_extents(
+            std::size_t tile_points) const noexcept
+        {
+            // the number of points covered by the explicitly sized dimensions
+            std::size_t fixed = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (tile_[d] > 0)
+                {
+                    fixed *= (std::min)(static_cast<std::size_t>(tile_[d]),
+                        (std::max)(extent(d), std::size_t(1)));
+                }
+            }
+
+            std::size_t budget =
+                (std::max)(tile_points / fixed, std::size_t(1));
+
+            indices_type result{};
+            for (std::size_t d = N; d-- != 0; /**/)
+            {
+                std::size_t const ext = (std::max)(extent(d), std::size_t(1));
+                if (tile_[d] > 0)
+                {
+                    result[d] = static_cast<I>(
+                        (std::min)(static_cast<std::size_t>(tile_[d]), ext));
+                }
+                else
+                {
+                    std::size_t const size = (std::min)(ext, budget);
+                    result[d] = static_cast<I>(size);
+                    budget = (std::max)(budget / size, std::size_t(1));
+                }
+            }
+            return result;
+        }
+
+    private:
+        indices_type first_;
+        indices_type last_;
+        indices_type tile_;
+    };
+
+    /// \cond NOINTERNAL
+    template <typename I, std::size_t N>
+    index_space(std::array<I, N> const&) -> index_space<N, I>;
+
+    template <typename I, std::size_t N>
+    index_space(std::array<I, N> const&, std::array<I, N> const&)
+        -> index_space<N, I>;
+
+    template <typename I, std::size_t N>
+    index_space(std::array<I, N> const&, std::array<I, N> const&,
+        std::array<I, N> const&) -> index_space<N, I>;
+
+    template <typename T>
+    struct is_index_space : std::false_type
+    {
+    };
+
+    template <std::size_t N, typename I>
+    struct is_index_space<index_space<N, I>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_index_space_v =
+        is_index_space<std::decay_t<T>>::value;
+    /// \endcond
+}    // namespace hpx::experimental
@@ -0,0 +1,662 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/generate_random.hpp
+/// \page hpx::experimental::generate_random
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/generate_random.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A counter-based random number engine. The n-th block of four 32 bit
+    /// random words is computed by applying the bijection \a Bijection to
+    /// the counter (n, stream), using a key derived from the seed. As every
+    /// block can be computed independently of all others, any part of the
+    /// random sequence can be generated directly, without advancing the
+    /// engine through the preceding values.
+    ///
+    /// The engine satisfies the requirements of a uniform random bit
+    /// generator and can be used with the distributions from <random>.
+    /// The algorithm \a hpx::experimental::generate_random uses the blocks
+    /// of the engine directly.
+    ///
+    /// \tparam Bijection   The keyed bijection on 128 bit counters to use,
+    ///                     see \a philox4x32 and \a threefry4x32.
+    ///
+    template <typename Bijection>
+    class counter_based_engine
+    {
+    public:
+        using result_type = std::uint32_t;
+        using key_type = typename Bijection::key_type;
+        using block_type = std::array<std::uint32_t, 4>;
+
+        static constexpr std::uint64_t default_seed = 0;
+
+        /// Construct an engine using the default seed and stream 0.
+        constexpr counter_based_engine() noexcept
+          : counter_based_engine(default_seed)
+        {
+        }
+
+        /// Construct an engine
+        ///
+        /// \param seed     [in] The seed the key of the engine is derived
+        ///                 from.
+        /// \param stream   [in] Engines constructed with the same seed but
+        ///                 different streams generate independent sequences.
+        ///
+        explicit constexpr counter_based_engine(
+            std::uint64_t seed, std::uint64_t stream = 0) noexcept
+          : key_(Bijection::make_key(seed))
+          , stream_(stream)
+        {
+        }
+
+        /// Reset the engine to the beginning of the sequence defined by
+        /// \a seed and \a stream.
+        void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+        {
+            key_ = Bijection::make_key(seed);
+            stream_ = stream;
+            position_ = 0;
+        }
+
+        [[nodiscard]] constexpr key_type const& key() const noexcept
+        {
+            return key_;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t stream() const noexcept
+        {
+            return stream_;
+        }
+
+        /// Return the random block with the given index.
+        [[nodiscard]] block_type block(std::uint64_t index) const noexcept
+        {
+            std::uint32_t words[4][1];
+            generate_blocks(index, words);
+            return {{words[0][0], words[1][0], words[2][0], words[3][0]}};
+        }
+
+        /// Compute the random blocks [first, first + N) at once. The word
+        /// \a w of the block \a first + \a i is stored in words[w][i].
+        template <std::size_t N>
+        void generate_blocks(
+            std::uint64_t first, std::uint32_t (&words)[4][N]) const noexcept
+        {
+            auto const s0 = static_cast<std::uint32_t>(stream_);
+            auto const s1 = static_cast<std::uint32_t>(stream_ >> 32);
+
+            // clang-format off
+            HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                std::uint64_t const counter = first + i;
+                words[0][i] = static_cast<std::uint32_t>(counter);
+                words[1][i] = static_cast<std::uint32_t>(counter >> 32);
+                words[2][i] = s0;
+                words[3][i] = s1;
+            }
+            // clang-format on
+
+            Bijection::apply(words, key_);
+        }
+
+        [[nodiscard]] static constexpr result_type(min)() noexcept
+        {
+            return 0;
+        }
+
+        [[nodiscard]] static constexpr result_type(max)() noexcept
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        /// Return the next random word of the sequence.
+        result_type operator()() noexcept
+        {
+            auto const word = static_cast<std::size_t>(position_ % 4);
+            if (word == 0)
+            {
+                buffer_ = block(position_ / 4);
+            }
+            ++position_;
+            return buffer_[word];
+        }
+
+        /// Advance the engine by \a n words.
+        void discard(std::uint64_t n) noexcept
+        {
+            position_ += n;
+            if (position_ % 4 != 0)
+            {
+                buffer_ = block(position_ / 4);
+            }
+        }
+
+        friend bool operator==(counter_based_engine const& lhs,
+            counter_based_engine const& rhs) noexcept
+        {
+            return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_ &&
+                lhs.position_ == rhs.position_;
+        }
+
+        friend bool operator!=(counter_based_engine const& lhs,
+            counter_based_engine const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        key_type key_;
+        std::uint64_t stream_;
+        std::uint64_t position_ = 0;
+        block_type buffer_ = {};
+    };
+
+    /// The Philox4x32 engine with \a Rounds rounds
+    template <std::size_t Rounds>
+    using philox4x32_engine = counter_based_engine<
+        hpx::parallel::detail::philox4x32_bijection<Rounds>>;
+
+    /// The Threefry4x32 engine with \a Rounds rounds
+    template <std::size_t Rounds>
+    using threefry4x32_engine = counter_based_engine<
+        hpx::parallel::detail::threefry4x32_bijection<Rounds>>;
+
+    /// The Philox4x32-10 engine, the default engine of \a generate_random
+    using philox4x32 = philox4x32_engine<10>;
+
+    /// The Threefry4x32-20 engine
+    using threefry4x32 = threefry4x32_engine<20>;
+
+    template <typename T>
+    struct is_counter_based_engine : std::false_type
+    {
+    };
+
+    template <typename Bijection>
+    struct is_counter_based_engine<counter_based_engine<Bijection>>
+      : std::true_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_counter_based_engine_v =
+        is_counter_based_engine<T>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The distributions below are used by generate_random. Each of them maps
+    // one random block onto a fixed number of values (values_per_block), so
+    // that the n-th generated value depends on n only.
+
+    /// Produces integer values evenly distributed on the closed interval
+    /// [a, b].
+    template <typename IntType = int>
+    class uniform_int_distribution
+    {
+        static_assert(std::is_integral_v<IntType> &&
+                !std::is_same_v<IntType, bool> && sizeof(IntType) <= 8,
+            "uniform_int_distribution requires an integral type of at most "
+            "64 bits");
+
+        using unsigned_type = std::make_unsigned_t<IntType>;
+
+    public:
+        using result_type = IntType;
+
+        static constexpr std::size_t values_per_block =
+            sizeof(IntType) <= 4 ? 4 : 2;
+
+        constexpr uniform_int_distribution() noexcept
+          : uniform_int_distribution(0)
+        {
+        }
+
+        explicit constexpr uniform_int_distribution(IntType a,
+            IntType b = (std::numeric_limits<IntType>::max)()) noexcept
+          : a_(a)
+          , b_(b)
+        {
+            HPX_ASSERT(a <= b);
+        }
+
+        [[nodiscard]] constexpr result_type a() const noexcept
+        {
+            return a_;
+        }
+
+        [[nodiscard]] constexpr result_type b() const noexcept
+        {
+            return b_;
+        }
+
+        /// Convert the blocks computed by
+        /// \a counter_based_engine::generate_blocks into values, the values
+        /// of block \a i are stored starting at values[i * values_per_block].
+        template <std::size_t N>
+        void convert(std::uint32_t const (&words)[4][N],
+            result_type (&values)[N * values_per_block]) const noexcept
+        {
+            namespace detail = hpx::parallel::detail;
+
+            // the number of values in [a, b] minus one
+            std::uint64_t const range =
+                static_cast<unsigned_type>(static_cast<unsigned_type>(b_) -
+                    static_cast<unsigned_type>(a_));
+            auto const first = static_cast<unsigned_type>(a_);
+
+            if constexpr (values_per_block == 4)
+            {
+                // clang-format off
+                HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != 4; ++j)
+                    {
+                        std::uint64_t const offset =
+                            (words[j][i] * (range + 1)) >> 32;
+                        values[4 * i + j] =
+                            static_cast<result_type>(first + offset);
+                    }
+                }
+                // clang-format on
+            }
+            else
+            {
+                constexpr std::uint64_t all_values =
+                    (std::numeric_limits<std::uint64_t>::max)();
+
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != 2; ++j)
+                    {
+                        std::uint64_t const w = detail::make_uint64(
+                            words[2 * j][i], words[2 * j + 1][i]);
+                        std::uint64_t const offset = range == all_values ?
+                            w :
+                            detail::mulhi64(w, range + 1);
+                        values[2 * i + j] =
+                            static_cast<result_type>(first + offset);
+                    }
+                }
+            }
+        }
+
+    private:
+        IntType a_;
+        IntType b_;
+    };
+
+    /// Produces floating point values evenly distributed on the interval
+    /// [a, b).
+    template <typename RealType = double>
+    class uniform_real_distribution
+    {
+        static_assert(std::is_floating_point_v<RealType>,
+            "uniform_real_distribution requires a floating point type");
+
+    public:
+        using result_type = RealType;
+
+        static constexpr std::size_t values_per_block =
+            std::is_same_v<RealType, float> ? 4 : 2;
+
+        constexpr uniform_real_distribution() noexcept
+          : uniform_real_distribution(0)
+        {
+        }
+
+        explicit constexpr uniform_real_distribution(
+            RealType a, RealType b = 1) noexcept
+          : a_(a)
+          , b_(b)
+        {
+            HPX_ASSERT(a <= b);
+        }
+
+        [[nodiscard]] constexpr result_type a() const noexcept
+        {
+            return a_;
+        }
+
+        [[nodiscard]] constexpr result_type b() const noexcept
+        {
+            return b_;
+        }
+
+        /// Convert the blocks computed by
+        /// \a counter_based_engine::generate_blocks into values, the values
+        /// of block \a i are stored starting at values[i * values_per_block].
+        template <std::size_t N>
+        void convert(std::uint32_t const (&words)[4][N],
+            result_type (&values)[N * values_per_block]) const noexcept
+        {
+            namespace detail = hpx::parallel::detail;
+
+            RealType const scale = b_ - a_;
+
+            // clang-format off
+            HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                if constexpr (values_per_block == 4)
+                {
+                    for (std::size_t j = 0; j != 4; ++j)
+                    {
+                        values[4 * i + j] =
+                            a_ + scale * detail::unit_float(words[j][i]);
+                    }
+                }
+                else
+                {
+                    for (std::size_t j = 0; j != 2; ++j)
+                    {
+                        RealType const u =
+                            static_cast<RealType>(detail::unit_double(
+                                detail::make_uint64(words[2 * j][i],
+                                    words[2 * j + 1][i])));
+                        values[2 * i + j] = a_ + scale * u;
+                    }
+                }
+            }
+            // clang-format on
+        }
+
+    private:
+        RealType a_;
+        RealType b_;
+    };
+
+    /// Produces normally distributed floating point values. The values are
+    /// computed in pairs from two uniformly distributed values using the
+    /// Box-Muller transform.
+    template <typename RealType = double>
+    class normal_distribution
+    {
+        static_assert(std::is_floating_point_v<RealType>,
+            "normal_distribution requires a floating point type");
+
+    public:
+        using result_type = RealType;
+
+        static constexpr std::size_t values_per_block =
+            std::is_same_v<RealType, float> ? 4 : 2;
+
+        constexpr normal_distribution() noexcept
+          : normal_distribution(0)
+        {
+        }
+
+        explicit constexpr normal_distribution(
+            RealType mean, RealType stddev = 1) noexcept
+          : mean_(mean)
+          , stddev_(stddev)
+        {
+            HPX_ASSERT(stddev > 0);
+        }
+
+        [[nodiscard]] constexpr result_type mean() const noexcept
+        {
+            return mean_;
+        }
+
+        [[nodiscard]] constexpr result_type stddev() const noexcept
+        {
+            return stddev_;
+        }
+
+        /// Convert the blocks computed by
+        /// \a counter_based_engine::generate_blocks into values, the values
+        /// of block \a i are stored starting at values[i * values_per_block].
+        template <std::size_t N>
+        void convert(std::uint32_t const (&words)[4][N],
+            result_type (&values)[N * values_per_block]) const noexcept
+        {
+            namespace detail = hpx::parallel::detail;
+
+            constexpr RealType two_pi =
+                static_cast<RealType>(6.283185307179586476925286766559);
+
+            // clang-format off
+            HPX_IVDEP HPX_UNROLL HPX_VECTORIZE
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                for (std::size_t j = 0; j != values_per_block / 2; ++j)
+                {
+                    RealType u1, u2;
+                    if constexpr (values_per_block == 4)
+                    {
+                        u1 = detail::unit_float(words[2 * j][i]);
+                        u2 = detail::unit_float(words[2 * j + 1][i]);
+                    }
+                    else
+                    {
+                        u1 = static_cast<RealType>(detail::unit_double(
+                            detail::make_uint64(words[0][i], words[1][i])));
+                        u2 = static_cast<RealType>(detail::unit_double(
+                            detail::make_uint64(words[2][i], words[3][i])));
+                    }
+
+                    // 1 - u1 is in (0, 1], which avoids log(0)
+                    RealType const r =
+                        stddev_ * std::sqrt(-2 * std::log(1 - u1));
+                    RealType const theta = two_pi * u2;
+
+                    values[values_per_block * i + 2 * j] =
+                        mean_ + r * std::cos(theta);
+                    values[values_per_block * i + 2 * j + 1] =
+                        mean_ + r * std::sin(theta);
+                }
+            }
+            // clang-format on
+        }
+
+    private:
+        RealType mean_;
+        RealType stddev_;
+    };
+}    // namespace hpx::experimental
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // generate_random
+    namespace detail {
+
+        template <typename Iter>
+        struct generate_random
+          : public algorithm<generate_random<Iter>, Iter>
+        {
+            constexpr generate_random() noexcept
+              : algorithm<generate_random, Iter>("generate_random")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Sent,
+                typename Distribution, typename Engine>
+            static constexpr InIter sequential(ExPolicy&&, InIter first,
+                Sent last, Distribution const& dist, Engine const& engine)
+            {
+                return sequential_generate_random(first, 0,
+                    detail::distance(first, last), engine, dist);
+            }
+
+            template <typename ExPolicy, typename Sent, typename Distribution,
+                typename Engine>
+            static util::detail::algorithm_result_t<ExPolicy, Iter> parallel(
+                ExPolicy&& policy, Iter first, Sent last,
+                Distribution const& dist, Engine const& engine)
+            {
+                // the values depend on their position in the overall
+                // sequence only, not on the partitioning
+                auto f1 = [first, dist, engine](
+                              Iter part_begin, std::size_t part_size) {
+                    return sequential_generate_random(part_begin,
+                        static_cast<std::uint64_t>(part_begin - first),
+                        part_size, engine, dist);
+                };
+
+                return util::partitioner<ExPolicy, Iter>::call(
+                    HPX_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), HPX_MOVE(f1),
+                    [first, last](auto&&) {
+                        return detail::advance_to_sentinel(first, last);
+                    });
+            }
+        };
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Assign random values to the elements in the range [first, last). The
+    /// value assigned to the element at position \a i is computed from the
+    /// random blocks of \a engine (or of a \a philox4x32 engine constructed
+    /// from \a seed) that belong to the index \a i, independently of the
+    /// position of the engine and of all other elements. The result is
+    /// therefore the same for all execution policies, numbers of threads,
+    /// and chunk sizes.
+    ///
+    /// \note   Complexity: Exactly \a distance(first, last) assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam RandIter    The type of the iterators used (deduced). This
+    ///                     iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Distribution The type of the distribution (deduced), one of
+    ///                     \a uniform_int_distribution,
+    ///                     \a uniform_real_distribution, or
+    ///                     \a normal_distribution.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dist         The distribution of the generated values.
+    /// \param seed         The seed of the \a philox4x32 engine to use.
+    /// \param engine       The counter-based engine to use.
+    ///
+    /// \returns  The \a generate_random algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. It returns \a last.
+    ///
+    inline constexpr struct generate_random_t final
+      : hpx::detail::tag_parallel_algorithm<generate_random_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename Distribution,
+            typename Engine,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter> &&
+                is_counter_based_engine_v<Engine>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            RandIter>
+        tag_fallback_invoke(generate_random_t, ExPolicy&& policy,
+            RandIter first, RandIter last, Distribution const& dist,
+            Engine const& engine)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::generate_random<RandIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, dist, engine);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename Distribution,
+            typename Seed,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter> &&
+                std::is_integral_v<Seed>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            RandIter>
+        tag_fallback_invoke(generate_random_t, ExPolicy&& policy,
+            RandIter first, RandIter last, Distribution const& dist,
+            Seed seed)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::generate_random<RandIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, dist,
+                philox4x32(static_cast<std::uint64_t>(seed)));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename Distribution, typename Engine,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter> &&
+                is_counter_based_engine_v<Engine>
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(generate_random_t,
+            RandIter first, RandIter last, Distribution const& dist,
+            Engine const& engine)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::generate_random<RandIter>().call(
+                hpx::execution::seq, first, last, dist, engine);
+        }
+
+        // clang-format off
+        template <typename RandIter, typename Distribution, typename Seed,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter> &&
+                std::is_integral_v<Seed>
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(generate_random_t,
+            RandIter first, RandIter last, Distribution const& dist,
+            Seed seed)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::generate_random<RandIter>().call(
+                hpx::execution::seq, first, last, dist,
+                philox4x32(static_cast<std::uint64_t>(seed)));
+        }
+    } generate_random{};
+}    // namespace hpx::experimental
@@ -467,6 +467,7 @@ namespace hpx {
 #include <hpx/modules/async_local.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/compress.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -1595,24 +1596,13 @@ namespace hpx::parallel {
                     hpx::tuple<FwdIter1, FwdIter2, FwdIter3>,
                     output_iterator_offset>;
 
-                // Note: replacing the invoke() with HPX_INVOKE()
-                // below makes gcc generate errors
                 auto f1 = [pred = HPX_FORWARD(Pred, pred),
                               proj = HPX_FORWARD(Proj, proj)](
                               zip_iterator part_begin,
                               std::size_t part_size) -> output_iterator_offset {
-                    std::size_t true_count = 0;
-
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj, &true_count](
-                            zip_iterator it) mutable -> void {
-                            bool f = hpx::invoke(
-                                pred, hpx::invoke(proj, get<0>(*it)));
-
-                            if ((get<1>(*it) = f))
-                                ++true_count;
-                        });
+                    std::size_t const true_count =
+                        sequential_compress_flags<std::decay_t<ExPolicy>>(
+                            part_begin, part_size, pred, proj);
 
                     return output_iterator_offset(
                         true_count, part_size - true_count);
@@ -1635,13 +1625,8 @@ namespace hpx::parallel {
                     std::advance(dest_true, count_true);
                     std::advance(dest_false, count_false);
 
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest_true, &dest_false](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest_true++ = get<0>(*it);
-                            else
-                                *dest_false++ = get<0>(*it);
-                        });
+                    sequential_partition_compress<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, dest_true, dest_false);
                 };
 
                 auto f4 = [last_iter, dest_true, dest_false, flags](
@@ -220,6 +220,7 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/compress.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
@@ -309,20 +310,13 @@ namespace hpx::parallel {
 
                 using hpx::get;
 
-                // Note: replacing the invoke() with HPX_INVOKE()
-                // below makes gcc generate errors
+                // the flags mark the elements to remove
                 auto f1 = [pred = HPX_FORWARD(Pred, pred),
                               proj = HPX_FORWARD(Proj, proj)](
                               zip_iterator part_begin,
                               std::size_t part_size) -> void {
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj](zip_iterator it) mutable {
-                            bool f = hpx::invoke(
-                                pred, hpx::invoke(proj, get<0>(*it)));
-
-                            get<1>(*it) = f;
-                        });
+                    sequential_compress_flags<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, pred, proj);
                 };
 
                 auto f2 = [flags, first, count](
@@ -333,7 +327,10 @@ namespace hpx::parallel {
                     auto dest = first;
                     auto part_size = count;
 
-                    using execution_policy_type = std::decay_t<ExPolicy>;
+                    // the elements are moved one by one, this loop can't be
+                    // vectorized
+                    using execution_policy_type =
+                        hpx::execution::sequenced_policy;
                     if (dest == get<0>(part_begin.get_iterator_tuple()))
                     {
                         // Self-assignment must be detected.
@@ -454,10 +451,8 @@ namespace hpx {
         tag_fallback_invoke(hpx::remove_t, ExPolicy&& policy, FwdIter first,
             FwdIter last, T const& value)
         {
-            using Type = typename std::iterator_traits<FwdIter>::value_type;
-
             return hpx::remove_if(HPX_FORWARD(ExPolicy, policy), first, last,
-                [value](Type const& a) -> bool { return value == a; });
+                hpx::parallel::detail::compare_to<T>(value));
         }
     } remove{};
 }    // namespace hpx
@@ -261,6 +261,7 @@ namespace hpx {
 
 #include <hpx/config.hpp>
 #include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
@@ -284,6 +285,21 @@ namespace hpx::parallel {
 
         /// \cond NOINTERNAL
 
+        // Negate the result of the given predicate. Unlike a lambda this
+        // can be applied to vector packs if the predicate supports it.
+        template <typename F>
+        struct not_predicate
+        {
+            F f;
+
+            template <typename T>
+            HPX_HOST_DEVICE HPX_FORCEINLINE constexpr auto operator()(
+                T const& t) const -> decltype(!HPX_INVOKE(f, t))
+            {
+                return !HPX_INVOKE(f, t);
+            }
+        };
+
         // sequential remove_copy
         template <typename InIter, typename Sent, typename OutIter, typename T,
             typename Proj>
@@ -327,7 +343,7 @@ namespace hpx::parallel {
             {
                 return copy_if<IterPair>().call(
                     HPX_FORWARD(ExPolicy, policy), first, last, dest,
-                    [val](T const& a) -> bool { return !(a == val); },
+                    not_predicate<compare_to<T>>{compare_to<T>(val)},
                     HPX_FORWARD(Proj, proj));
             }
         };
@@ -382,14 +398,9 @@ namespace hpx::parallel {
             parallel(ExPolicy&& policy, FwdIter1 first, Sent last,
                 FwdIter2 dest, F&& f, Proj&& proj)
             {
-                using value_type =
-                    typename std::iterator_traits<FwdIter1>::value_type;
-
-                return copy_if<IterPair>().call(
-                    HPX_FORWARD(ExPolicy, policy), first, last, dest,
-                    [f = HPX_FORWARD(F, f)](value_type const& a) -> bool {
-                        return !HPX_INVOKE(f, a);
-                    },
+                return copy_if<IterPair>().call(HPX_FORWARD(ExPolicy, policy),
+                    first, last, dest,
+                    not_predicate<std::decay_t<F>>{HPX_FORWARD(F, f)},
                     HPX_FORWARD(Proj, proj));
             }
         };
@@ -511,11 +522,8 @@ namespace hpx {
             static_assert(hpx::traits::is_forward_iterator_v<FwdIter2>,
                 "Required at least forward iterator.");
 
-            using type = typename std::iterator_traits<FwdIter1>::value_type;
-
             return hpx::remove_copy_if(HPX_FORWARD(ExPolicy, policy), first,
-                last, dest,
-                [value](type const& a) -> bool { return value == a; });
+                last, dest, hpx::parallel::detail::compare_to<T>(value));
         }
     } remove_copy{};
 }    // namespace hpx
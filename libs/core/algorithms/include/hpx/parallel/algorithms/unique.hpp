@@ -304,6 +304,7 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
+#include <hpx/parallel/algorithms/detail/compress.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -644,38 +645,21 @@ namespace hpx::parallel {
                 using scan_partitioner_type = util::scan_partitioner<ExPolicy,
                     unique_copy_result<FwdIter1, FwdIter2>, std::size_t>;
 
+                // the flags mark the elements to keep
                 auto f1 = [pred = HPX_FORWARD(Pred, pred),
                               proj = HPX_FORWARD(Proj, proj)](
                               zip_iterator part_begin,
                               std::size_t part_size) -> std::size_t {
-                    FwdIter1 base = get<0>(part_begin.get_iterator_tuple());
-                    std::size_t curr = 0;
-
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        ++part_begin, part_size, [&](zip_iterator it) mutable {
-                            bool r = HPX_INVOKE(pred, HPX_INVOKE(proj, *base),
-                                HPX_INVOKE(proj, get<0>(*it)));
-
-                            if (!((get<1>(*it) = r)))
-                            {
-                                base = get<0>(it.get_iterator_tuple());
-                                ++curr;
-                            }
-                        });
-
-                    return curr;
+                    return sequential_unique_flags<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, pred, proj);
                 };
                 auto f3 = [dest, flags](zip_iterator part_begin,
                               std::size_t part_size,
                               std::size_t val) mutable -> void {
                     HPX_UNUSED(flags);
                     std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(++part_begin,
-                        part_size, [&dest](zip_iterator it) mutable {
-                            if (!get<1>(*it))
-                                *dest++ = get<0>(*it);
-                        });
+                    sequential_compress<std::decay_t<ExPolicy>>(
+                        ++part_begin, part_size, dest);
                 };
 
                 auto f4 = [last_iter, dest, flags](
@@ -53,3 +53,4 @@
 #include <hpx/parallel/container_algorithms/swap_ranges.hpp>
 #include <hpx/parallel/container_algorithms/transform.hpp>
 #include <hpx/parallel/container_algorithms/unique.hpp>
+#include <hpx/parallel/container_algorithms/views.hpp>
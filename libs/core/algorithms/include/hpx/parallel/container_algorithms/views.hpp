@@ -0,0 +1,1177 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/views.hpp
+/// \page hpx::ranges::views
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_adaptor.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/algorithms/count.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/parallel/container_algorithms/count.hpp>
+#include <hpx/parallel/container_algorithms/for_each.hpp>
+#include <hpx/parallel/container_algorithms/reduce.hpp>
+#include <hpx/parallel/container_algorithms/transform_reduce.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// The views defined here are lazy ranges: their elements are computed while
+// an algorithm traverses them, no temporary sequences are materialized. All
+// views but filter_view preserve random access, the existing partitioners
+// split them exactly like the underlying ranges. A pipeline containing
+// filters (for instance v | transform(f) | filter(p)) is not random access,
+// reduce, transform_reduce, count, count_if, and for_each are customized for
+// those to run a single parallel pass over the innermost random access range
+// instead, applying the filters and transformations on the fly.
+
+namespace hpx::ranges::views {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All views derive from view_base. Views are cheap to copy, they refer to
+    // the elements of the underlying range without owning them.
+    struct view_base
+    {
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename T>
+        struct is_view : std::is_base_of<view_base, T>
+        {
+        };
+
+        template <typename Iterator, typename Sentinel>
+        struct is_view<hpx::util::iterator_range<Iterator, Sentinel>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+    /// \endcond
+
+    template <typename T>
+    inline constexpr bool is_view_v = detail::is_view<std::decay_t<T>>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Views are stored by value, all other ranges are referred to by an
+    // iterator_range.
+    template <typename Rng>
+    using all_t = std::conditional_t<is_view_v<Rng>, std::decay_t<Rng>,
+        hpx::util::iterator_range<
+            hpx::traits::range_iterator_t<std::remove_reference_t<Rng>>,
+            hpx::traits::range_sentinel_t<std::remove_reference_t<Rng>>>>;
+
+    template <typename Rng>
+    constexpr all_t<Rng> all(Rng&& rng)
+    {
+        if constexpr (is_view_v<Rng>)
+        {
+            return HPX_FORWARD(Rng, rng);
+        }
+        else
+        {
+            static_assert(std::is_lvalue_reference_v<Rng>,
+                "views can refer to ranges only if those outlive the view");
+
+            return all_t<Rng>(hpx::util::begin(rng), hpx::util::end(rng));
+        }
+    }
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Iterators are required to be assignable, most lambdas are not.
+        template <typename F>
+        class function_box
+        {
+        public:
+            function_box() = default;
+
+            explicit function_box(F const& f)
+              : f_(std::in_place, f)
+            {
+            }
+
+            explicit function_box(F&& f)
+              : f_(std::in_place, HPX_MOVE(f))
+            {
+            }
+
+            function_box(function_box const&) = default;
+            function_box(function_box&&) = default;
+
+            function_box& operator=(function_box const& rhs)
+            {
+                if (this != &rhs)
+                {
+                    if (rhs.f_)
+                        f_.emplace(*rhs.f_);
+                    else
+                        f_.reset();
+                }
+                return *this;
+            }
+
+            function_box& operator=(function_box&& rhs) noexcept(
+                std::is_nothrow_move_constructible_v<F>)
+            {
+                if (this != &rhs)
+                {
+                    if (rhs.f_)
+                        f_.emplace(HPX_MOVE(*rhs.f_));
+                    else
+                        f_.reset();
+                }
+                return *this;
+            }
+
+            ~function_box() = default;
+
+            [[nodiscard]] constexpr F const& get() const noexcept
+            {
+                return *f_;
+            }
+
+        private:
+            hpx::optional<F> f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Range adaptor closure, the result of for instance transform(f),
+        // which is applied to a range using operator|.
+        template <typename Adaptor>
+        struct range_closure
+        {
+            // clang-format off
+            template <typename Rng,
+                HPX_CONCEPT_REQUIRES_(
+                    hpx::traits::is_range_v<std::decay_t<Rng>>
+                )>
+            // clang-format on
+            friend constexpr auto operator|(Rng&& rng, range_closure const& c)
+            {
+                return c.adaptor(HPX_FORWARD(Rng, rng));
+            }
+
+            Adaptor adaptor;
+        };
+
+        template <typename Adaptor>
+        range_closure(Adaptor) -> range_closure<Adaptor>;
+
+        template <typename Rng>
+        using view_iterator_t = hpx::traits::range_iterator_t<Rng const>;
+
+        template <typename Rng>
+        using view_difference_t = typename std::iterator_traits<
+            view_iterator_t<Rng>>::difference_type;
+
+        template <typename Rng>
+        inline constexpr bool is_random_access_view_v =
+            hpx::traits::is_random_access_iterator_v<view_iterator_t<Rng>>;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    // iota_view: the sequence of values [first, last)
+    template <typename T>
+    class iota_view : public view_base
+    {
+    public:
+        using iterator = hpx::util::counting_iterator<T>;
+
+        iota_view() = default;
+
+        constexpr iota_view(T first, T last) noexcept
+          : first_(first)
+          , last_(last)
+        {
+        }
+
+        [[nodiscard]] constexpr iterator begin() const noexcept
+        {
+            return iterator(first_);
+        }
+
+        [[nodiscard]] constexpr iterator end() const noexcept
+        {
+            return iterator(last_);
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return static_cast<std::size_t>(last_ - first_);
+        }
+
+    private:
+        T first_ = T();
+        T last_ = T();
+    };
+
+    template <typename T>
+    constexpr iota_view<T> iota(T first, T last) noexcept
+    {
+        return iota_view<T>(first, last);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // transform_view: the results of invoking f on the elements of the
+    // underlying range
+    template <typename Iterator, typename F>
+    class transform_view_iterator;
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename Iterator, typename F>
+        struct transform_view_iterator_base
+        {
+            using reference = hpx::util::invoke_result_t<F const&,
+                typename std::iterator_traits<Iterator>::reference>;
+
+            using type = hpx::util::iterator_adaptor<
+                transform_view_iterator<Iterator, F>, Iterator,
+                std::decay_t<reference>, void, reference>;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    template <typename Iterator, typename F>
+    class transform_view_iterator
+      : public detail::transform_view_iterator_base<Iterator, F>::type
+    {
+        using base_type =
+            typename detail::transform_view_iterator_base<Iterator, F>::type;
+
+    public:
+        transform_view_iterator() = default;
+
+        transform_view_iterator(
+            Iterator const& it, detail::function_box<F> const& f)
+          : base_type(it)
+          , f_(f)
+        {
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        typename base_type::reference dereference() const
+        {
+            return HPX_INVOKE(f_.get(), *this->base());
+        }
+
+        detail::function_box<F> f_;
+    };
+
+    template <typename V, typename F>
+    class transform_view : public view_base
+    {
+    public:
+        using base_type = V;
+        using iterator = transform_view_iterator<detail::view_iterator_t<V>, F>;
+
+        transform_view() = default;
+
+        constexpr transform_view(V base, F f)
+          : base_(HPX_MOVE(base))
+          , f_(HPX_MOVE(f))
+        {
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return iterator(hpx::util::begin(base_), f_);
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return iterator(hpx::util::end(base_), f_);
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return hpx::util::size(base_);
+        }
+
+        [[nodiscard]] constexpr V const& base() const noexcept
+        {
+            return base_;
+        }
+
+        [[nodiscard]] constexpr F const& fun() const noexcept
+        {
+            return f_.get();
+        }
+
+    private:
+        V base_;
+        detail::function_box<F> f_;
+    };
+
+    // clang-format off
+    template <typename Rng, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_range_v<std::decay_t<Rng>>
+        )>
+    // clang-format on
+    constexpr auto transform(Rng&& rng, F f)
+    {
+        return transform_view<all_t<Rng>, F>(
+            views::all(HPX_FORWARD(Rng, rng)), HPX_MOVE(f));
+    }
+
+    template <typename F>
+    constexpr auto transform(F f)
+    {
+        return detail::range_closure{[f = HPX_MOVE(f)](auto&& rng) {
+            return views::transform(HPX_FORWARD(decltype(rng), rng), f);
+        }};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // filter_view: the elements of the underlying range that satisfy the
+    // predicate, a forward range
+    template <typename Iterator, typename Pred>
+    class filter_view_iterator
+      : public hpx::util::iterator_adaptor<filter_view_iterator<Iterator, Pred>,
+            Iterator, void, std::forward_iterator_tag>
+    {
+        using base_type =
+            hpx::util::iterator_adaptor<filter_view_iterator<Iterator, Pred>,
+                Iterator, void, std::forward_iterator_tag>;
+
+    public:
+        filter_view_iterator() = default;
+
+        filter_view_iterator(Iterator const& it, Iterator const& last,
+            detail::function_box<Pred> const& pred)
+          : base_type(it)
+          , last_(last)
+          , pred_(pred)
+        {
+            satisfy();
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        void increment()
+        {
+            ++this->base_reference();
+            satisfy();
+        }
+
+        void satisfy()
+        {
+            auto& it = this->base_reference();
+            while (it != last_ && !HPX_INVOKE(pred_.get(), *it))
+            {
+                ++it;
+            }
+        }
+
+        Iterator last_;
+        detail::function_box<Pred> pred_;
+    };
+
+    template <typename V, typename Pred>
+    class filter_view : public view_base
+    {
+    public:
+        using base_type = V;
+        using iterator =
+            filter_view_iterator<detail::view_iterator_t<V>, Pred>;
+
+        filter_view() = default;
+
+        constexpr filter_view(V base, Pred pred)
+          : base_(HPX_MOVE(base))
+          , pred_(HPX_MOVE(pred))
+        {
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return iterator(
+                hpx::util::begin(base_), hpx::util::end(base_), pred_);
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return iterator(
+                hpx::util::end(base_), hpx::util::end(base_), pred_);
+        }
+
+        [[nodiscard]] constexpr V const& base() const noexcept
+        {
+            return base_;
+        }
+
+        [[nodiscard]] constexpr Pred const& pred() const noexcept
+        {
+            return pred_.get();
+        }
+
+    private:
+        V base_;
+        detail::function_box<Pred> pred_;
+    };
+
+    // clang-format off
+    template <typename Rng, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_range_v<std::decay_t<Rng>>
+        )>
+    // clang-format on
+    constexpr auto filter(Rng&& rng, Pred pred)
+    {
+        return filter_view<all_t<Rng>, Pred>(
+            views::all(HPX_FORWARD(Rng, rng)), HPX_MOVE(pred));
+    }
+
+    template <typename Pred>
+    constexpr auto filter(Pred pred)
+    {
+        return detail::range_closure{[pred = HPX_MOVE(pred)](auto&& rng) {
+            return views::filter(HPX_FORWARD(decltype(rng), rng), pred);
+        }};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // zip_view: tuples of the corresponding elements of the underlying
+    // ranges, as long as the shortest of those
+    template <typename... Vs>
+    class zip_view : public view_base
+    {
+    public:
+        using iterator =
+            hpx::util::zip_iterator<detail::view_iterator_t<Vs>...>;
+
+        zip_view() = default;
+
+        explicit constexpr zip_view(Vs... bases)
+          : bases_(HPX_MOVE(bases)...)
+        {
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return begin_impl(std::index_sequence_for<Vs...>());
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return end_impl(std::index_sequence_for<Vs...>());
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return size_impl(std::index_sequence_for<Vs...>());
+        }
+
+    private:
+        template <std::size_t... Is>
+        iterator begin_impl(std::index_sequence<Is...>) const
+        {
+            return iterator(hpx::util::begin(hpx::get<Is>(bases_))...);
+        }
+
+        template <std::size_t... Is>
+        iterator end_impl(std::index_sequence<Is...> is) const
+        {
+            std::size_t const size = size_impl(is);
+            return iterator(std::next(hpx::util::begin(hpx::get<Is>(bases_)),
+                static_cast<detail::view_difference_t<Vs>>(size))...);
+        }
+
+        template <std::size_t... Is>
+        std::size_t size_impl(std::index_sequence<Is...>) const
+        {
+            // clang-format off
+            return (std::min)({static_cast<std::size_t>(
+                std::distance(hpx::util::begin(hpx::get<Is>(bases_)),
+                    hpx::util::end(hpx::get<Is>(bases_))))...});
+            // clang-format on
+        }
+
+        hpx::tuple<Vs...> bases_;
+    };
+
+    template <typename... Rngs>
+    constexpr auto zip(Rngs&&... rngs)
+    {
+        static_assert(sizeof...(Rngs) != 0, "zip requires at least one range");
+        return zip_view<all_t<Rngs>...>(
+            views::all(HPX_FORWARD(Rngs, rngs))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // stride_view: every n-th element of the underlying random access range,
+    // starting with the first
+    template <typename Iterator>
+    class stride_view_iterator
+      : public hpx::util::iterator_facade<stride_view_iterator<Iterator>,
+            typename std::iterator_traits<Iterator>::value_type,
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iterator>::reference,
+            typename std::iterator_traits<Iterator>::difference_type>
+    {
+        using base_type =
+            hpx::util::iterator_facade<stride_view_iterator<Iterator>,
+                typename std::iterator_traits<Iterator>::value_type,
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<Iterator>::reference,
+                typename std::iterator_traits<Iterator>::difference_type>;
+
+    public:
+        using difference_type = typename base_type::difference_type;
+
+        stride_view_iterator() = default;
+
+        stride_view_iterator(
+            Iterator first, difference_type pos, difference_type stride)
+          : first_(HPX_MOVE(first))
+          , pos_(pos)
+          , stride_(stride)
+        {
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        typename base_type::reference dereference() const
+        {
+            return *(first_ + pos_);
+        }
+
+        bool equal(stride_view_iterator const& rhs) const noexcept
+        {
+            return pos_ == rhs.pos_;
+        }
+
+        void increment() noexcept
+        {
+            pos_ += stride_;
+        }
+
+        void decrement() noexcept
+        {
+            pos_ -= stride_;
+        }
+
+        void advance(difference_type n) noexcept
+        {
+            pos_ += n * stride_;
+        }
+
+        difference_type distance_to(
+            stride_view_iterator const& rhs) const noexcept
+        {
+            return (rhs.pos_ - pos_) / stride_;
+        }
+
+        Iterator first_;
+        difference_type pos_ = 0;
+        difference_type stride_ = 1;
+    };
+
+    template <typename V>
+    class stride_view : public view_base
+    {
+        static_assert(detail::is_random_access_view_v<V>,
+            "stride_view requires a random access range");
+
+        using difference_type = detail::view_difference_t<V>;
+
+    public:
+        using iterator = stride_view_iterator<detail::view_iterator_t<V>>;
+
+        stride_view() = default;
+
+        constexpr stride_view(V base, difference_type stride)
+          : base_(HPX_MOVE(base))
+          , stride_(stride)
+        {
+            HPX_ASSERT(stride_ > 0);
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return iterator(hpx::util::begin(base_), 0, stride_);
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return iterator(hpx::util::begin(base_),
+                static_cast<difference_type>(size()) * stride_, stride_);
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            auto const count = static_cast<std::size_t>(
+                std::distance(hpx::util::begin(base_), hpx::util::end(base_)));
+            return (count + stride_ - 1) / stride_;
+        }
+
+    private:
+        V base_;
+        difference_type stride_ = 1;
+    };
+
+    // clang-format off
+    template <typename Rng,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_range_v<std::decay_t<Rng>>
+        )>
+    // clang-format on
+    constexpr auto stride(Rng&& rng, std::ptrdiff_t n)
+    {
+        return stride_view<all_t<Rng>>(views::all(HPX_FORWARD(Rng, rng)), n);
+    }
+
+    inline constexpr auto stride(std::ptrdiff_t n)
+    {
+        return detail::range_closure{[n](auto&& rng) {
+            return views::stride(HPX_FORWARD(decltype(rng), rng), n);
+        }};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // chunk_view: consecutive, non-overlapping subranges of n elements of the
+    // underlying random access range, the last one may be shorter
+    template <typename Iterator>
+    class chunk_view_iterator
+      : public hpx::util::iterator_facade<chunk_view_iterator<Iterator>,
+            hpx::util::iterator_range<Iterator>,
+            std::random_access_iterator_tag,
+            hpx::util::iterator_range<Iterator>,
+            typename std::iterator_traits<Iterator>::difference_type>
+    {
+        using base_type =
+            hpx::util::iterator_facade<chunk_view_iterator<Iterator>,
+                hpx::util::iterator_range<Iterator>,
+                std::random_access_iterator_tag,
+                hpx::util::iterator_range<Iterator>,
+                typename std::iterator_traits<Iterator>::difference_type>;
+
+    public:
+        using difference_type = typename base_type::difference_type;
+
+        chunk_view_iterator() = default;
+
+        chunk_view_iterator(Iterator first, difference_type pos,
+            difference_type size, difference_type chunk)
+          : first_(HPX_MOVE(first))
+          , pos_(pos)
+          , size_(size)
+          , chunk_(chunk)
+        {
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        typename base_type::reference dereference() const
+        {
+            return hpx::util::iterator_range<Iterator>(
+                first_ + pos_, first_ + (std::min)(pos_ + chunk_, size_));
+        }
+
+        bool equal(chunk_view_iterator const& rhs) const noexcept
+        {
+            return pos_ == rhs.pos_;
+        }
+
+        void increment() noexcept
+        {
+            pos_ += chunk_;
+        }
+
+        void decrement() noexcept
+        {
+            pos_ -= chunk_;
+        }
+
+        void advance(difference_type n) noexcept
+        {
+            pos_ += n * chunk_;
+        }
+
+        difference_type distance_to(
+            chunk_view_iterator const& rhs) const noexcept
+        {
+            return (rhs.pos_ - pos_) / chunk_;
+        }
+
+        Iterator first_;
+        difference_type pos_ = 0;
+        difference_type size_ = 0;
+        difference_type chunk_ = 1;
+    };
+
+    template <typename V>
+    class chunk_view : public view_base
+    {
+        static_assert(detail::is_random_access_view_v<V>,
+            "chunk_view requires a random access range");
+
+        using difference_type = detail::view_difference_t<V>;
+
+    public:
+        using iterator = chunk_view_iterator<detail::view_iterator_t<V>>;
+
+        chunk_view() = default;
+
+        constexpr chunk_view(V base, difference_type chunk)
+          : base_(HPX_MOVE(base))
+          , chunk_(chunk)
+        {
+            HPX_ASSERT(chunk_ > 0);
+        }
+
+        [[nodiscard]] iterator begin() const
+        {
+            return iterator(hpx::util::begin(base_), 0, count(), chunk_);
+        }
+
+        [[nodiscard]] iterator end() const
+        {
+            return iterator(hpx::util::begin(base_),
+                static_cast<difference_type>(size()) * chunk_, count(),
+                chunk_);
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return (static_cast<std::size_t>(count()) + chunk_ - 1) / chunk_;
+        }
+
+    private:
+        difference_type count() const
+        {
+            return std::distance(
+                hpx::util::begin(base_), hpx::util::end(base_));
+        }
+
+        V base_;
+        difference_type chunk_ = 1;
+    };
+
+    // clang-format off
+    template <typename Rng,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_range_v<std::decay_t<Rng>>
+        )>
+    // clang-format on
+    constexpr auto chunk(Rng&& rng, std::ptrdiff_t n)
+    {
+        return chunk_view<all_t<Rng>>(views::all(HPX_FORWARD(Rng, rng)), n);
+    }
+
+    inline constexpr auto chunk(std::ptrdiff_t n)
+    {
+        return detail::range_closure{[n](auto&& rng) {
+            return views::chunk(HPX_FORWARD(decltype(rng), rng), n);
+        }};
+    }
+}    // namespace hpx::ranges::views
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce the elements for which pred returns true after applying conv.
+    template <typename T>
+    struct filter_reduce : public algorithm<filter_reduce<T>, T>
+    {
+        constexpr filter_reduce() noexcept
+          : algorithm<filter_reduce, T>("filter_reduce")
+        {
+        }
+
+        template <typename ExPolicy, typename InIterB, typename InIterE,
+            typename T_, typename Pred, typename Reduce, typename Conv>
+        static constexpr T sequential(ExPolicy&&, InIterB first, InIterE last,
+            T_&& init, Pred&& pred, Reduce&& r, Conv&& conv)
+        {
+            T val = HPX_FORWARD(T_, init);
+            for (/**/; first != last; ++first)
+            {
+                auto&& v = *first;
+                if (HPX_INVOKE(pred, v))
+                {
+                    val = HPX_INVOKE(r, HPX_MOVE(val), HPX_INVOKE(conv, v));
+                }
+            }
+            return val;
+        }
+
+        template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
+            typename T_, typename Pred, typename Reduce, typename Conv>
+        static util::detail::algorithm_result_t<ExPolicy, T> parallel(
+            ExPolicy&& policy, FwdIterB first, FwdIterE last, T_&& init,
+            Pred&& pred, Reduce&& r, Conv&& conv)
+        {
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, T>::get(
+                    HPX_FORWARD(T_, init));
+            }
+
+            // a partition may not contain any selected element
+            // init-captures avoid casting away the constness of the copied
+            // callables when invoking them
+            auto f1 = [pred = HPX_FORWARD(Pred, pred), r = r,
+                          conv = HPX_FORWARD(Conv, conv)](FwdIterB part_begin,
+                          std::size_t part_size) -> hpx::optional<T> {
+                hpx::optional<T> result;
+                for (/**/; part_size != 0; --part_size, ++part_begin)
+                {
+                    auto&& v = *part_begin;
+                    if (HPX_INVOKE(pred, v))
+                    {
+                        result.emplace(HPX_INVOKE(conv, v));
+                        break;
+                    }
+                }
+
+                if (result)
+                {
+                    T& val = *result;
+                    while (--part_size != 0)
+                    {
+                        auto&& v = *++part_begin;
+                        if (HPX_INVOKE(pred, v))
+                        {
+                            val = HPX_INVOKE(
+                                r, HPX_MOVE(val), HPX_INVOKE(conv, v));
+                        }
+                    }
+                }
+                return result;
+            };
+
+            return util::partitioner<ExPolicy, T, hpx::optional<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), HPX_MOVE(f1),
+                hpx::unwrapping([init = HPX_FORWARD(T_, init),
+                                    r = HPX_FORWARD(Reduce, r)](
+                                    auto&& results) mutable -> T {
+                    T val = HPX_MOVE(init);
+                    for (auto&& part : results)
+                    {
+                        if (part)
+                        {
+                            val = HPX_INVOKE(r, HPX_MOVE(val), HPX_MOVE(*part));
+                        }
+                    }
+                    return val;
+                }));
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::ranges::views {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A pipeline is filtered if it contains at least one filter_view, the
+        // transformations applied after that are fused as well.
+        template <typename T>
+        struct is_filtered_view : std::false_type
+        {
+        };
+
+        template <typename V, typename Pred>
+        struct is_filtered_view<filter_view<V, Pred>> : std::true_type
+        {
+        };
+
+        template <typename V, typename F>
+        struct is_filtered_view<transform_view<V, F>> : is_filtered_view<V>
+        {
+        };
+
+        template <typename T>
+        inline constexpr bool is_filtered_view_v =
+            is_filtered_view<std::decay_t<T>>::value;
+
+        template <typename T>
+        struct is_filter_view : std::false_type
+        {
+        };
+
+        template <typename V, typename Pred>
+        struct is_filter_view<filter_view<V, Pred>> : std::true_type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A filtered pipeline lowered to its innermost unfiltered range, the
+        // predicate selecting the elements of that range, and the conversion
+        // turning those into the elements of the pipeline.
+        template <typename Rng, typename Pred, typename Conv>
+        struct fused_pipeline
+        {
+            Rng rng;
+            Pred pred;
+            Conv conv;
+        };
+
+        template <typename Rng, typename Pred, typename Conv>
+        fused_pipeline(Rng, Pred, Conv) -> fused_pipeline<Rng, Pred, Conv>;
+
+        template <typename V>
+        auto lower(V const& v)
+        {
+            if constexpr (is_filter_view<V>::value)
+            {
+                if constexpr (is_filtered_view_v<typename V::base_type>)
+                {
+                    auto inner = detail::lower(v.base());
+                    return fused_pipeline{HPX_MOVE(inner.rng),
+                        [pred = HPX_MOVE(inner.pred), conv = inner.conv,
+                            p = v.pred()](auto&& x) -> bool {
+                            return HPX_INVOKE(pred, x) &&
+                                HPX_INVOKE(p, HPX_INVOKE(conv, x));
+                        },
+                        inner.conv};
+                }
+                else
+                {
+                    return fused_pipeline{v.base(),
+                        [p = v.pred()](auto&& x) -> bool {
+                            return HPX_INVOKE(p, x);
+                        },
+                        hpx::identity{}};
+                }
+            }
+            else
+            {
+                // transform_view applied to a filtered pipeline
+                auto inner = detail::lower(v.base());
+                return fused_pipeline{HPX_MOVE(inner.rng),
+                    HPX_MOVE(inner.pred),
+                    [conv = HPX_MOVE(inner.conv), f = v.fun()](
+                        auto&& x) -> decltype(auto) {
+                        return HPX_INVOKE(f, HPX_INVOKE(conv, x));
+                    }};
+            }
+        }
+
+        template <typename Rng>
+        using filtered_value_t = typename std::iterator_traits<
+            hpx::traits::range_iterator_t<Rng>>::value_type;
+
+        template <typename Pipeline>
+        using pipeline_iterator_t = hpx::traits::range_iterator_t<
+            decltype(std::declval<Pipeline&>().rng)>;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customizations of the range based algorithms for filtered pipelines,
+    // those run a single parallel pass over the innermost unfiltered range.
+
+    /// \cond NOINTERNAL
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename T, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T> tag_invoke(
+        hpx::ranges::reduce_t, ExPolicy&& policy, Rng&& rng, T init, F f)
+    {
+        auto p = detail::lower(rng);
+        return hpx::parallel::detail::filter_reduce<T>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng), HPX_MOVE(init), HPX_MOVE(p.pred),
+            HPX_MOVE(f), HPX_MOVE(p.conv));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename T,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T> tag_invoke(
+        hpx::ranges::reduce_t, ExPolicy&& policy, Rng&& rng, T init)
+    {
+        auto p = detail::lower(rng);
+        return hpx::parallel::detail::filter_reduce<T>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng), HPX_MOVE(init), HPX_MOVE(p.pred),
+            std::plus<>(), HPX_MOVE(p.conv));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        detail::filtered_value_t<Rng>>
+    tag_invoke(hpx::ranges::reduce_t, ExPolicy&& policy, Rng&& rng)
+    {
+        using value_type = detail::filtered_value_t<Rng>;
+
+        auto p = detail::lower(rng);
+        return hpx::parallel::detail::filter_reduce<value_type>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng), value_type{}, HPX_MOVE(p.pred),
+            std::plus<>(), HPX_MOVE(p.conv));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename T, typename Reduce,
+        typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T> tag_invoke(
+        hpx::ranges::transform_reduce_t, ExPolicy&& policy, Rng&& rng, T init,
+        Reduce red_op, Convert conv_op)
+    {
+        auto p = detail::lower(rng);
+        return hpx::parallel::detail::filter_reduce<T>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng), HPX_MOVE(init), HPX_MOVE(p.pred),
+            HPX_MOVE(red_op),
+            [conv = HPX_MOVE(p.conv), conv_op = HPX_MOVE(conv_op)](
+                auto&& x) -> decltype(auto) {
+                return HPX_INVOKE(conv_op, HPX_INVOKE(conv, x));
+            });
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename F,
+        typename Proj = hpx::identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    decltype(auto) tag_invoke(hpx::ranges::count_if_t, ExPolicy&& policy,
+        Rng&& rng, F f, Proj proj = Proj())
+    {
+        auto p = detail::lower(rng);
+
+        using difference_type = typename std::iterator_traits<
+            detail::pipeline_iterator_t<decltype(p)>>::difference_type;
+
+        return hpx::parallel::detail::count_if<difference_type>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng),
+            [pred = HPX_MOVE(p.pred), conv = HPX_MOVE(p.conv), f = HPX_MOVE(f),
+                proj = HPX_MOVE(proj)](auto&& x) -> bool {
+                return HPX_INVOKE(pred, x) &&
+                    HPX_INVOKE(f, HPX_INVOKE(proj, HPX_INVOKE(conv, x)));
+            },
+            hpx::identity{});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename T,
+        typename Proj = hpx::identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    decltype(auto) tag_invoke(hpx::ranges::count_t, ExPolicy&& policy,
+        Rng&& rng, T const& value, Proj proj = Proj())
+    {
+        auto p = detail::lower(rng);
+
+        using difference_type = typename std::iterator_traits<
+            detail::pipeline_iterator_t<decltype(p)>>::difference_type;
+
+        return hpx::parallel::detail::count_if<difference_type>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng),
+            [pred = HPX_MOVE(p.pred), conv = HPX_MOVE(p.conv), value,
+                proj = HPX_MOVE(proj)](auto&& x) -> bool {
+                return HPX_INVOKE(pred, x) &&
+                    HPX_INVOKE(proj, HPX_INVOKE(conv, x)) == value;
+            },
+            hpx::identity{});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename Rng, typename F,
+        typename Proj = hpx::identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            detail::is_filtered_view_v<Rng>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        hpx::traits::range_iterator_t<Rng>>
+    tag_invoke(hpx::ranges::for_each_t, ExPolicy&& policy, Rng&& rng, F f,
+        Proj proj = Proj())
+    {
+        auto p = detail::lower(rng);
+
+        using iterator_type = detail::pipeline_iterator_t<decltype(p)>;
+
+        auto result = hpx::parallel::detail::for_each<iterator_type>().call(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(p.rng),
+            hpx::util::end(p.rng),
+            [pred = HPX_MOVE(p.pred), conv = HPX_MOVE(p.conv), f = HPX_MOVE(f),
+                proj = HPX_MOVE(proj)](auto&& x) mutable {
+                if (HPX_INVOKE(pred, x))
+                {
+                    HPX_INVOKE(f, HPX_INVOKE(proj, HPX_INVOKE(conv, x)));
+                }
+            },
+            hpx::identity{});
+
+        return hpx::parallel::util::detail::convert_to_result(HPX_MOVE(result),
+            [last = hpx::util::end(rng)](auto&&) { return last; });
+    }
+    /// \endcond
+}    // namespace hpx::ranges::views
@@ -0,0 +1,341 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_compress.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/compress.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The predicate is applied to vector packs only if it yields a mask of
+    // the vector pack type, all other predicates are applied to each element
+    // separately.
+    template <typename V, typename Enable, typename F, typename... Ts>
+    struct is_vector_pack_predicate_impl : std::false_type
+    {
+    };
+
+    template <typename V, typename F, typename... Ts>
+    struct is_vector_pack_predicate_impl<V,
+        std::void_t<decltype(HPX_INVOKE(
+            std::declval<F&>(), std::declval<Ts>()...))>,
+        F, Ts...>
+      : std::is_same<traits::vector_pack_mask_type_t<V>,
+            std::decay_t<decltype(HPX_INVOKE(
+                std::declval<F&>(), std::declval<Ts>()...))>>
+    {
+    };
+
+    template <typename Iter>
+    using iterator_vector_pack_t = traits::vector_pack_type_t<
+        typename std::iterator_traits<Iter>::value_type>;
+
+    template <typename Iter, typename Proj>
+    using projected_vector_pack_t = decltype(HPX_INVOKE(
+        std::declval<Proj&>(), std::declval<iterator_vector_pack_t<Iter>&>()));
+
+    template <typename Iter, typename Pred, typename Proj, std::size_t Arity,
+        typename Enable = void>
+    struct is_projected_vector_pack_predicate : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct is_projected_vector_pack_predicate<Iter, Pred, Proj, 1,
+        std::void_t<projected_vector_pack_t<Iter, Proj>>>
+      : is_vector_pack_predicate_impl<iterator_vector_pack_t<Iter>, void, Pred,
+            projected_vector_pack_t<Iter, Proj>>
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct is_projected_vector_pack_predicate<Iter, Pred, Proj, 2,
+        std::void_t<projected_vector_pack_t<Iter, Proj>>>
+      : is_vector_pack_predicate_impl<iterator_vector_pack_t<Iter>, void, Pred,
+            projected_vector_pack_t<Iter, Proj>,
+            projected_vector_pack_t<Iter, Proj>>
+    {
+    };
+
+    // the vector pack type is determined for datapar compatible iterators
+    // only
+    template <typename Iter, typename Pred, typename Proj, std::size_t Arity>
+    struct is_vector_pack_predicate
+      : std::conjunction<util::detail::iterator_datapar_compatible<Iter>,
+            is_projected_vector_pack_predicate<Iter, Pred, Proj, Arity>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All kernels below handle the elements up to the first properly aligned
+    // element and the remaining elements after the last full vector pack
+    // one by one.
+    template <typename Iter>
+    struct datapar_compress
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        template <typename Pred, typename Proj>
+        static std::size_t flags(Iter first, bool* flags, std::size_t count,
+            Pred& pred, Proj& proj)
+        {
+            std::size_t curr = 0;
+            std::size_t i = 0;
+
+            for (/**/; i != count && !util::detail::is_data_aligned(first);
+                 ++i, ++first)
+            {
+                if ((flags[i] = HPX_INVOKE(pred, HPX_INVOKE(proj, *first))))
+                    ++curr;
+            }
+
+            for (/**/; i + size <= count; i += size, std::advance(first, size))
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(first));
+                auto const msk = HPX_INVOKE(pred, HPX_INVOKE(proj, tmp));
+
+                traits::store_mask<V>(msk, flags + i);
+                curr += traits::count_bits(msk);
+            }
+
+            for (/**/; i != count; ++i, ++first)
+            {
+                if ((flags[i] = HPX_INVOKE(pred, HPX_INVOKE(proj, *first))))
+                    ++curr;
+            }
+            return curr;
+        }
+
+        // first[-1] is the predecessor of the first element of the partition
+        template <typename Pred, typename Proj>
+        static std::size_t unique_flags(Iter first, bool* flags,
+            std::size_t count, Pred& pred, Proj& proj)
+        {
+            std::size_t curr = 0;
+            std::size_t i = 0;
+
+            for (/**/; i != count && !util::detail::is_data_aligned(first);
+                 ++i, ++first)
+            {
+                if ((flags[i] = !HPX_INVOKE(pred,
+                         HPX_INVOKE(proj, *std::prev(first)),
+                         HPX_INVOKE(proj, *first))))
+                {
+                    ++curr;
+                }
+            }
+
+            for (/**/; i + size <= count; i += size, std::advance(first, size))
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(first));
+
+                // there are no unaligned loads for all vector pack types,
+                // gather the predecessors from the (cached) source instead
+                V prev(tmp);
+                Iter it = std::prev(first);
+                for (std::size_t j = 0; j != size; ++j, ++it)
+                {
+                    traits::set(prev, j, *it);
+                }
+
+                auto const msk = !HPX_INVOKE(
+                    pred, HPX_INVOKE(proj, prev), HPX_INVOKE(proj, tmp));
+
+                traits::store_mask<V>(msk, flags + i);
+                curr += traits::count_bits(msk);
+            }
+
+            for (/**/; i != count; ++i, ++first)
+            {
+                if ((flags[i] = !HPX_INVOKE(pred,
+                         HPX_INVOKE(proj, *std::prev(first)),
+                         HPX_INVOKE(proj, *first))))
+                {
+                    ++curr;
+                }
+            }
+            return curr;
+        }
+
+        template <typename OutIter>
+        static OutIter compress(
+            Iter first, bool const* flags, std::size_t count, OutIter dest)
+        {
+            std::size_t i = 0;
+
+            for (/**/; i != count && !util::detail::is_data_aligned(first);
+                 ++i, ++first)
+            {
+                dest = traits::compress_store(*first, flags[i], dest);
+            }
+
+            for (/**/; i + size <= count; i += size, std::advance(first, size))
+            {
+                dest = traits::compress_store(
+                    traits::vector_pack_load<V, value_type>::aligned(first),
+                    flags + i, dest);
+            }
+
+            for (/**/; i != count; ++i, ++first)
+            {
+                dest = traits::compress_store(*first, flags[i], dest);
+            }
+            return dest;
+        }
+
+        template <typename OutIter1, typename OutIter2>
+        static std::pair<OutIter1, OutIter2> partition_compress(Iter first,
+            bool const* flags, std::size_t count, OutIter1 dest_true,
+            OutIter2 dest_false)
+        {
+            std::size_t i = 0;
+
+            for (/**/; i != count && !util::detail::is_data_aligned(first);
+                 ++i, ++first)
+            {
+                dest_true = traits::compress_store(*first, flags[i], dest_true);
+                dest_false = traits::compress_store(
+                    *first, flags[i], dest_false, false);
+            }
+
+            for (/**/; i + size <= count; i += size, std::advance(first, size))
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(first));
+
+                dest_true = traits::compress_store(tmp, flags + i, dest_true);
+                dest_false =
+                    traits::compress_store(tmp, flags + i, dest_false, false);
+            }
+
+            for (/**/; i != count; ++i, ++first)
+            {
+                dest_true = traits::compress_store(*first, flags[i], dest_true);
+                dest_false = traits::compress_store(
+                    *first, flags[i], dest_false, false);
+            }
+            return {HPX_MOVE(dest_true), HPX_MOVE(dest_false)};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t tag_invoke(
+        sequential_compress_flags_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter, bool*> part_begin, std::size_t part_size,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (is_vector_pack_predicate<Iter, Pred, Proj, 1>::value)
+        {
+            auto iters = part_begin.get_iterator_tuple();
+            return datapar_compress<Iter>::flags(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_size, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                std::decay_t<decltype(hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>()))>;
+            return sequential_compress_flags<base_policy_type>(part_begin,
+                part_size, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t tag_invoke(
+        sequential_unique_flags_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter, bool*> part_begin, std::size_t part_size,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (is_vector_pack_predicate<Iter, Pred, Proj, 2>::value)
+        {
+            auto iters = (++part_begin).get_iterator_tuple();
+            return datapar_compress<Iter>::unique_flags(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_size, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                std::decay_t<decltype(hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>()))>;
+            return sequential_unique_flags<base_policy_type>(part_begin,
+                part_size, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename OutIter,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE OutIter tag_invoke(
+        sequential_compress_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter, bool*> part_begin, std::size_t part_size,
+        OutIter dest)
+    {
+        if constexpr (util::detail::iterator_datapar_compatible_v<Iter>)
+        {
+            auto iters = part_begin.get_iterator_tuple();
+            return datapar_compress<Iter>::compress(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_size, dest);
+        }
+        else
+        {
+            using base_policy_type =
+                std::decay_t<decltype(hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>()))>;
+            return sequential_compress<base_policy_type>(
+                part_begin, part_size, dest);
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename OutIter1,
+        typename OutIter2,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<OutIter1, OutIter2> tag_invoke(
+        sequential_partition_compress_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter, bool*> part_begin, std::size_t part_size,
+        OutIter1 dest_true, OutIter2 dest_false)
+    {
+        if constexpr (util::detail::iterator_datapar_compatible_v<Iter>)
+        {
+            auto iters = part_begin.get_iterator_tuple();
+            return datapar_compress<Iter>::partition_compress(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_size, dest_true,
+                dest_false);
+        }
+        else
+        {
+            using base_policy_type =
+                std::decay_t<decltype(hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>()))>;
+            return sequential_partition_compress<base_policy_type>(
+                part_begin, part_size, dest_true, dest_false);
+        }
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
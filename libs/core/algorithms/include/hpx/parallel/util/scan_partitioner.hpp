@@ -12,8 +12,12 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/execution.hpp>
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -25,7 +29,9 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <list>
 #include <type_traits>
@@ -202,6 +208,284 @@ namespace hpx::parallel::util {
             }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // The single-pass partitioner divides the input into small chunks
+        // which are handed out in order to one task per core. Each task runs
+        // both steps of the scan for a chunk while the data is still in the
+        // cache. The prefix of a chunk is determined by looking back at the
+        // results published by the preceding chunks (decoupled look-back):
+        // every chunk publishes the result of the first step as soon as it
+        // is known and its inclusive prefix once that has been computed.
+        enum class scan_chunk_status : std::uint8_t
+        {
+            invalid,      // nothing has been published yet
+            aggregate,    // the result of the first step is available
+            prefix,       // the inclusive prefix is available
+            failed        // an exception was thrown for this chunk
+        };
+
+        template <typename T>
+        struct scan_chunk_state
+        {
+            std::atomic<scan_chunk_status> status{scan_chunk_status::invalid};
+            T aggregate{};
+            T prefix{};
+        };
+
+        template <typename ExPolicy, typename R, typename Result1,
+            typename Result2>
+        struct scan_single_pass_partitioner
+        {
+            static_assert(std::is_void_v<Result2>,
+                "the single-pass scan requires the third step to return "
+                "void");
+
+            using parameters_type = typename ExPolicy::executor_parameters_type;
+            using executor_type = typename ExPolicy::executor_type;
+
+            using scoped_executor_parameters =
+                detail::scoped_executor_parameters_ref<parameters_type,
+                    executor_type>;
+
+            using handle_local_exceptions =
+                detail::handle_local_exceptions<ExPolicy>;
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call([[maybe_unused]] ExPolicy_ policy,
+                [[maybe_unused]] FwdIter first,
+                [[maybe_unused]] std::size_t count, [[maybe_unused]] T&& init,
+                [[maybe_unused]] F1&& f1, [[maybe_unused]] F2&& f2,
+                [[maybe_unused]] F3&& f3, [[maybe_unused]] F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                HPX_ASSERT(count > 0);
+
+                std::size_t const cores =
+                    execution::processing_units_count(policy.parameters(),
+                        policy.executor(), hpx::chrono::null_duration, count);
+
+                std::size_t chunk_size = execution::get_chunk_size(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, cores, count);
+                if (chunk_size == 0)
+                {
+                    chunk_size = 1;
+                }
+
+                std::size_t const num_chunks =
+                    (count + chunk_size - 1) / chunk_size;
+
+                // the chunks are handed out dynamically, determine where
+                // each of them starts
+                std::vector<FwdIter> chunks;
+                chunks.reserve(num_chunks);
+                for (std::size_t i = 0; i != num_chunks; ++i)
+                {
+                    chunks.push_back(first);
+                    if (i + 1 != num_chunks)
+                    {
+                        first = parallel::detail::next(first, chunk_size);
+                    }
+                }
+
+                Result1 const initial(HPX_FORWARD(T, init));
+                std::vector<scan_chunk_state<Result1>> states(num_chunks);
+                std::atomic<std::size_t> next_chunk(0);
+                std::atomic<bool> cancelled(false);
+
+                // wait for the given chunk to publish a result
+                auto wait_for = [](scan_chunk_state<Result1>& state) {
+                    scan_chunk_status status =
+                        state.status.load(std::memory_order_acquire);
+                    if (status == scan_chunk_status::invalid)
+                    {
+                        hpx::util::yield_while(
+                            [&]() {
+                                status = state.status.load(
+                                    std::memory_order_acquire);
+                                return status == scan_chunk_status::invalid;
+                            },
+                            "scan_single_pass_partitioner::call");
+                    }
+                    return status;
+                };
+
+                // run both steps of the scan for the given chunk, return
+                // false if the scan was abandoned
+                auto process = [&](std::size_t chunk) -> bool {
+                    scan_chunk_state<Result1>& state = states[chunk];
+                    std::size_t const size =
+                        (std::min)(chunk_size, count - chunk * chunk_size);
+
+                    // the first and third steps may modify their state, each
+                    // chunk uses its own copy (as if it was run as a separate
+                    // task)
+                    std::decay_t<F1> part_f1 = f1;
+                    std::decay_t<F3> part_f3 = f3;
+
+                    try
+                    {
+                        state.aggregate =
+                            HPX_INVOKE(part_f1, chunks[chunk], size);
+
+                        if (chunk == 0)
+                        {
+                            state.prefix =
+                                HPX_INVOKE(f2, initial, state.aggregate);
+                            state.status.store(scan_chunk_status::prefix,
+                                std::memory_order_release);
+
+                            HPX_INVOKE(part_f3, chunks[chunk], size, initial);
+                            return true;
+                        }
+
+                        state.status.store(scan_chunk_status::aggregate,
+                            std::memory_order_release);
+
+                        // combine the results of the preceding chunks until
+                        // one of them has published its inclusive prefix,
+                        // the first chunk always publishes its prefix
+                        std::size_t pred = chunk - 1;
+                        scan_chunk_status status = wait_for(states[pred]);
+                        if (status == scan_chunk_status::failed)
+                        {
+                            state.status.store(scan_chunk_status::failed,
+                                std::memory_order_release);
+                            return false;
+                        }
+
+                        Result1 prefix = status == scan_chunk_status::prefix ?
+                            states[pred].prefix :
+                            states[pred].aggregate;
+
+                        while (status != scan_chunk_status::prefix)
+                        {
+                            HPX_ASSERT(pred != 0);
+                            status = wait_for(states[--pred]);
+                            if (status == scan_chunk_status::failed)
+                            {
+                                state.status.store(scan_chunk_status::failed,
+                                    std::memory_order_release);
+                                return false;
+                            }
+
+                            prefix = HPX_INVOKE(f2,
+                                status == scan_chunk_status::prefix ?
+                                    states[pred].prefix :
+                                    states[pred].aggregate,
+                                prefix);
+                        }
+
+                        state.prefix = HPX_INVOKE(f2, prefix, state.aggregate);
+                        state.status.store(scan_chunk_status::prefix,
+                            std::memory_order_release);
+
+                        HPX_INVOKE(
+                            part_f3, chunks[chunk], size, HPX_MOVE(prefix));
+                    }
+                    catch (...)
+                    {
+                        // make sure no other chunk waits for this one
+                        if (state.status.load(std::memory_order_relaxed) !=
+                            scan_chunk_status::prefix)
+                        {
+                            state.status.store(scan_chunk_status::failed,
+                                std::memory_order_release);
+                        }
+                        cancelled.store(true, std::memory_order_relaxed);
+                        throw;
+                    }
+                    return true;
+                };
+
+                // each task processes chunks in order until all of them are
+                // done, this guarantees that the chunks a task is waiting
+                // for are being worked on
+                auto worker = [&]() {
+                    while (!cancelled.load(std::memory_order_relaxed))
+                    {
+                        std::size_t const chunk = next_chunk++;
+                        if (chunk >= num_chunks || !process(chunk))
+                        {
+                            break;
+                        }
+                    }
+                };
+
+                std::vector<hpx::future<Result2>> finalitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    std::size_t const num_tasks =
+                        (std::min)(cores, num_chunks);
+
+                    finalitems.reserve(num_tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                    {
+                        finalitems.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    cancelled.store(true, std::memory_order_relaxed);
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish
+                if (hpx::wait_all_nothrow(finalitems) || !errors.empty())
+                {
+                    // always rethrow if 'errors' is not empty or 'finalitems'
+                    // have an exceptional future
+                    handle_local_exceptions::call(finalitems, errors);
+                }
+
+                std::vector<Result1> f2results;
+                f2results.reserve(num_chunks + 1);
+                f2results.push_back(initial);
+                for (auto& state : states)
+                {
+                    f2results.push_back(HPX_MOVE(state.prefix));
+                }
+
+                try
+                {
+                    return f4(HPX_MOVE(f2results), HPX_MOVE(finalitems));
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_local_exceptions::call(std::current_exception());
+                }
+
+                HPX_UNREACHABLE;    //-V779
+#endif
+            }
+        };
+
+        // select the single-pass partitioner if the executor parameters ask
+        // for it
+        template <typename ExPolicy, typename R, typename Result1,
+            typename Result2>
+        struct select_scan_partitioner
+          : std::conditional_t<execution::extract_uses_single_pass_scan_v<
+                                   typename ExPolicy::executor_parameters_type>,
+                scan_single_pass_partitioner<ExPolicy, R, Result1, Result2>,
+                scan_static_partitioner<ExPolicy, R, Result1, Result2>>
+        {
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename R, typename Result1,
             typename Result2>
@@ -218,7 +502,7 @@ namespace hpx::parallel::util {
                         f2 = HPX_FORWARD(F2, f2), f3 = HPX_FORWARD(F3, f3),
                         f4 = HPX_FORWARD(F4, f4)]() mutable -> R {
                         using partitioner_type =
-                            scan_static_partitioner<ExPolicy, R, Result1,
+                            select_scan_partitioner<ExPolicy, R, Result1,
                                 Result2>;
                         return partitioner_type::call(
                             HPX_FORWARD(ExPolicy_, policy), first, count,
@@ -237,7 +521,7 @@ namespace hpx::parallel::util {
         typename Result2 = void>
     struct scan_partitioner
       : detail::select_partitioner<std::decay_t<ExPolicy>,
-            detail::scan_static_partitioner,
+            detail::select_scan_partitioner,
             detail::scan_task_static_partitioner>::template apply<R, Result1,
             Result2>
     {
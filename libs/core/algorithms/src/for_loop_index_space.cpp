@@ -0,0 +1,55 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/parallel/algorithms/for_loop_index_space.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace hpx::experimental::detail {
+
+    namespace {
+
+        // used if the cache size can't be determined
+        constexpr std::size_t default_l2_cache_size = 256 * 1024;
+
+        // assume every index point touches four double precision values,
+        // e.g. the center points of the input and output arrays of a stencil
+        // and their neighbors in the preceding dimensions
+        constexpr std::size_t bytes_per_point = 4 * sizeof(double);
+
+        constexpr std::size_t min_tile_points = 1024;
+    }    // namespace
+
+    std::size_t get_default_tile_points() noexcept
+    {
+        static std::size_t const tile_points = []() -> std::size_t {
+            std::size_t cache_size = 0;
+            try
+            {
+                auto const& topo = hpx::threads::create_topology();
+
+                hpx::threads::mask_type mask(
+                    hpx::threads::hardware_concurrency());
+                hpx::threads::set(mask, 0);
+
+                cache_size = topo.get_cache_size(mask, 2);
+            }
+            catch (...)
+            {
+                // use the default below
+            }
+
+            if (cache_size == 0)
+                cache_size = default_l2_cache_size;
+
+            return (std::max)(cache_size / bytes_per_point, min_tile_points);
+        }();
+        return tile_points;
+    }
+}    // namespace hpx::experimental::detail
@@ -0,0 +1,160 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare a transform | filter | reduce pipeline run as a single parallel pass
+// over lazy views with the same computation run as three parallel algorithms
+// materializing the intermediate results.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace views = hpx::ranges::views;
+
+///////////////////////////////////////////////////////////////////////////////
+struct transformation
+{
+    double operator()(std::uint32_t x) const noexcept
+    {
+        return 0.5 * x + 1.0;
+    }
+};
+
+struct selection
+{
+    bool operator()(double x) const noexcept
+    {
+        return static_cast<std::uint64_t>(x) % 4 != 0;
+    }
+};
+
+double run_fused(std::vector<std::uint32_t> const& data)
+{
+    return hpx::ranges::reduce(hpx::execution::par,
+        data | views::transform(transformation()) |
+            views::filter(selection()),
+        0.0, std::plus<>());
+}
+
+double run_unfused(std::vector<std::uint32_t> const& data,
+    std::vector<double>& transformed, std::vector<double>& selected)
+{
+    hpx::ranges::transform(
+        hpx::execution::par, data, transformed.begin(), transformation());
+
+    auto const copied = hpx::ranges::copy_if(
+        hpx::execution::par, transformed, selected.begin(), selection());
+
+    return hpx::reduce(hpx::execution::par, selected.begin(), copied.out, 0.0,
+        std::plus<>());
+}
+
+// return the average time of one invocation in seconds
+template <typename F>
+double measure(F&& f, int iterations, double& result)
+{
+    // warm up
+    result = f();
+
+    auto const t = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i != iterations; ++i)
+    {
+        result = f();
+    }
+    std::chrono::duration<double> const time_span =
+        std::chrono::high_resolution_clock::now() - t;
+
+    return time_span.count() / iterations;
+}
+
+// effective bandwidth: the fused pipeline reads the input only once
+double bandwidth(std::size_t size, double time)
+{
+    return static_cast<double>(size * sizeof(std::uint32_t)) / time * 1e-9;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const start = vm["start"].as<std::size_t>();
+    std::size_t const till = vm["till"].as<std::size_t>();
+    int const iterations = vm["iterations"].as<int>();
+
+    std::mt19937 gen(vm["seed"].as<unsigned int>());
+
+    for (std::size_t size = start; size <= till; size *= 2)
+    {
+        std::vector<std::uint32_t> data(size);
+        std::generate(data.begin(), data.end(), [&]() { return gen() % 1024; });
+
+        std::vector<double> transformed(size);
+        std::vector<double> selected(size);
+
+        double fused_result = 0.0;
+        double unfused_result = 0.0;
+
+        double const fused_time = measure(
+            [&]() { return run_fused(data); }, iterations, fused_result);
+        double const unfused_time = measure(
+            [&]() { return run_unfused(data, transformed, selected); },
+            iterations, unfused_result);
+
+        HPX_TEST_EQ(fused_result, unfused_result);
+
+        std::cout << "N : " << size << '\n';
+        std::cout << "fused:   " << fused_time << " ("
+                  << bandwidth(size, fused_time) << " GB/s)\n";
+        std::cout << "unfused: " << unfused_time << " ("
+                  << bandwidth(size, unfused_time) << " GB/s)\n\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("start", value<std::size_t>()->default_value(1 << 16),
+         "smallest number of elements to measure")
+        ("till", value<std::size_t>()->default_value(1 << 22),
+         "largest number of elements to measure")
+        ("iterations", value<int>()->default_value(5),
+         "number of iterations to average")
+        ("seed", value<unsigned int>()->default_value(42),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    // Initialize and run HPX.
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
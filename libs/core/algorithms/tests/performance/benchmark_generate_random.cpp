@@ -0,0 +1,173 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of hpx::experimental::generate_random and use it for
+// a Monte Carlo estimate of pi. The sequential generation using std::mt19937
+// is reported for comparison.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// return the average time of one invocation in seconds
+template <typename F>
+double measure(F&& f, int iterations)
+{
+    // warm up
+    f();
+
+    auto const t = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double> const time_span =
+        std::chrono::high_resolution_clock::now() - t;
+
+    return time_span.count() / iterations;
+}
+
+void report(char const* name, std::size_t size, double time)
+{
+    std::cout << name << time << " (" << static_cast<double>(size) / time * 1e-9
+              << " G values/s)\n";
+}
+
+// estimate pi from the fraction of the points in the unit square that lie
+// inside of the quarter circle
+template <typename ExPolicy>
+double estimate_pi(ExPolicy&& policy, std::vector<double>& x,
+    std::vector<double>& y, std::uint64_t seed)
+{
+    ex::uniform_real_distribution<double> const dist;
+
+    // the coordinates are taken from two independent streams
+    ex::generate_random(policy, x.begin(), x.end(), dist, ex::philox4x32(seed));
+    ex::generate_random(
+        policy, y.begin(), y.end(), dist, ex::philox4x32(seed, 1));
+
+    std::size_t const inside = hpx::transform_reduce(policy, x.begin(),
+        x.end(), y.begin(), std::size_t(0), std::plus<>(),
+        [](double a, double b) -> std::size_t { return a * a + b * b < 1.0; });
+
+    return 4.0 * static_cast<double>(inside) / static_cast<double>(x.size());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    using namespace hpx::execution;
+
+    std::size_t const start = vm["start"].as<std::size_t>();
+    std::size_t const till = vm["till"].as<std::size_t>();
+    int const iterations = vm["iterations"].as<int>();
+    auto const seed = vm["seed"].as<std::uint64_t>();
+
+    for (std::size_t size = start; size <= till; size *= 2)
+    {
+        std::vector<double> data(size);
+
+        std::cout << "N : " << size << '\n';
+
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> std_dist;
+        auto mt19937_seq = [&]() {
+            std::generate(
+                data.begin(), data.end(), [&]() { return std_dist(gen); });
+        };
+        report("mt19937 (seq):       ", size, measure(mt19937_seq, iterations));
+
+        ex::uniform_real_distribution<double> const uniform;
+        auto uniform_seq = [&]() {
+            ex::generate_random(seq, data.begin(), data.end(), uniform, seed);
+        };
+        auto uniform_par = [&]() {
+            ex::generate_random(par, data.begin(), data.end(), uniform, seed);
+        };
+        auto uniform_par_unseq = [&]() {
+            ex::generate_random(
+                par_unseq, data.begin(), data.end(), uniform, seed);
+        };
+        report("uniform (seq):       ", size, measure(uniform_seq, iterations));
+        report("uniform (par):       ", size, measure(uniform_par, iterations));
+        report("uniform (par_unseq): ", size,
+            measure(uniform_par_unseq, iterations));
+
+        ex::normal_distribution<double> const normal;
+        auto normal_par = [&]() {
+            ex::generate_random(par, data.begin(), data.end(), normal, seed);
+        };
+        report("normal (par):        ", size, measure(normal_par, iterations));
+
+        // Monte Carlo estimate of pi, the result is the same for all
+        // policies
+        std::vector<double> y(size);
+        double pi_seq = 0.0;
+        double pi_par = 0.0;
+
+        double const seq_time = measure(
+            [&]() { pi_seq = estimate_pi(seq, data, y, seed); }, iterations);
+        double const par_time = measure(
+            [&]() { pi_par = estimate_pi(par, data, y, seed); }, iterations);
+
+        HPX_TEST_EQ(pi_seq, pi_par);
+
+        std::cout << "pi (seq):            " << seq_time << '\n';
+        std::cout << "pi (par):            " << par_time << '\n';
+        std::cout << "pi estimate:         " << pi_par << " (error "
+                  << std::abs(pi_par - 3.14159265358979323846) << ")\n\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("start", value<std::size_t>()->default_value(1 << 16),
+         "smallest number of elements to measure")
+        ("till", value<std::size_t>()->default_value(1 << 24),
+         "largest number of elements to measure")
+        ("iterations", value<int>()->default_value(5),
+         "number of iterations to average")
+        ("seed", value<std::uint64_t>()->default_value(42),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    // Initialize and run HPX.
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -8,6 +8,9 @@
 
 #include <hpx/algorithm.hpp>
 #include <hpx/chrono.hpp>
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/datapar.hpp>
+#endif
 #include <hpx/format.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
@@ -20,6 +23,7 @@
 #include <iostream>
 #include <random>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "utils.hpp"
@@ -172,6 +176,23 @@ void run_benchmark(std::size_t vector_size, int test_count,
     double time_par_unseq = run_remove_if_benchmark_hpx(
         test_count, par_unseq, org_first, org_last, first, last, pred);
 
+#if defined(HPX_HAVE_DATAPAR)
+    // the predicate has to be applicable to vector packs for the
+    // predicate evaluation to be vectorized
+    double time_par_simd = 0.0;
+    if constexpr (std::is_arithmetic_v<DataType>)
+    {
+        auto simd_pred = [value](auto const& a) {
+            using value_type = std::decay_t<decltype(a)>;
+            return a == value_type(value);
+        };
+
+        std::cout << "--- run_remove_if_benchmark_par_simd ---" << std::endl;
+        time_par_simd = run_remove_if_benchmark_hpx(
+            test_count, par_simd, org_first, org_last, first, last, simd_pred);
+    }
+#endif
+
     std::cout << "\n-------------- Benchmark Result --------------"
               << std::endl;
     auto fmt = "remove_if ({1}) : {2}(sec)";
@@ -180,6 +201,16 @@ void run_benchmark(std::size_t vector_size, int test_count,
     hpx::util::format_to(std::cout, fmt, "par", time_par) << std::endl;
     hpx::util::format_to(std::cout, fmt, "par_unseq", time_par_unseq)
         << std::endl;
+#if defined(HPX_HAVE_DATAPAR)
+    if constexpr (std::is_arithmetic_v<DataType>)
+    {
+        hpx::util::format_to(std::cout, fmt, "par_simd", time_par_simd)
+            << std::endl;
+        hpx::util::format_to(std::cout, "speedup (par/par_simd) : {1}",
+            time_par / time_par_simd)
+            << std::endl;
+    }
+#endif
     std::cout << "----------------------------------------------" << std::endl;
 }
 
@@ -5,17 +5,20 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/numeric.hpp>
 #include <hpx/program_options.hpp>
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -31,7 +34,71 @@ enum class ALGORITHM
     UNIQUE_COPY
 };
 
-void measureScanAlgorithms()
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void runScanAlgorithm(ExPolicy&& policy, ALGORITHM alg,
+    std::vector<int> const& arr, std::vector<int>& res)
+{
+    switch (alg)
+    {
+    case ALGORITHM::INCLUSIVE_SCAN:
+        hpx::inclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), std::plus<int>(), 0);
+        break;
+    case ALGORITHM::EXCLUSIVE_SCAN:
+        hpx::exclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), 10, std::plus<int>{});
+        break;
+    case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
+        hpx::transform_exclusive_scan(policy, arr.begin(), arr.end(),
+            res.begin(), 10, std::plus<int>{}, [](int x) { return x * 10; });
+        break;
+    case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
+        hpx::transform_inclusive_scan(
+            policy, arr.begin(), arr.end(), res.begin(), std::plus<int>{},
+            [](int x) { return x * 10; }, 10);
+        break;
+    case ALGORITHM::COPY_IF:
+        hpx::copy_if(policy, arr.begin(), arr.end(), res.begin(),
+            [](int x) { return (x % 2) != 0; });
+        break;
+    case ALGORITHM::UNIQUE_COPY:
+        hpx::unique_copy(policy, arr.begin(), arr.end(), res.begin(),
+            std::equal_to<int>{});
+        break;
+    };
+}
+
+// return the average time of one invocation of the algorithm in seconds
+template <typename ExPolicy>
+double measureScanAlgorithm(ExPolicy&& policy, ALGORITHM alg,
+    std::vector<int> const& arr, int iterations)
+{
+    std::vector<int> res(arr.size());
+
+    // warm up
+    runScanAlgorithm(policy, alg, arr, res);
+
+    auto t = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        runScanAlgorithm(policy, alg, arr, res);
+    }
+    std::chrono::duration<double> time_span =
+        std::chrono::high_resolution_clock::now() - t;
+
+    return time_span.count() / iterations;
+}
+
+// the algorithms read the input and write (at most) the same amount of
+// output data
+double bandwidth(std::size_t size, double time)
+{
+    return static_cast<double>(2 * size * sizeof(int)) / time * 1e-9;
+}
+
+void measureScanAlgorithms(std::size_t start, std::size_t till,
+    int iterations, std::size_t chunk_size)
 {
 #if defined(OUTPUT_TO_CSV)
     std::map<ALGORITHM, std::string> filenames = {
@@ -46,131 +113,39 @@ void measureScanAlgorithms()
     };
 #endif
 
+    // the single-pass scan processes chunks of the input while they are in
+    // the cache, reading the input data only once
+    auto const single_pass = hpx::execution::par.with(
+        hpx::execution::experimental::single_pass_scan(chunk_size));
+
     for (int alg = (int) ALGORITHM::EXCLUSIVE_SCAN;
          alg <= (int) ALGORITHM::UNIQUE_COPY; alg++)
     {
-        std::size_t start = 32;
-        std::size_t till = 1 << 10;
-
-        const auto NUM_ITERATIONS = 5;
-
-        std::vector<std::array<double, 3>> data;
+        std::vector<std::array<double, 4>> data;
 
         for (std::size_t s = start; s <= till; s *= 2)
         {
             std::vector<int> arr(s);
             std::iota(std::begin(arr), std::end(arr), 1);
 
-            double seqTime = 0;
-            double parTime = 0;
-
-            for (int i = 0; i < NUM_ITERATIONS + 5; i++)
-            {
-                std::vector<int> res(s);
-                auto t1 = std::chrono::high_resolution_clock::now();
-
-                switch ((ALGORITHM) alg)
-                {
-                case ALGORITHM::INCLUSIVE_SCAN:
-                    hpx::inclusive_scan(arr.begin(), arr.end(), res.begin(),
-                        std::plus<int>(), 0);
-                    break;
-                case ALGORITHM::EXCLUSIVE_SCAN:
-                    hpx::exclusive_scan(arr.begin(), arr.end(), res.begin(), 10,
-                        std::plus<int>{});
-                    break;
-                case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
-                    hpx::transform_exclusive_scan(arr.begin(), arr.end(),
-                        res.begin(), 10, std::plus<int>{},
-                        [](int x) { return x * 10; });
-                    break;
-                case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
-                    hpx::transform_inclusive_scan(
-                        arr.begin(), arr.end(), res.begin(), std::plus<int>{},
-                        [](int x) { return x * 10; }, 10);
-                    break;
-                case ALGORITHM::COPY_IF:
-                    hpx::copy_if(arr.begin(), arr.end(), res.begin(),
-                        [](int x) { return (x % 2) != 0; });
-                    break;
-                case ALGORITHM::UNIQUE_COPY:
-                    hpx::unique_copy(arr.begin(), arr.end(), res.begin(),
-                        std::equal_to<int>{});
-                    break;
-                };
-                auto end1 = std::chrono::high_resolution_clock::now();
-
-                // don't consider first 5 iterations
-                if (NUM_ITERATIONS < 5)
-                {
-                    continue;
-                }
-
-                std::chrono::duration<double> time_span1 =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        end1 - t1);
-
-                seqTime += time_span1.count();
-            }
-
-            for (int i = 0; i < NUM_ITERATIONS + 5; i++)
-            {
-                std::vector<int> res1(s);
-                auto t2 = std::chrono::high_resolution_clock::now();
-                switch ((ALGORITHM) alg)
-                {
-                case ALGORITHM::INCLUSIVE_SCAN:
-                    hpx::inclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::plus<int>(), 0);
-                    break;
-                case ALGORITHM::EXCLUSIVE_SCAN:
-                    hpx::exclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), 10, std::plus<int>{});
-                    break;
-                case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
-                    hpx::transform_exclusive_scan(hpx::execution::par,
-                        arr.begin(), arr.end(), res1.begin(), 10,
-                        std::plus<int>{}, [](int x) { return x * 10; });
-                    break;
-                case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
-                    hpx::transform_inclusive_scan(
-                        hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), std::plus<int>{},
-                        [](int x) { return x * 10; }, 10);
-                    break;
-                case ALGORITHM::COPY_IF:
-                    hpx::copy_if(hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), [](int x) { return (x % 2) != 0; });
-                    break;
-                case ALGORITHM::UNIQUE_COPY:
-                    hpx::unique_copy(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::equal_to<int>{});
-                    break;
-                };
-                auto end2 = std::chrono::high_resolution_clock::now();
-
-                // don't consider first 5 iterations
-                if (NUM_ITERATIONS < 5)
-                {
-                    continue;
-                }
-
-                std::chrono::duration<double> time_span2 =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        end2 - t2);
-
-                parTime += time_span2.count();
-            }
-
-            seqTime /= NUM_ITERATIONS;
-            parTime /= NUM_ITERATIONS;
+            double seqTime = measureScanAlgorithm(
+                hpx::execution::seq, (ALGORITHM) alg, arr, iterations);
+            double parTime = measureScanAlgorithm(
+                hpx::execution::par, (ALGORITHM) alg, arr, iterations);
+            double singlePassTime = measureScanAlgorithm(
+                single_pass, (ALGORITHM) alg, arr, iterations);
 
 #if defined(OUTPUT_TO_CSV)
-            data.push_back(std::array<double, 3>{(double) s, seqTime, parTime});
+            data.push_back(std::array<double, 4>{
+                (double) s, seqTime, parTime, singlePassTime});
 #else
             std::cout << "N : " << s << '\n';
-            std::cout << "SEQ: " << seqTime << '\n';
-            std::cout << "PAR: " << parTime << "\n\n";
+            std::cout << "SEQ: " << seqTime << " (" << bandwidth(s, seqTime)
+                      << " GB/s)\n";
+            std::cout << "PAR: " << parTime << " (" << bandwidth(s, parTime)
+                      << " GB/s)\n";
+            std::cout << "PAR (single-pass): " << singlePassTime << " ("
+                      << bandwidth(s, singlePassTime) << " GB/s)\n\n";
 #endif
         }
 
@@ -178,25 +153,48 @@ void measureScanAlgorithms()
         std::ofstream outputFile(filenames[(ALGORITHM) alg]);
         for (auto& d : data)
         {
-            outputFile << d[0] << "," << d[1] << "," << d[2] << ","
-                       << ",\n";
+            outputFile << d[0] << "," << d[1] << "," << d[2] << "," << d[3]
+                       << "," << bandwidth((std::size_t) d[0], d[1]) << ","
+                       << bandwidth((std::size_t) d[0], d[2]) << ","
+                       << bandwidth((std::size_t) d[0], d[3]) << ",\n";
         }
 #endif
     }
 }
 
-int hpx_main(hpx::program_options::variables_map&)
+int hpx_main(hpx::program_options::variables_map& vm)
 {
-    measureScanAlgorithms();
+    measureScanAlgorithms(vm["start"].as<std::size_t>(),
+        vm["till"].as<std::size_t>(), vm["iterations"].as<int>(),
+        vm["chunk_size"].as<std::size_t>());
 
     return hpx::local::finalize();
 }
 
 int main(int argc, char* argv[])
 {
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("start", value<std::size_t>()->default_value(32),
+         "smallest number of elements to measure")
+        ("till", value<std::size_t>()->default_value(1 << 10),
+         "largest number of elements to measure")
+        ("iterations", value<int>()->default_value(5),
+         "number of iterations to average")
+        ("chunk_size", value<std::size_t>()->default_value(0),
+         "number of elements per chunk of the single-pass scan (default: "
+         "determined automatically)")
+        ;
+    // clang-format on
+
     std::vector<std::string> cfg;
     cfg.push_back("hpx.os_threads=all");
     hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
     init_args.cfg = cfg;
 
     // Initialize and run HPX.
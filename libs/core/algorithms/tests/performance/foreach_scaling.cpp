@@ -81,6 +81,39 @@ std::uint64_t averageout_parallel_foreach(
     return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
 }
 
+template <typename Executor>
+std::uint64_t averageout_auto_foreach(std::size_t vector_size, Executor&& exec)
+{
+    std::vector<std::size_t> data_representation(vector_size);
+    std::iota(
+        std::begin(data_representation), std::end(data_representation), gen());
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    // average out 100 executions to avoid varying results
+    for (auto i = 0; i < test_count; i++)
+        measure_auto_foreach(data_representation, exec);
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+template <typename Executor>
+std::uint64_t averageout_profile_guided_foreach(
+    std::size_t vector_size, Executor&& exec)
+{
+    std::vector<std::size_t> data_representation(vector_size);
+    std::iota(
+        std::begin(data_representation), std::end(data_representation), gen());
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    // average out 100 executions to avoid varying results
+    for (auto i = 0; i < test_count; i++)
+        measure_profile_guided_foreach(data_representation, exec);
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
 template <typename Executor>
 std::uint64_t averageout_task_foreach(std::size_t vector_size, Executor&& exec)
 {
@@ -218,13 +251,15 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_count = vm["test_count"].as<int>();
     chunk_size = vm["chunk_size"].as<int>();
     num_overlapping_loops = vm["overlapping_loops"].as<int>();
+    std::string const profile_file = vm["chunk_size_profile"].as<std::string>();
     disable_stealing = vm.count("disable_stealing");
     fast_idle_mode = vm.count("fast_idle_mode");
 
     bool enable_all = vm.count("enable_all");
     if (!vm.count("parallel_foreach") && !vm.count("task_foreach") &&
         !vm.count("sequential_foreach") && !vm.count("parallel_forloop") &&
-        !vm.count("task_forloop") && !vm.count("sequential_forloop"))
+        !vm.count("task_forloop") && !vm.count("sequential_forloop") &&
+        !vm.count("auto_foreach") && !vm.count("profile_foreach"))
     {
         enable_all = true;
     }
@@ -259,11 +294,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
         std::uint64_t par_time_foreach = 0;
         std::uint64_t task_time_foreach = 0;
         std::uint64_t seq_time_foreach = 0;
+        std::uint64_t auto_time_foreach = 0;
+        std::uint64_t profile_time_foreach = 0;
 
         std::uint64_t par_time_forloop = 0;
         std::uint64_t task_time_forloop = 0;
         std::uint64_t seq_time_forloop = 0;
 
+        // warm start the profile-guided chunk sizes, if requested
+        if (!profile_file.empty() &&
+            !hpx::execution::experimental::load_chunk_size_profiles(
+                profile_file))
+        {
+            std::cerr << "could not load chunk size profiles from: "
+                      << profile_file << "\n"
+                      << std::flush;
+        }
+
         std::uint64_t plain_time_for = averageout_plain_for(vector_size);
         std::uint64_t plain_time_for_iter =
             averageout_plain_for_iter(vector_size);
@@ -285,6 +332,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 seq_time_foreach = averageout_sequential_foreach(vector_size);
             }
+            if (enable_all || vm.count("profile_foreach"))
+            {
+                profile_time_foreach =
+                    averageout_profile_guided_foreach(vector_size, par);
+            }
 
             if (enable_all || vm.count("parallel_forloop"))
             {
@@ -317,6 +369,15 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 seq_time_foreach = averageout_sequential_foreach(vector_size);
             }
+            if (enable_all || vm.count("auto_foreach"))
+            {
+                auto_time_foreach = averageout_auto_foreach(vector_size, par);
+            }
+            if (enable_all || vm.count("profile_foreach"))
+            {
+                profile_time_foreach =
+                    averageout_profile_guided_foreach(vector_size, par);
+            }
 
             if (enable_all || vm.count("parallel_forloop"))
             {
@@ -351,6 +412,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 seq_time_foreach = averageout_sequential_foreach(vector_size);
             }
+            if (enable_all || vm.count("profile_foreach"))
+            {
+                profile_time_foreach =
+                    averageout_profile_guided_foreach(vector_size, par);
+            }
 
             if (enable_all || vm.count("parallel_forloop"))
             {
@@ -384,6 +450,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 seq_time_foreach = averageout_sequential_foreach(vector_size);
             }
+            if (enable_all || vm.count("profile_foreach"))
+            {
+                profile_time_foreach =
+                    averageout_profile_guided_foreach(vector_size, par);
+            }
 
             if (enable_all || vm.count("parallel_forloop"))
             {
@@ -405,6 +476,15 @@ int hpx_main(hpx::program_options::variables_map& vm)
             return -1;
         }
 
+        if (!profile_file.empty() &&
+            !hpx::execution::experimental::save_chunk_size_profiles(
+                profile_file))
+        {
+            std::cerr << "could not save chunk size profiles to: "
+                      << profile_file << "\n"
+                      << std::flush;
+        }
+
         if (disable_stealing)
         {
             hpx::threads::add_scheduler_mode(
@@ -461,6 +541,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       << std::left
                       << "Average sequential execution time : " << std::right
                       << std::setw(8) << seq_time_foreach / 1e9 << "\n"
+                      << std::left
+                      << "Average auto chunk size time      : " << std::right
+                      << std::setw(8) << auto_time_foreach / 1e9 << "\n"
+                      << std::left
+                      << "Average profile-guided time       : " << std::right
+                      << std::setw(8) << profile_time_foreach / 1e9 << "\n"
                       << std::flush;
 
             std::cout << "-----Execution Time Difference-(for_each)------\n"
@@ -472,6 +558,15 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       << "Task Scale                        : " << std::right
                       << std::setw(8)
                       << (double(seq_time_foreach) / task_time_foreach) << "\n"
+                      << std::left
+                      << "Auto Chunk Size Scale             : " << std::right
+                      << std::setw(8)
+                      << (double(seq_time_foreach) / auto_time_foreach) << "\n"
+                      << std::left
+                      << "Profile-Guided Scale              : " << std::right
+                      << std::setw(8)
+                      << (double(seq_time_foreach) / profile_time_foreach)
+                      << "\n"
                       << std::flush;
 
             std::cout << "-------------Average-(for_loop)----------------\n"
@@ -523,6 +618,9 @@ int main(int argc, char* argv[])
             "number of iterations to combine while parallelization")
         ("overlapping_loops", value<int>()->default_value(0),
             "number of overlapping task loops")
+        ("chunk_size_profile", value<std::string>()->default_value(""),
+            "file to load the learned profile-guided chunk sizes from before "
+            "and to store them to after running the benchmarks")
         ("csv_output", "print results in csv format")
         ("executor", value<std::string>()->default_value("parallel"),
             "use specified executor (possible values: "
@@ -534,6 +632,10 @@ int main(int argc, char* argv[])
         ("parallel_foreach", "enable parallel_foreach")
         ("task_foreach", "enable task_foreach")
         ("sequential_foreach", "enable sequential_foreach")
+        ("auto_foreach", "enable parallel_foreach using auto_chunk_size "
+            "(parallel executor only)")
+        ("profile_foreach",
+            "enable parallel_foreach using profile_guided_chunk_size")
         ("parallel_forloop", "enable parallel_forloop")
         ("task_forloop", "enable task_forloop")
         ("sequential_forloop", "enable sequential_forloop")
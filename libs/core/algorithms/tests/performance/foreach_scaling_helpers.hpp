@@ -168,6 +168,32 @@ void measure_parallel_foreach(
     }
 }
 
+template <typename Executor>
+void measure_auto_foreach(
+    std::vector<std::size_t> const& data_representation, Executor&& exec)
+{
+    // create executor parameters object measuring the first iterations
+    hpx::execution::experimental::auto_chunk_size acs;
+
+    // invoke parallel for_each
+    hpx::ranges::for_each(hpx::execution::par.with(acs).on(exec),
+        data_representation, [](std::size_t) { worker_timed(delay); });
+}
+
+template <typename Executor>
+void measure_profile_guided_foreach(
+    std::vector<std::size_t> const& data_representation, Executor&& exec)
+{
+    // create executor parameters object, the chunk size is learned across
+    // all invocations from this call site
+    hpx::execution::experimental::profile_guided_chunk_size pgcs(
+        HPX_CURRENT_SOURCE_LOCATION());
+
+    // invoke parallel for_each
+    hpx::ranges::for_each(hpx::execution::par.with(pgcs).on(exec),
+        data_representation, [](std::size_t) { worker_timed(delay); });
+}
+
 template <typename Executor>
 hpx::future<void> measure_task_foreach(
     std::shared_ptr<std::vector<std::size_t>> data_representation,
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark applies a 7-point Jacobi stencil to a 3-D grid. It compares
+// a for_loop over the flattened interior points (parallelized over the
+// outermost dimension) with a for_loop over a tiled 3-D index space.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct grid
+{
+    grid(std::size_t nx, std::size_t ny, std::size_t nz)
+      : nx_(nx)
+      , ny_(ny)
+      , nz_(nz)
+      , data_(nx * ny * nz, 0.0)
+    {
+    }
+
+    double& operator()(std::ptrdiff_t i, std::ptrdiff_t j, std::ptrdiff_t k)
+    {
+        return data_[(i * ny_ + j) * nz_ + k];
+    }
+
+    double operator()(
+        std::ptrdiff_t i, std::ptrdiff_t j, std::ptrdiff_t k) const
+    {
+        return data_[(i * ny_ + j) * nz_ + k];
+    }
+
+    std::size_t nx_, ny_, nz_;
+    std::vector<double> data_;
+};
+
+void initialize(grid& g)
+{
+    for (std::size_t i = 0; i != g.data_.size(); ++i)
+    {
+        g.data_[i] = std::sin(static_cast<double>(i % 1031));
+    }
+}
+
+inline double stencil(grid const& u, std::ptrdiff_t i, std::ptrdiff_t j,
+    std::ptrdiff_t k) noexcept
+{
+    return (u(i - 1, j, k) + u(i + 1, j, k) + u(i, j - 1, k) + u(i, j + 1, k) +
+               u(i, j, k - 1) + u(i, j, k + 1)) *
+        (1.0 / 6.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// one sweep over the interior points, parallelized over the outermost
+// dimension
+template <typename ExPolicy>
+void sweep_flat(ExPolicy&& policy, grid const& u, grid& v)
+{
+    auto const nx = static_cast<std::ptrdiff_t>(u.nx_);
+    auto const ny = static_cast<std::ptrdiff_t>(u.ny_);
+    auto const nz = static_cast<std::ptrdiff_t>(u.nz_);
+
+    hpx::experimental::for_loop(policy, std::ptrdiff_t(1), nx - 1,
+        [&](std::ptrdiff_t i) {
+            for (std::ptrdiff_t j = 1; j != ny - 1; ++j)
+            {
+                for (std::ptrdiff_t k = 1; k != nz - 1; ++k)
+                {
+                    v(i, j, k) = stencil(u, i, j, k);
+                }
+            }
+        });
+}
+
+// one sweep over the interior points using a tiled index space
+template <typename ExPolicy>
+void sweep_tiled(ExPolicy&& policy, grid const& u, grid& v,
+    std::array<std::ptrdiff_t, 3> const& tile)
+{
+    auto const nx = static_cast<std::ptrdiff_t>(u.nx_);
+    auto const ny = static_cast<std::ptrdiff_t>(u.ny_);
+    auto const nz = static_cast<std::ptrdiff_t>(u.nz_);
+
+    hpx::experimental::index_space<3> const space(
+        {{1, 1, 1}}, {{nx - 1, ny - 1, nz - 1}}, tile);
+
+    hpx::experimental::for_loop(policy, space,
+        [&](std::ptrdiff_t i, std::ptrdiff_t j, std::ptrdiff_t k) {
+            v(i, j, k) = stencil(u, i, j, k);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Sweep>
+double measure(std::string const& name, grid& u, grid& v, int iterations,
+    Sweep&& sweep)
+{
+    // warm up
+    sweep(u, v);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (int it = 0; it != iterations; ++it)
+    {
+        sweep(u, v);
+        std::swap(u, v);
+    }
+    double const elapsed = timer.elapsed();
+
+    // 6 additions and one multiplication per interior point
+    double const points = static_cast<double>(u.nx_ - 2) *
+        static_cast<double>(u.ny_ - 2) * static_cast<double>(u.nz_ - 2);
+    double const gflops = 7.0 * points * iterations / elapsed * 1e-9;
+
+    std::cout << name << ": " << elapsed << " [s], " << gflops
+              << " [GFLOP/s], checksum: " << u(1, 1, 1) << std::endl;
+
+    return elapsed;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const nx = vm["nx"].as<std::size_t>();
+    std::size_t const ny = vm["ny"].as<std::size_t>();
+    std::size_t const nz = vm["nz"].as<std::size_t>();
+    int const iterations = vm["iterations"].as<int>();
+
+    std::array<std::ptrdiff_t, 3> tile = {{0, 0, 0}};
+    if (vm.count("tile"))
+    {
+        auto const& t = vm["tile"].as<std::vector<std::ptrdiff_t>>();
+        for (std::size_t d = 0; d != t.size() && d != tile.size(); ++d)
+        {
+            tile[d] = t[d];
+        }
+    }
+
+    grid u(nx, ny, nz);
+    grid v(nx, ny, nz);
+
+    auto const policy = hpx::execution::par;
+
+    std::cout << "grid: " << nx << "x" << ny << "x" << nz
+              << ", iterations: " << iterations
+              << ", threads: " << hpx::get_num_worker_threads() << std::endl;
+
+    initialize(u);
+    initialize(v);
+    double const t_flat = measure("flat ", u, v, iterations,
+        [&](grid const& u, grid& v) { sweep_flat(policy, u, v); });
+
+    initialize(u);
+    initialize(v);
+    double const t_tiled = measure("tiled", u, v, iterations,
+        [&](grid const& u, grid& v) { sweep_tiled(policy, u, v, tile); });
+
+    std::cout << "speedup (flat/tiled): " << t_flat / t_tiled << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("nx", value<std::size_t>()->default_value(256),
+         "number of grid points in the first (outermost) dimension")
+        ("ny", value<std::size_t>()->default_value(256),
+         "number of grid points in the second dimension")
+        ("nz", value<std::size_t>()->default_value(256),
+         "number of grid points in the third (innermost) dimension")
+        ("iterations", value<int>()->default_value(20),
+         "number of stencil sweeps to perform")
+        ("tile", value<std::vector<std::ptrdiff_t>>()->multitoken(),
+         "tile sizes of the index space, e.g. --tile 4 16 256 (default: "
+         "choose tile sizes based on the cache size)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
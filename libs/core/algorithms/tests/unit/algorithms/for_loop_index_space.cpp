@@ -0,0 +1,241 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+using index_space_2d = hpx::experimental::index_space<2>;
+using index_space_3d = hpx::experimental::index_space<3>;
+
+std::array<std::ptrdiff_t, 3> random_extents()
+{
+    std::uniform_int_distribution<std::ptrdiff_t> dis(1, 37);
+    return {{dis(gen), dis(gen), dis(gen)}};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_index_space_tiles()
+{
+    // the default tiles cover the last dimension first
+    index_space_3d const space({{0, 0, 0}}, {{100, 100, 1000}});
+
+    auto tile = space.tile_extents(2000);
+    HPX_TEST_EQ(tile[2], std::ptrdiff_t(1000));
+    HPX_TEST_EQ(tile[1], std::ptrdiff_t(2));
+    HPX_TEST_EQ(tile[0], std::ptrdiff_t(1));
+
+    // explicitly given tile sizes are respected
+    auto tile2 = space.with_tile({{4, 0, 10}}).tile_extents(2000);
+    HPX_TEST_EQ(tile2[2], std::ptrdiff_t(10));
+    HPX_TEST_EQ(tile2[1], std::ptrdiff_t(50));
+    HPX_TEST_EQ(tile2[0], std::ptrdiff_t(4));
+
+    HPX_TEST_EQ(space.size(), std::size_t(100 * 100 * 1000));
+    HPX_TEST(!space.empty());
+    HPX_TEST(index_space_3d({{0, 3, 0}}, {{5, 3, 5}}).empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_index_space(ExPolicy&& policy, index_space_3d const& space)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    auto const& first = space.first();
+    std::size_t const n1 = space.extent(1);
+    std::size_t const n2 = space.extent(2);
+
+    std::vector<std::atomic<int>> c(space.size());
+    hpx::experimental::for_loop(policy, space,
+        [&](std::ptrdiff_t i, std::ptrdiff_t j, std::ptrdiff_t k) {
+            std::size_t const idx =
+                ((i - first[0]) * n1 + (j - first[1])) * n2 + (k - first[2]);
+            ++c[idx];
+        });
+
+    // every index point has been visited exactly once
+    std::size_t count = 0;
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+        ++count;
+    }
+    HPX_TEST_EQ(count, space.size());
+}
+
+template <typename ExPolicy>
+void test_for_loop_index_space_reduction(
+    ExPolicy&& policy, index_space_2d const& space)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::size_t sum = 0;
+    hpx::experimental::for_loop(policy, space,
+        hpx::experimental::reduction_plus(sum),
+        [](std::ptrdiff_t i, std::ptrdiff_t j, std::size_t& sum) {
+            sum += i * 1000 + j;
+        });
+
+    std::size_t sum2 = 0;
+    for (std::ptrdiff_t i = space.first()[0]; i != space.last()[0]; ++i)
+    {
+        for (std::ptrdiff_t j = space.first()[1]; j != space.last()[1]; ++j)
+        {
+            sum2 += i * 1000 + j;
+        }
+    }
+    HPX_TEST_EQ(sum, sum2);
+}
+
+template <typename ExPolicy>
+void test_for_loop_index_space_induction(
+    ExPolicy&& policy, index_space_2d const& space)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // the induction values correspond to the row-major position of the
+    // index points
+    std::size_t const n1 = space.extent(1);
+    std::vector<std::size_t> d(space.size(), 0);
+
+    std::size_t curr = 0;
+    hpx::experimental::for_loop(policy, space,
+        hpx::experimental::induction(curr),
+        hpx::experimental::induction(std::size_t(0), 2),
+        [&](std::ptrdiff_t i, std::ptrdiff_t j, std::size_t pos,
+            std::size_t pos2) {
+            std::size_t const idx = (i - space.first()[0]) * n1 +
+                (j - space.first()[1]);
+            HPX_TEST_EQ(pos, idx);
+            HPX_TEST_EQ(pos2, 2 * idx);
+            d[pos] = 42;
+        });
+    HPX_TEST_EQ(curr, space.size());
+
+    for (std::size_t v : d)
+    {
+        HPX_TEST_EQ(v, std::size_t(42));
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_index_space_async(
+    ExPolicy&& policy, index_space_2d const& space)
+{
+    std::size_t sum = 0;
+    auto f = hpx::experimental::for_loop(policy, space,
+        hpx::experimental::reduction_plus(sum),
+        [](std::ptrdiff_t, std::ptrdiff_t, std::size_t& sum) { ++sum; });
+    f.wait();
+
+    HPX_TEST_EQ(sum, space.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void for_loop_index_space_test()
+{
+    using namespace hpx::execution;
+
+    test_index_space_tiles();
+
+    auto const extents = random_extents();
+    index_space_3d const space({{-3, 0, 5}},
+        {{extents[0] - 3, extents[1], extents[2] + 5}});
+
+    for (auto const& s : {space, space.with_tile({{1, 2, 3}}),
+             space.with_tile({{0, 0, 1}}), index_space_3d(extents)})
+    {
+        test_for_loop_index_space(seq, s);
+        test_for_loop_index_space(par, s);
+        test_for_loop_index_space(par_unseq, s);
+        test_for_loop_index_space(
+            par.with(hpx::execution::experimental::static_chunk_size(1)), s);
+    }
+
+    // no policy
+    {
+        std::size_t count = 0;
+        hpx::experimental::for_loop(space,
+            [&](std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t) { ++count; });
+        HPX_TEST_EQ(count, space.size());
+    }
+
+    index_space_2d const space2d(
+        {{2, 7}}, {{extents[0] + 2, 7 + extents[1]}});
+    for (auto const& s : {space2d, space2d.with_tile({{3, 5}})})
+    {
+        test_for_loop_index_space_reduction(seq, s);
+        test_for_loop_index_space_reduction(par, s);
+        test_for_loop_index_space_reduction(par_unseq, s);
+
+        test_for_loop_index_space_induction(seq, s);
+        test_for_loop_index_space_induction(par, s);
+        test_for_loop_index_space_induction(par_unseq, s);
+
+        test_for_loop_index_space_async(seq(task), s);
+        test_for_loop_index_space_async(par(task), s);
+    }
+
+    // empty index space
+    test_for_loop_index_space(par, index_space_3d({{0, 0, 0}}, {{4, 0, 4}}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_loop_index_space_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,298 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::experimental;
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// known answers from the reference implementation (Random123)
+void test_known_answers()
+{
+    using block_type = std::array<std::uint32_t, 4>;
+
+    {
+        std::uint32_t words[4][1] = {{0}, {0}, {0}, {0}};
+        hpx::parallel::detail::philox4x32_bijection<10>::apply(
+            words, {{0, 0}});
+        HPX_TEST_EQ(words[0][0], 0x6627e8d5u);
+        HPX_TEST_EQ(words[1][0], 0xe169c58du);
+        HPX_TEST_EQ(words[2][0], 0xbc57ac4cu);
+        HPX_TEST_EQ(words[3][0], 0x9b00dbd8u);
+    }
+    {
+        std::uint32_t words[4][1] = {
+            {0x243f6a88}, {0x85a308d3}, {0x13198a2e}, {0x03707344}};
+        hpx::parallel::detail::philox4x32_bijection<10>::apply(
+            words, {{0xa4093822, 0x299f31d0}});
+        HPX_TEST_EQ(words[0][0], 0xd16cfe09u);
+        HPX_TEST_EQ(words[1][0], 0x94fdccebu);
+        HPX_TEST_EQ(words[2][0], 0x5001e420u);
+        HPX_TEST_EQ(words[3][0], 0x24126ea1u);
+    }
+    {
+        std::uint32_t words[4][1] = {{0}, {0}, {0}, {0}};
+        hpx::parallel::detail::threefry4x32_bijection<20>::apply(
+            words, {{0, 0, 0, 0}});
+        HPX_TEST_EQ(words[0][0], 0x9c6ca96au);
+        HPX_TEST_EQ(words[1][0], 0xe17eae66u);
+        HPX_TEST_EQ(words[2][0], 0xfc10ecd4u);
+        HPX_TEST_EQ(words[3][0], 0x5256a7d8u);
+    }
+    {
+        std::uint32_t words[4][1] = {
+            {0x243f6a88}, {0x85a308d3}, {0x13198a2e}, {0x03707344}};
+        hpx::parallel::detail::threefry4x32_bijection<20>::apply(
+            words, {{0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89}});
+        HPX_TEST_EQ(words[0][0], 0x59cd1dbbu);
+        HPX_TEST_EQ(words[1][0], 0xb8879579u);
+        HPX_TEST_EQ(words[2][0], 0x86b5d00cu);
+        HPX_TEST_EQ(words[3][0], 0xac8b6d84u);
+    }
+
+    // the engine used as a uniform random bit generator
+    ex::philox4x32 engine;
+    block_type const block0 = engine.block(0);
+    block_type const block1 = engine.block(1);
+    HPX_TEST(block0 == (block_type{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                           0x9b00dbd8}}));
+
+    HPX_TEST_EQ(engine(), block0[0]);
+    engine.discard(5);
+    HPX_TEST_EQ(engine(), block1[2]);
+    HPX_TEST_EQ(engine(), block1[3]);
+
+    ex::philox4x32 other;
+    HPX_TEST(engine != other);
+    other.discard(8);
+    HPX_TEST(engine == other);
+
+    // engines can be used with the standard distributions
+    std::uniform_int_distribution<int> dis(0, 9);
+    int const value = dis(engine);
+    HPX_TEST(value >= 0 && value <= 9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the generated values are independent of the execution policy and of the
+// partitioning of the range
+template <typename Distribution, typename Engine>
+void test_reproducible(Distribution const& dist, Engine const& engine)
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::static_chunk_size;
+    using value_type = typename Distribution::result_type;
+
+    for (std::size_t size : {0, 1, 5, 10007})
+    {
+        std::vector<value_type> expected(size);
+        auto const last = ex::generate_random(
+            expected.begin(), expected.end(), dist, engine);
+        HPX_TEST(last == expected.end());
+
+        std::vector<value_type> c(size);
+        ex::generate_random(seq, c.begin(), c.end(), dist, engine);
+        HPX_TEST(c == expected);
+
+        std::vector<value_type> d(size);
+        ex::generate_random(par, d.begin(), d.end(), dist, engine);
+        HPX_TEST(d == expected);
+
+        std::vector<value_type> e(size);
+        ex::generate_random(par_unseq, e.begin(), e.end(), dist, engine);
+        HPX_TEST(e == expected);
+
+        for (std::size_t chunk_size : {1, 3, 17, 1000})
+        {
+            std::vector<value_type> f(size);
+            ex::generate_random(par.with(static_chunk_size(chunk_size)),
+                f.begin(), f.end(), dist, engine);
+            HPX_TEST(f == expected);
+        }
+
+        std::vector<value_type> g(size);
+        auto result =
+            ex::generate_random(par(task), g.begin(), g.end(), dist, engine);
+        HPX_TEST(result.get() == g.end());
+        HPX_TEST(g == expected);
+
+        // a subrange of the sequence can be generated on its own
+        if (size > 7)
+        {
+            std::vector<value_type> h(size - 7);
+            hpx::parallel::detail::sequential_generate_random(
+                h.begin(), 7, h.size(), engine, dist);
+            HPX_TEST(std::equal(h.begin(), h.end(), expected.begin() + 7));
+        }
+    }
+}
+
+void test_seeds()
+{
+    using namespace hpx::execution;
+
+    std::size_t const size = 1000;
+    ex::uniform_int_distribution<std::uint32_t> dist;
+
+    std::vector<std::uint32_t> a(size), b(size), c(size), d(size);
+    ex::generate_random(par, a.begin(), a.end(), dist, seed);
+    ex::generate_random(par, b.begin(), b.end(), dist, ex::philox4x32(seed));
+    ex::generate_random(
+        par, c.begin(), c.end(), dist, ex::philox4x32(seed + 1));
+    ex::generate_random(
+        par, d.begin(), d.end(), dist, ex::philox4x32(seed, 1));
+
+    HPX_TEST(a == b);
+    HPX_TEST(a != c);
+    HPX_TEST(a != d);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_distributions()
+{
+    using namespace hpx::execution;
+
+    std::size_t const size = 100000;
+
+    {
+        std::vector<int> c(size);
+        ex::generate_random(par, c.begin(), c.end(),
+            ex::uniform_int_distribution<int>(-3, 3), seed);
+
+        std::array<std::size_t, 7> counts = {};
+        for (int x : c)
+        {
+            HPX_TEST(x >= -3 && x <= 3);
+            if (x >= -3 && x <= 3)
+                ++counts[x + 3];
+        }
+        for (std::size_t count : counts)
+        {
+            HPX_TEST(count > size / 7 - size / 70);
+            HPX_TEST(count < size / 7 + size / 70);
+        }
+    }
+
+    {
+        std::vector<std::int64_t> c(size);
+        ex::generate_random(par, c.begin(), c.end(),
+            ex::uniform_int_distribution<std::int64_t>(),
+            ex::threefry4x32(seed));
+
+        std::size_t lower_half = 0;
+        for (std::int64_t x : c)
+        {
+            HPX_TEST(x >= 0);
+            if (x < (std::numeric_limits<std::int64_t>::max)() / 2)
+                ++lower_half;
+        }
+        HPX_TEST(lower_half > size / 2 - size / 20);
+        HPX_TEST(lower_half < size / 2 + size / 20);
+    }
+
+    {
+        std::vector<double> c(size);
+        ex::generate_random(par, c.begin(), c.end(),
+            ex::uniform_real_distribution<double>(-1.0, 1.0), seed);
+
+        double sum = 0.0;
+        for (double x : c)
+        {
+            HPX_TEST(x >= -1.0 && x < 1.0);
+            sum += x;
+        }
+        HPX_TEST(std::abs(sum / size) < 0.02);
+    }
+
+    {
+        std::vector<float> c(size);
+        ex::generate_random(par, c.begin(), c.end(),
+            ex::normal_distribution<float>(2.0f, 3.0f), seed);
+
+        double sum = 0.0;
+        for (float x : c)
+            sum += static_cast<double>(x);
+        double const mean = sum / size;
+
+        double variance = 0.0;
+        for (float x : c)
+        {
+            double const d = static_cast<double>(x) - mean;
+            variance += d * d;
+        }
+        variance /= size;
+
+        HPX_TEST(std::abs(mean - 2.0) < 0.1);
+        HPX_TEST(std::abs(variance - 9.0) < 0.5);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_known_answers();
+
+    test_reproducible(
+        ex::uniform_int_distribution<int>(0, 99), ex::philox4x32(seed));
+    test_reproducible(
+        ex::uniform_int_distribution<std::uint64_t>(), ex::threefry4x32(seed));
+    test_reproducible(
+        ex::uniform_real_distribution<float>(), ex::philox4x32(seed, 3));
+    test_reproducible(
+        ex::uniform_real_distribution<double>(), ex::threefry4x32(seed));
+    test_reproducible(ex::normal_distribution<float>(), ex::philox4x32(seed));
+    test_reproducible(ex::normal_distribution<double>(), ex::philox4x32(seed));
+
+    test_seeds();
+    test_distributions();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -25,6 +25,13 @@ void test_inclusive_scan1()
 
     test_inclusive_scan1_async(seq(task), IteratorTag());
     test_inclusive_scan1_async(par(task), IteratorTag());
+
+    // single-pass scan using the default and a small chunk size
+    using hpx::execution::experimental::single_pass_scan;
+    test_inclusive_scan1(par.with(single_pass_scan()), IteratorTag());
+    test_inclusive_scan1(par.with(single_pass_scan(100)), IteratorTag());
+    test_inclusive_scan1_async(
+        par(task).with(single_pass_scan(100)), IteratorTag());
 }
 
 void inclusive_scan_test1()
@@ -79,14 +86,19 @@ void inclusive_scan_test3()
 void inclusive_scan_validate()
 {
     std::vector<int> a, b;
+    auto const single_pass = hpx::execution::par.with(
+        hpx::execution::experimental::single_pass_scan(100));
+
     // test scan algorithms using separate array for output
     //  std::cout << " Validating dual arrays " <<std::endl;
     test_inclusive_scan_validate(hpx::execution::seq, a, b);
     test_inclusive_scan_validate(hpx::execution::par, a, b);
+    test_inclusive_scan_validate(single_pass, a, b);
     // test scan algorithms using same array for input and output
     //  std::cout << " Validating in_place arrays " <<std::endl;
     test_inclusive_scan_validate(hpx::execution::seq, a, a);
     test_inclusive_scan_validate(hpx::execution::par, a, a);
+    test_inclusive_scan_validate(single_pass, a, a);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -89,6 +89,12 @@ void test_inclusive_scan_exception()
 
     test_inclusive_scan_exception_async(seq(task), IteratorTag());
     test_inclusive_scan_exception_async(par(task), IteratorTag());
+
+    using hpx::execution::experimental::single_pass_scan;
+    test_inclusive_scan_exception(
+        par.with(single_pass_scan(100)), IteratorTag());
+    test_inclusive_scan_exception_async(
+        par(task).with(single_pass_scan(100)), IteratorTag());
 }
 
 void inclusive_scan_exception_test()
@@ -111,6 +117,12 @@ void test_inclusive_scan_bad_alloc()
 
     test_inclusive_scan_bad_alloc_async(seq(task), IteratorTag());
     test_inclusive_scan_bad_alloc_async(par(task), IteratorTag());
+
+    using hpx::execution::experimental::single_pass_scan;
+    test_inclusive_scan_bad_alloc(
+        par.with(single_pass_scan(100)), IteratorTag());
+    test_inclusive_scan_bad_alloc_async(
+        par(task).with(single_pass_scan(100)), IteratorTag());
 }
 
 void inclusive_scan_bad_alloc_test()
@@ -0,0 +1,229 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace views = hpx::ranges::views;
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_filtered_pipelines(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::uniform_int_distribution<> dis(0, 99);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    auto twice = [](int x) { return 2.0 * x; };
+    auto large = [](double x) { return x > 50.0; };
+
+    double expected = 0.0;
+    std::int64_t expected_count = 0;
+    for (int x : c)
+    {
+        if (twice(x) > 50.0)
+        {
+            expected += twice(x);
+            ++expected_count;
+        }
+    }
+
+    auto rng = c | views::transform(twice) | views::filter(large);
+
+    HPX_TEST_EQ(
+        hpx::ranges::reduce(policy, rng, 0.0, std::plus<>()), expected);
+    HPX_TEST_EQ(hpx::ranges::reduce(policy, rng, 0.0), expected);
+    HPX_TEST_EQ(hpx::ranges::reduce(policy, rng), expected);
+    HPX_TEST_EQ(hpx::ranges::transform_reduce(policy, rng, 0.0,
+                    std::plus<>(), [](double x) { return -x; }),
+        -expected);
+    HPX_TEST_EQ(hpx::ranges::count_if(policy, rng, [](double) { return true; }),
+        expected_count);
+
+    // the sequential algorithms traverse the view using its iterators
+    HPX_TEST_EQ(std::accumulate(rng.begin(), rng.end(), 0.0), expected);
+
+    // filters and transformations may be applied in any order
+    auto even = [](int x) { return x % 2 == 0; };
+    auto increment = [](double x) { return x + 1.0; };
+    auto small = [](double x) { return x < 100.0; };
+
+    double expected2 = 0.0;
+    for (int x : c)
+    {
+        if (even(x) && small(increment(twice(x))))
+            expected2 += increment(twice(x));
+    }
+
+    auto rng2 = c | views::filter(even) | views::transform(twice) |
+        views::transform(increment) | views::filter(small);
+
+    HPX_TEST_EQ(
+        hpx::ranges::reduce(policy, rng2, 0.0, std::plus<>()), expected2);
+    HPX_TEST_EQ(std::accumulate(rng2.begin(), rng2.end(), 0.0), expected2);
+
+    HPX_TEST_EQ(hpx::ranges::count(policy, c | views::filter(even), 42),
+        std::count(c.begin(), c.end(), 42));
+
+    // modify the selected elements of the underlying range
+    std::vector<int> d = c;
+    hpx::ranges::for_each(
+        policy, d | views::filter(even), [](int& x) { x = -1; });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(d[i], even(c[i]) ? -1 : c[i]);
+    }
+}
+
+template <typename ExPolicy>
+void test_filtered_pipelines_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), 0);
+
+    auto odd = [](int x) { return x % 2 != 0; };
+
+    hpx::future<int> f = hpx::ranges::reduce(policy, c | views::filter(odd), 0);
+    HPX_TEST_EQ(f.get(), static_cast<int>((size / 2) * (size / 2)));
+
+    auto last = hpx::ranges::for_each(
+        policy, c | views::filter(odd), [](int& x) { x = 0; });
+    last.wait();
+    HPX_TEST_EQ(std::accumulate(c.begin(), c.end(), 0),
+        static_cast<int>((size / 2) * (size / 2 - 1)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_random_access_views(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::uniform_int_distribution<> dis(0, 99);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::int64_t const sum =
+        std::accumulate(c.begin(), c.end(), std::int64_t(0));
+
+    // iota
+    auto indices = views::iota(std::int64_t(0), std::int64_t(size));
+    HPX_TEST_EQ(indices.size(), size);
+    HPX_TEST_EQ(hpx::ranges::reduce(policy, indices, std::int64_t(0)),
+        std::int64_t(size) * (std::int64_t(size) - 1) / 2);
+
+    // transform
+    auto tripled = c | views::transform([](int x) { return 3 * x; });
+    HPX_TEST_EQ(tripled.size(), size);
+    HPX_TEST_EQ(hpx::ranges::reduce(policy, tripled, std::int64_t(0)), 3 * sum);
+
+    // stride
+    std::int64_t strided_sum = 0;
+    for (std::size_t i = 0; i < size; i += 3)
+        strided_sum += c[i];
+
+    auto strided = c | views::stride(3);
+    HPX_TEST_EQ(strided.size(), (size + 2) / 3);
+    HPX_TEST_EQ(
+        hpx::ranges::reduce(policy, strided, std::int64_t(0)), strided_sum);
+
+    // chunk
+    auto chunks = c | views::chunk(7);
+    HPX_TEST_EQ(chunks.size(), (size + 6) / 7);
+    HPX_TEST_EQ(hpx::ranges::transform_reduce(policy, chunks, std::int64_t(0),
+                    std::plus<>(),
+                    [](auto chunk) {
+                        return std::accumulate(
+                            chunk.begin(), chunk.end(), std::int64_t(0));
+                    }),
+        sum);
+
+    // zip, the resulting range is as long as the shortest range
+    std::vector<int> ones(size + 3, 1);
+    auto zipped = views::zip(c, ones);
+    HPX_TEST_EQ(zipped.size(), size);
+    HPX_TEST_EQ(hpx::ranges::transform_reduce(policy, zipped, std::int64_t(0),
+                    std::plus<>(),
+                    [](auto t) {
+                        return std::int64_t(hpx::get<0>(t) * hpx::get<1>(t));
+                    }),
+        sum);
+
+    hpx::ranges::for_each(policy, views::zip(views::iota(0, int(size)), c),
+        [](auto t) { hpx::get<1>(t) = hpx::get<0>(t); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(c[i], static_cast<int>(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_views()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {0, 1, 17, 10007})
+    {
+        test_filtered_pipelines(seq, size);
+        test_filtered_pipelines(par, size);
+        test_filtered_pipelines(par_unseq, size);
+
+        test_random_access_views(seq, size);
+        test_random_access_views(par, size);
+    }
+
+    test_filtered_pipelines_async(seq(task), 10006);
+    test_filtered_pipelines_async(par(task), 10006);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_views();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,227 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test covers the algorithms that compact the selected elements into
+// the destination range (copy_if, remove_copy_if, unique_copy, and
+// partition_copy) using vector-pack execution policies.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+struct less_f
+{
+    less_f(int val)
+      : val_(val)
+    {
+    }
+
+    template <typename T>
+    auto operator()(T lhs) const
+    {
+        return lhs < T(val_);
+    }
+
+    int val_;
+};
+
+std::vector<int> make_data(std::size_t size)
+{
+    // use a small range of values to create runs of equal elements
+    std::vector<int> c(size);
+    std::generate(
+        std::begin(c), std::end(c), []() { return std::rand() % 8; });
+    return c;
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected(c.size());
+
+    auto last = hpx::copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), less_f(4));
+    auto expected_last = std::copy_if(
+        std::begin(c), std::end(c), std::begin(expected), less_f(4));
+
+    HPX_TEST_EQ(std::distance(std::begin(d), last),
+        std::distance(std::begin(expected), expected_last));
+    HPX_TEST(std::equal(std::begin(expected), expected_last, std::begin(d)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_copy_if(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected(c.size());
+
+    auto last = hpx::remove_copy_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), less_f(4));
+    auto expected_last = std::remove_copy_if(
+        std::begin(c), std::end(c), std::begin(expected), less_f(4));
+
+    HPX_TEST_EQ(std::distance(std::begin(d), last),
+        std::distance(std::begin(expected), expected_last));
+    HPX_TEST(std::equal(std::begin(expected), expected_last, std::begin(d)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_unique_copy(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected(c.size());
+
+    auto last = hpx::unique_copy(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), std::begin(d));
+    auto expected_last =
+        std::unique_copy(std::begin(c), std::end(c), std::begin(expected));
+
+    HPX_TEST_EQ(std::distance(std::begin(d), last),
+        std::distance(std::begin(expected), expected_last));
+    HPX_TEST(std::equal(std::begin(expected), expected_last, std::begin(d)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_copy(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d_true(c.size());
+    std::vector<int> d_false(c.size());
+    std::vector<int> expected_true(c.size());
+    std::vector<int> expected_false(c.size());
+
+    auto result = hpx::partition_copy(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d_true), std::begin(d_false),
+        less_f(4));
+    auto expected = std::partition_copy(std::begin(c), std::end(c),
+        std::begin(expected_true), std::begin(expected_false), less_f(4));
+
+    HPX_TEST_EQ(std::distance(std::begin(d_true), result.first),
+        std::distance(std::begin(expected_true), expected.first));
+    HPX_TEST_EQ(std::distance(std::begin(d_false), result.second),
+        std::distance(std::begin(expected_false), expected.second));
+    HPX_TEST(std::equal(
+        std::begin(expected_true), expected.first, std::begin(d_true)));
+    HPX_TEST(std::equal(
+        std::begin(expected_false), expected.second, std::begin(d_false)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if_async(ExPolicy p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected(c.size());
+
+    auto f = hpx::copy_if(p, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(d), less_f(4));
+    auto last = f.get();
+
+    auto expected_last = std::copy_if(
+        std::begin(c), std::end(c), std::begin(expected), less_f(4));
+
+    HPX_TEST_EQ(std::distance(std::begin(d), last),
+        std::distance(std::begin(expected), expected_last));
+    HPX_TEST(std::equal(std::begin(expected), expected_last, std::begin(d)));
+}
+
+template <typename IteratorTag>
+void test_copy_if()
+{
+    using namespace hpx::execution;
+    test_copy_if(simd, IteratorTag());
+    test_copy_if(par_simd, IteratorTag());
+
+    test_remove_copy_if(simd, IteratorTag());
+    test_remove_copy_if(par_simd, IteratorTag());
+
+    test_unique_copy(simd, IteratorTag());
+    test_unique_copy(par_simd, IteratorTag());
+
+    test_partition_copy(simd, IteratorTag());
+    test_partition_copy(par_simd, IteratorTag());
+
+    test_copy_if_async(simd(task), IteratorTag());
+    test_copy_if_async(par_simd(task), IteratorTag());
+}
+
+void copy_if_test()
+{
+    test_copy_if<std::random_access_iterator_tag>();
+    test_copy_if<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    copy_if_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -161,6 +161,7 @@ namespace hpx {
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -433,6 +434,110 @@ namespace hpx::detail {
         Tuple const& t_;
         bool has_exceptional_results_ = false;
     };
+
+    ///////////////////////////////////////////////////////////////////////
+    // Joins on a range (vector or array) of futures using a single atomic
+    // countdown. Other than wait_all_frame, which attaches a continuation to
+    // one future at a time and re-walks the remaining range from inside of
+    // it, a continuation is attached to all futures that are not ready up
+    // front. The continuations hold a reference to the frame only (a single
+    // pointer, this fits into the small buffer of the callback and into the
+    // single inline slot of the callback vector of the shared state), no
+    // memory is allocated per future. The last future to become ready makes
+    // the frame ready, which wakes up the (single) waiting thread. As every
+    // continuation keeps the frame alive, the frame stays valid even if
+    // attaching the continuations fails part way through.
+    template <typename Range>
+    struct wait_all_counter_frame    //-V690
+      : hpx::lcos::detail::future_data<void>
+    {
+    private:
+        using base_type = hpx::lcos::detail::future_data<void>;
+        using init_no_addref = typename base_type::init_no_addref;
+
+        wait_all_counter_frame(wait_all_counter_frame const&) = delete;
+        wait_all_counter_frame(wait_all_counter_frame&&) = delete;
+
+        wait_all_counter_frame& operator=(
+            wait_all_counter_frame const&) = delete;
+        wait_all_counter_frame& operator=(wait_all_counter_frame&&) = delete;
+
+    public:
+        explicit wait_all_counter_frame(Range const& values) noexcept
+          : base_type(init_no_addref{})
+          , values_(values)
+        {
+        }
+
+    private:
+        // Returns true if the calling thread was the last one to decrement
+        // the counter.
+        bool count_down() noexcept
+        {
+            return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        void on_future_ready()
+        {
+            if (count_down())
+            {
+                this->set_data(util::unused);
+            }
+        }
+
+    public:
+        bool wait_all()
+        {
+            for (auto const& value : values_)
+            {
+                auto const& next_future_data =
+                    hpx::traits::detail::get_shared_state(value);
+
+                if (!next_future_data ||
+                    next_future_data->is_ready(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                next_future_data->execute_deferred();
+
+                // execute_deferred might have made the future ready
+                if (!next_future_data->is_ready(std::memory_order_relaxed))
+                {
+                    // the increment is published by set_on_completed
+                    count_.fetch_add(1, std::memory_order_relaxed);
+
+                    next_future_data->set_on_completed(
+                        [this_ = hpx::intrusive_ptr<wait_all_counter_frame>(
+                             this)]() -> void { this_->on_future_ready(); });
+                }
+            }
+
+            // Release the initial count held while attaching continuations.
+            // If we were not the last, wait for the remaining futures.
+            if (!count_down())
+            {
+                this->wait();
+            }
+
+            // All futures are ready now, check whether at least one of them
+            // has become exceptional.
+            for (auto const& value : values_)
+            {
+                auto const& next_future_data =
+                    hpx::traits::detail::get_shared_state(value);
+                if (next_future_data && next_future_data->has_exception())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        Range const& values_;
+        std::atomic<std::size_t> count_{1};
+    };
 }    // namespace hpx::detail
 
 namespace hpx {
@@ -447,14 +552,12 @@ namespace hpx {
         {
             if (!values.empty())
             {
-                using result_type = hpx::tuple<std::vector<Future> const&>;
-                using frame_type = hpx::detail::wait_all_frame<result_type>;
-
-                result_type data(values);
+                using frame_type =
+                    hpx::detail::wait_all_counter_frame<std::vector<Future>>;
 
                 // frame is initialized with initial reference count
                 hpx::intrusive_ptr<frame_type> frame(
-                    new frame_type(data), false);
+                    new frame_type(values), false);
                 return frame->wait_all();
             }
             return false;
@@ -486,13 +589,11 @@ namespace hpx {
         template <typename Future, std::size_t N>
         static bool wait_all_nothrow_impl(std::array<Future, N> const& values)
         {
-            using result_type = hpx::tuple<std::array<Future, N> const&>;
-            using frame_type = hpx::detail::wait_all_frame<result_type>;
-
-            result_type data(values);
+            using frame_type =
+                hpx::detail::wait_all_counter_frame<std::array<Future, N>>;
 
             // frame is initialized with initial reference count
-            hpx::intrusive_ptr<frame_type> frame(new frame_type(data), false);
+            hpx::intrusive_ptr<frame_type> frame(new frame_type(values), false);
             return frame->wait_all();
         }
 
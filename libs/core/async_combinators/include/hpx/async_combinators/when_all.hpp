@@ -142,8 +142,10 @@ namespace hpx {
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -220,7 +222,7 @@ namespace hpx::lcos::detail {
     template <typename... T>
     typename async_when_all_frame<
         hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
-    when_all_impl(T&&... args)
+    when_all_traverse_impl(T&&... args)
     {
         using result_type = hpx::tuple<hpx::traits::acquire_future_t<T>...>;
         using frame_type = async_when_all_frame<result_type>;
@@ -235,6 +237,113 @@ namespace hpx::lcos::detail {
         return hpx::traits::future_access<typename frame_type::type>::create(
             HPX_MOVE(frame));
     }
+
+    // Joins on a range of futures using a single atomic countdown instead of
+    // traversing the range asynchronously. A continuation holding a reference
+    // to the frame is attached to each future that is not ready yet
+    // (no memory is allocated per future), the last one to become ready
+    // makes the frame ready.
+    template <typename Range>
+    class async_when_all_counter_frame : public future_data<Range>
+    {
+    public:
+        using result_type = Range;
+        using type = hpx::future<result_type>;
+        using base_type = hpx::lcos::detail::future_data<result_type>;
+
+        async_when_all_counter_frame(
+            typename base_type::init_no_addref no_addref,
+            Range&& values) noexcept
+          : base_type(no_addref)
+          , values_(HPX_MOVE(values))
+        {
+        }
+
+        void attach()
+        {
+            for (auto const& value : values_)
+            {
+                auto const& next_future_data =
+                    hpx::traits::detail::get_shared_state(value);
+
+                if (!next_future_data ||
+                    next_future_data->is_ready(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                next_future_data->execute_deferred();
+
+                // execute_deferred might have made the future ready
+                if (!next_future_data->is_ready(std::memory_order_relaxed))
+                {
+                    // the increment is published by set_on_completed
+                    count_.fetch_add(1, std::memory_order_relaxed);
+                    // Each continuation keeps the frame alive until it has
+                    // run, even if the returned future is released in the
+                    // meantime or attaching the remaining continuations
+                    // fails.
+                    using frame_ptr =
+                        hpx::intrusive_ptr<async_when_all_counter_frame>;
+                    next_future_data->set_on_completed(
+                        [this_ = frame_ptr(this)]() -> void {
+                            this_->on_future_ready();
+                        });
+                }
+            }
+
+            // release the initial count held while attaching continuations
+            on_future_ready();
+        }
+
+    private:
+        void on_future_ready()
+        {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                this->set_data(HPX_MOVE(values_));
+            }
+        }
+
+        Range values_;
+        std::atomic<std::size_t> count_{1};
+    };
+
+    template <typename Range>
+    typename async_when_all_counter_frame<Range>::type when_all_range_impl(
+        Range&& values)
+    {
+        using frame_type = async_when_all_counter_frame<Range>;
+        using no_addref = typename frame_type::base_type::init_no_addref;
+
+        // frame is initialized with initial reference count
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(no_addref{}, HPX_MOVE(values)), false);
+        frame->attach();
+
+        return hpx::traits::future_access<typename frame_type::type>::create(
+            HPX_MOVE(frame));
+    }
+
+    template <typename... T>
+    typename async_when_all_frame<
+        hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
+    when_all_impl(T&&... args)
+    {
+        if constexpr (sizeof...(T) == 1 &&
+            (hpx::traits::is_future_range_v<
+                 hpx::traits::acquire_future_t<T>> &&
+                ...))
+        {
+            // a single range of futures
+            return when_all_range_impl(
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+        }
+        else
+        {
+            return when_all_traverse_impl(HPX_FORWARD(T, args)...);
+        }
+    }
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
@@ -224,10 +224,71 @@ void test_wait_all_n()
     }
 }
 
+void test_wait_all_many_futures()
+{
+    constexpr int count = 10000;
+    {
+        std::vector<hpx::future<int>> future_array;
+        future_array.reserve(count);
+        for (int i = 0; i != count; ++i)
+        {
+            if (i % 3 == 0)
+                future_array.push_back(hpx::make_ready_future(i));
+            else if (i % 3 == 1)
+                future_array.push_back(
+                    hpx::async(hpx::launch::deferred, [i] { return i; }));
+            else
+                future_array.push_back(hpx::async([i] { return i; }));
+        }
+
+        HPX_TEST(!hpx::wait_all_nothrow(future_array));
+
+        for (int i = 0; i != count; ++i)
+        {
+            HPX_TEST(future_array[i].is_ready());
+            HPX_TEST_EQ(future_array[i].get(), i);
+        }
+    }
+    {
+        std::vector<hpx::shared_future<int>> future_array;
+        future_array.reserve(count);
+        for (int i = 0; i != count; ++i)
+        {
+            future_array.push_back(hpx::async([i] {
+                if (i == count / 2)
+                    throw std::runtime_error("");
+                return i;
+            }));
+        }
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::wait_all(future_array.begin(), future_array.end());
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const&)
+        {
+            caught_exception = true;
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+
+        for (auto const& f : future_array)
+        {
+            HPX_TEST(f.is_ready());
+        }
+    }
+}
+
 int hpx_main()
 {
     test_wait_all();
     test_wait_all_n();
+    test_wait_all_many_futures();
     return hpx::local::finalize();
 }
 
@@ -12,6 +12,7 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -243,6 +244,41 @@ void test_when_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+void test_when_all_many_futures()
+{
+    // the futures become ready concurrently while the continuations are
+    // being attached
+    unsigned const count = 10000;
+    std::vector<hpx::shared_future<int>> futures;
+    futures.reserve(count);
+    for (unsigned j = 0; j < count; ++j)
+    {
+        if (j % 3 == 0)
+            futures.push_back(hpx::make_ready_future(42));
+        else if (j % 3 == 1)
+            futures.push_back(hpx::async(hpx::launch::deferred, [] {
+                return 42;
+            }));
+        else
+            futures.push_back(hpx::async([] { return 42; }));
+    }
+
+    hpx::future<std::vector<hpx::shared_future<int>>> r =
+        hpx::when_all(futures);
+
+    // the future returned by when_all is independent of the input futures
+    futures.clear();
+
+    std::vector<hpx::shared_future<int>> result = r.get();
+
+    HPX_TEST_EQ(result.size(), static_cast<std::size_t>(count));
+    for (auto const& f : result)
+    {
+        HPX_TEST(f.is_ready());
+        HPX_TEST_EQ(f.get(), 42);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -261,6 +297,7 @@ int hpx_main(variables_map&)
         test_when_all_five_futures();
         test_when_all_late_futures();
         test_when_all_deferred_futures();
+        test_when_all_many_futures();
     }
 
     hpx::local::finalize();
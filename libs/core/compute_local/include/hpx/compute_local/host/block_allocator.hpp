@@ -14,6 +14,7 @@
 
 #include <hpx/allocator_support/detail/new.hpp>
 #include <hpx/compute_local/host/block_executor.hpp>
+#include <hpx/compute_local/host/memory_policy.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/executors/execution_policy.hpp>
@@ -38,7 +39,9 @@ namespace hpx::compute::host {
     namespace detail {
 
         /// The policy_allocator allocates blocks of memory touched according to
-        /// the distribution policy of the given executor.
+        /// the distribution policy of the given executor. The page size and
+        /// the (explicit) placement of the memory is controlled by the given
+        /// memory_policy.
         template <typename T, typename Policy,
             typename Enable =
                 std::enable_if_t<hpx::is_execution_policy_v<Policy>>>
@@ -62,13 +65,21 @@ namespace hpx::compute::host {
                 using other = policy_allocator<U, policy_type>;
             };
 
-            explicit policy_allocator(Policy&& policy) noexcept
+            explicit policy_allocator(Policy&& policy,
+                host::memory_policy const& mem_policy = {},
+                std::vector<host::target> placement_targets = {}) noexcept
               : policy_(HPX_MOVE(policy))
+              , memory_policy_(mem_policy)
+              , placement_targets_(HPX_MOVE(placement_targets))
             {
             }
 
-            explicit policy_allocator(Policy const& policy)
+            explicit policy_allocator(Policy const& policy,
+                host::memory_policy const& mem_policy = {},
+                std::vector<host::target> placement_targets = {})
               : policy_(policy)
+              , memory_policy_(mem_policy)
+              , placement_targets_(HPX_MOVE(placement_targets))
             {
             }
 
@@ -77,6 +88,11 @@ namespace hpx::compute::host {
                 return policy_;
             }
 
+            host::memory_policy const& memory_policy() const noexcept
+            {
+                return memory_policy_;
+            }
+
             // Returns the actual address of x even in presence of overloaded
             // operator&
             static pointer address(reference x) noexcept
@@ -89,16 +105,15 @@ namespace hpx::compute::host {
                 return &x;
             }
 
-            // Allocates n * sizeof(T) bytes of uninitialized storage by calling
-            // topo.allocate(). The pointer hint may be used to provide locality
-            // of reference: the allocator, if supported by the implementation,
-            // will attempt to allocate the new memory block as close as
-            // possible to hint.
-            static pointer allocate(
-                size_type n, void const* /* hint */ = nullptr)
+            // Allocates n * sizeof(T) bytes of uninitialized storage as
+            // specified by the memory policy. The pointer hint may be used to
+            // provide locality of reference: the allocator, if supported by the
+            // implementation, will attempt to allocate the new memory block as
+            // close as possible to hint.
+            pointer allocate(size_type n, void const* /* hint */ = nullptr)
             {
-                return static_cast<pointer>(
-                    hpx::threads::create_topology().allocate(n * sizeof(T)));
+                return static_cast<pointer>(host::allocate_memory(
+                    n * sizeof(T), memory_policy_, placement_targets_));
             }
 
             // Deallocates the storage referenced by the pointer p, which must
@@ -106,16 +121,19 @@ namespace hpx::compute::host {
             // argument n must be equal to the first argument of the call to
             // allocate() that originally produced p; otherwise, the behavior is
             // undefined.
-            static void deallocate(pointer p, size_type n) noexcept
+            void deallocate(pointer p, size_type n) noexcept
             {
-                try
-                {
-                    hpx::threads::create_topology().deallocate(p, n);
-                }
-                catch (...)
-                {
-                    // just ignore errors from create_topology
-                }
+                host::deallocate_memory(p, n * sizeof(T), memory_policy_);
+            }
+
+            // Moves the pages of the n objects pointed to by p to the NUMA
+            // domains selected by the memory policy, e.g. after the targets of
+            // the allocator have changed. Returns false if the pages could
+            // not be migrated.
+            bool migrate(pointer p, size_type n) const
+            {
+                return host::migrate_memory(
+                    p, n * sizeof(T), memory_policy_, placement_targets_);
             }
 
             // Returns the maximum theoretically possible value of n, for which
@@ -239,6 +257,8 @@ namespace hpx::compute::host {
         private:
             target_type target_;
             policy_type policy_;
+            host::memory_policy memory_policy_;
+            std::vector<host::target> placement_targets_;
         };
     }    // namespace detail
 
@@ -255,6 +275,15 @@ namespace hpx::compute::host {
     /// std::size_t N = 2048;
     /// vector_type v(N, allocator_type(numa_nodes));
     ///
+    /// Optionally, a memory_policy can be passed to back the memory with huge
+    /// pages or to bind the memory explicitly to the targets instead of
+    /// relying on first touch placement:
+    ///
+    /// hpx::compute::host::memory_policy policy(
+    ///     hpx::compute::host::page_size_policy::transparent_huge_pages,
+    ///     hpx::compute::host::placement_policy::bind);
+    /// vector_type v(N, allocator_type(numa_nodes, policy));
+    ///
     template <typename T,
         typename Executor =
             hpx::parallel::execution::restricted_thread_pool_executor>
@@ -291,6 +320,14 @@ namespace hpx::compute::host {
         {
         }
 
+        block_allocator(
+            target_type const& targets, host::memory_policy const& mem_policy)
+          : base_type(
+                policy_type(executor_type(targets), executor_parameters_type()),
+                mem_policy, targets)
+        {
+        }
+
         // Access the underlying target (device)
         target_type const& target() const noexcept
         {
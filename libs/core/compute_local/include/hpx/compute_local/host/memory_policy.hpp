@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/target.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::compute::host {
+
+    /// The kind of pages backing an allocation
+    enum class page_size_policy : std::uint8_t
+    {
+        /// use the default pages of the system
+        default_pages,
+
+        /// ask the operating system to back the memory with transparent huge
+        /// pages (madvise(MADV_HUGEPAGE)), default pages are used if this is
+        /// not supported
+        transparent_huge_pages,
+
+        /// allocate explicitly reserved huge pages (MAP_HUGETLB), falls back
+        /// to transparent huge pages if none are available
+        huge_pages
+    };
+
+    /// The placement of the pages of an allocation onto the NUMA domains of
+    /// a list of targets
+    enum class placement_policy : std::uint8_t
+    {
+        /// pages are placed by the thread touching them first, this relies
+        /// on the allocator initializing the memory from the right threads
+        first_touch,
+
+        /// split the allocation into one contiguous block per target, each
+        /// block is bound to the NUMA domain(s) of its target
+        bind,
+
+        /// interleave the pages round robin across the NUMA domains of all
+        /// targets
+        interleave,
+
+        /// bind blocks of memory_policy::block_size bytes round robin to the
+        /// NUMA domains of the targets
+        block_cyclic
+    };
+
+    /// Describes how the memory for the host allocators is obtained from the
+    /// operating system. The default policy (default pages, first touch)
+    /// corresponds to plain allocations.
+    struct memory_policy
+    {
+        constexpr memory_policy() noexcept = default;
+
+        constexpr explicit memory_policy(page_size_policy p,
+            placement_policy pl = placement_policy::first_touch,
+            std::size_t size = 0) noexcept
+          : pages(p)
+          , placement(pl)
+          , block_size(size)
+        {
+        }
+
+        constexpr explicit memory_policy(
+            placement_policy pl, std::size_t size = 0) noexcept
+          : placement(pl)
+          , block_size(size)
+        {
+        }
+
+        page_size_policy pages = page_size_policy::default_pages;
+        placement_policy placement = placement_policy::first_touch;
+
+        // size of the blocks distributed by placement_policy::block_cyclic in
+        // bytes, rounded up to the page size (zero: one page)
+        std::size_t block_size = 0;
+    };
+
+    /// Return the size of the (default) huge pages of the system
+    HPX_CORE_EXPORT std::size_t get_huge_page_size() noexcept;
+
+    /// Allocate the given number of bytes according to the given memory
+    /// policy. The pages are placed onto the NUMA domains of the given
+    /// targets (all NUMA domains if empty). Failing to apply the requested
+    /// page size or placement is not an error, the memory is allocated
+    /// regardless. Throws std::bad_alloc if no memory could be allocated.
+    HPX_CORE_EXPORT void* allocate_memory(std::size_t bytes,
+        memory_policy const& policy, std::vector<target> const& targets = {});
+
+    /// Free memory previously allocated using allocate_memory with the same
+    /// size and policy.
+    HPX_CORE_EXPORT void deallocate_memory(
+        void* p, std::size_t bytes, memory_policy const& policy) noexcept;
+
+    /// Move the pages of the given memory block to the NUMA domains selected
+    /// by the given policy and targets (all NUMA domains if empty), e.g.
+    /// after the data was rebalanced onto a different set of targets. Pages
+    /// are distributed as for placement_policy::bind if the policy specifies
+    /// first touch placement. Returns false if the pages could not be
+    /// migrated.
+    HPX_CORE_EXPORT bool migrate_memory(void const* p, std::size_t bytes,
+        memory_policy const& policy, std::vector<target> const& targets = {});
+}    // namespace hpx::compute::host
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/compute_local/host/memory_policy.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/futures/future.hpp>
@@ -53,15 +54,22 @@ namespace hpx::parallel::util {
             using other = numa_allocator<U, Executors>;
         };
 
-        numa_allocator(Executors const& executors, hpx::threads::topology& topo)
+        // The memory policy selects the page size used for the allocations.
+        // Pages are touched first by the given executors, explicit placement
+        // policies distribute the pages evenly across all NUMA domains
+        // instead.
+        numa_allocator(Executors const& executors, hpx::threads::topology& topo,
+            compute::host::memory_policy const& policy = {})
           : executors_(executors)
           , topo_(topo)
+          , policy_(policy)
         {
         }
 
         numa_allocator(numa_allocator const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , policy_(rhs.policy_)
         {
         }
 
@@ -71,6 +79,7 @@ namespace hpx::parallel::util {
         numa_allocator(numa_allocator<U, Executors> const& rhs)
           : executors_(rhs.executors_)
           , topo_(rhs.topo_)
+          , policy_(rhs.policy_)
         {
         }
 
@@ -88,7 +97,8 @@ namespace hpx::parallel::util {
         pointer allocate(size_type cnt, void const* = nullptr)
         {
             // allocate memory
-            pointer p = static_cast<pointer>(topo_.allocate(cnt * sizeof(T)));
+            pointer p = static_cast<pointer>(
+                compute::host::allocate_memory(cnt * sizeof(T), policy_));
 
             // first touch policy, distribute evenly onto executors
             std::size_t part_size = cnt / executors_.size();
@@ -143,7 +153,7 @@ namespace hpx::parallel::util {
 
         void deallocate(pointer p, size_type cnt) noexcept
         {
-            topo_.deallocate(p, cnt * sizeof(T));
+            compute::host::deallocate_memory(p, cnt * sizeof(T), policy_);
         }
 
         // size
@@ -180,6 +190,7 @@ namespace hpx::parallel::util {
 
         Executors const& executors_;
         hpx::threads::topology& topo_;
+        compute::host::memory_policy policy_;
     };
 }    // namespace hpx::parallel::util
 // namespace hpx::parallel::util
@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/memory_policy.hpp>
+#include <hpx/compute_local/host/numa_domains.hpp>
+#include <hpx/compute_local/host/target.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <hwloc.h>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/mman.h>
+#define HPX_COMPUTE_HOST_HAVE_MMAP
+#endif
+
+namespace hpx::compute::host {
+
+    namespace {
+
+        constexpr std::size_t default_huge_page_size = 2 * 1024 * 1024;
+
+        constexpr std::size_t round_up(
+            std::size_t value, std::size_t granularity) noexcept
+        {
+            return (value + granularity - 1) / granularity * granularity;
+        }
+
+        // the granularity of the memory binding
+        std::size_t placement_granularity(memory_policy const& policy) noexcept
+        {
+            if (policy.pages == page_size_policy::default_pages)
+                return hpx::threads::get_memory_page_size();
+            return get_huge_page_size();
+        }
+
+        std::size_t allocation_size(
+            std::size_t bytes, memory_policy const& policy) noexcept
+        {
+            if (policy.pages == page_size_policy::default_pages)
+                return bytes;
+            return round_up(bytes, get_huge_page_size());
+        }
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+        void* allocate_huge_pages(
+            std::size_t len, [[maybe_unused]] page_size_policy pages) noexcept
+        {
+            std::size_t const huge_page_size = get_huge_page_size();
+
+#if defined(MAP_HUGETLB)
+            if (pages == page_size_policy::huge_pages)
+            {
+                void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (p != MAP_FAILED)
+                    return p;
+            }
+#endif
+            // Transparent huge pages are used only for suitably aligned
+            // regions, over-allocate and trim the excess.
+            void* p = ::mmap(nullptr, len + huge_page_size,
+                PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+                return nullptr;
+
+            auto const addr = reinterpret_cast<std::uintptr_t>(p);
+            std::uintptr_t const aligned = round_up(addr, huge_page_size);
+            if (aligned != addr)
+                ::munmap(p, aligned - addr);
+
+            std::size_t const tail = addr + huge_page_size - aligned;
+            if (tail != 0)
+                ::munmap(reinterpret_cast<void*>(aligned + len), tail);
+
+#if defined(MADV_HUGEPAGE)
+            ::madvise(reinterpret_cast<void*>(aligned), len, MADV_HUGEPAGE);
+#endif
+            return reinterpret_cast<void*>(aligned);
+        }
+#endif
+
+        hpx::threads::hwloc_bitmap_ptr get_nodeset(
+            hpx::threads::topology const& topo, target const& t)
+        {
+            return topo.cpuset_to_nodeset(t.native_handle().get_device());
+        }
+
+        hpx::threads::hwloc_bitmap_ptr get_nodeset(
+            hpx::threads::topology const& topo,
+            std::vector<target> const& targets)
+        {
+            auto result = std::make_shared<threads::hpx_hwloc_bitmap_wrapper>(
+                hwloc_bitmap_alloc());
+            for (target const& t : targets)
+            {
+                auto const nodeset = get_nodeset(topo, t);
+                hwloc_bitmap_or(
+                    result->get_bmp(), result->get_bmp(), nodeset->get_bmp());
+            }
+            return result;
+        }
+
+        // Bind the memory in blocks of the given size round robin to the
+        // given targets
+        bool bind_blocks(hpx::threads::topology const& topo, char const* p,
+            std::size_t bytes, std::size_t block_size,
+            std::vector<target> const& targets, int flags)
+        {
+            std::vector<threads::hwloc_bitmap_ptr> nodesets;
+            nodesets.reserve(targets.size());
+            for (target const& t : targets)
+                nodesets.push_back(get_nodeset(topo, t));
+
+            bool result = true;
+            std::size_t i = 0;
+            for (std::size_t offset = 0; offset < bytes; offset += block_size)
+            {
+                std::size_t const len = (std::min)(block_size, bytes - offset);
+                if (!topo.set_area_membind(p + offset, len,
+                        nodesets[i++ % nodesets.size()],
+                        threads::hpx_hwloc_membind_policy::membind_bind, flags))
+                {
+                    result = false;
+                }
+            }
+            return result;
+        }
+
+        bool place_memory(void const* p, std::size_t bytes,
+            memory_policy const& policy, std::vector<target> const& targets,
+            bool migrate)
+        {
+            placement_policy placement = policy.placement;
+            if (placement == placement_policy::first_touch)
+            {
+                if (!migrate)
+                    return true;
+
+                // the allocators distribute first touched pages in blocks
+                placement = placement_policy::bind;
+            }
+
+            if (p == nullptr || bytes == 0)
+                return true;
+
+            std::vector<target> const& domains =
+                targets.empty() ? numa_domains() : targets;
+            if (domains.empty())
+                return false;
+
+            auto const& topo = hpx::threads::create_topology();
+            int const flags = migrate ? HWLOC_MEMBIND_MIGRATE : 0;
+            std::size_t const granularity = placement_granularity(policy);
+
+            switch (placement)
+            {
+            case placement_policy::bind:
+                return bind_blocks(topo, static_cast<char const*>(p), bytes,
+                    round_up(
+                        (bytes + domains.size() - 1) / domains.size(),
+                        granularity),
+                    domains, flags);
+
+            case placement_policy::interleave:
+                return topo.set_area_membind(p, bytes,
+                    get_nodeset(topo, domains),
+                    threads::hpx_hwloc_membind_policy::membind_interleave,
+                    flags);
+
+            case placement_policy::block_cyclic:
+                return bind_blocks(topo, static_cast<char const*>(p), bytes,
+                    round_up((std::max)(policy.block_size, granularity),
+                        granularity),
+                    domains, flags);
+
+            default:
+                break;
+            }
+            return true;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t get_huge_page_size() noexcept
+    {
+        static std::size_t const huge_page_size = []() -> std::size_t {
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+            try
+            {
+                std::ifstream meminfo("/proc/meminfo");
+                std::string key;
+                while (meminfo >> key)
+                {
+                    if (key == "Hugepagesize:")
+                    {
+                        std::size_t size = 0;
+                        if (meminfo >> size && size != 0)
+                            return size * 1024;    // given in kB
+                        break;
+                    }
+                    meminfo.ignore(
+                        (std::numeric_limits<std::streamsize>::max)(), '\n');
+                }
+            }
+            catch (...)
+            {
+                // use the default below
+            }
+#endif
+            return default_huge_page_size;
+        }();
+        return huge_page_size;
+    }
+
+    void* allocate_memory(std::size_t bytes, memory_policy const& policy,
+        std::vector<target> const& targets)
+    {
+        std::size_t const len = allocation_size(bytes, policy);
+
+        void* p = nullptr;
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+        if (policy.pages != page_size_policy::default_pages)
+            p = allocate_huge_pages(len, policy.pages);
+        else
+#endif
+            p = hpx::threads::create_topology().allocate(len);
+
+        if (p == nullptr)
+            throw std::bad_alloc();
+
+        // the placement is a hint only, ignore errors
+        place_memory(p, len, policy, targets, false);
+
+        return p;
+    }
+
+    void deallocate_memory(
+        void* p, std::size_t bytes, memory_policy const& policy) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+        if (policy.pages != page_size_policy::default_pages)
+        {
+            ::munmap(p, allocation_size(bytes, policy));
+            return;
+        }
+#endif
+        hpx::threads::create_topology().deallocate(
+            p, allocation_size(bytes, policy));
+    }
+
+    bool migrate_memory(void const* p, std::size_t bytes,
+        memory_policy const& policy, std::vector<target> const& targets)
+    {
+        return place_memory(
+            p, allocation_size(bytes, policy), policy, targets, true);
+    }
+}    // namespace hpx::compute::host
@@ -0,0 +1,143 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/compute_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using hpx::compute::host::memory_policy;
+using hpx::compute::host::page_size_policy;
+using hpx::compute::host::placement_policy;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_huge_page_size()
+{
+    std::size_t const huge_page_size = hpx::compute::host::get_huge_page_size();
+    HPX_TEST_LTE(hpx::threads::get_memory_page_size(), huge_page_size);
+    HPX_TEST_EQ(huge_page_size & (huge_page_size - 1), std::size_t(0));
+}
+
+void test_allocate_memory(memory_policy const& policy, std::size_t count)
+{
+    auto const targets = hpx::compute::host::numa_domains();
+
+    std::size_t const bytes = count * sizeof(std::uint64_t);
+    auto* p = static_cast<std::uint64_t*>(
+        hpx::compute::host::allocate_memory(bytes, policy, targets));
+    HPX_TEST(p != nullptr);
+
+    // huge pages are aligned to the huge page size
+    if (policy.pages != page_size_policy::default_pages)
+    {
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+                hpx::compute::host::get_huge_page_size(),
+            std::uintptr_t(0));
+    }
+
+    for (std::size_t i = 0; i != count; ++i)
+        p[i] = i;
+
+    // migrating the pages may not be supported, it must not affect the data
+    hpx::compute::host::migrate_memory(p, bytes, policy, targets);
+
+    std::size_t errors = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        if (p[i] != i)
+            ++errors;
+    }
+    HPX_TEST_EQ(errors, std::size_t(0));
+
+    hpx::compute::host::deallocate_memory(p, bytes, policy);
+}
+
+void test_block_allocator(memory_policy const& policy, std::size_t count)
+{
+    using allocator_type = hpx::compute::host::block_allocator<int>;
+    using vector_type = hpx::compute::vector<int, allocator_type>;
+
+    auto const numa_nodes = hpx::compute::host::numa_domains();
+    allocator_type alloc(numa_nodes, policy);
+
+    vector_type v(count, 42, alloc);
+    HPX_TEST_EQ(static_cast<std::size_t>(
+                    hpx::count(hpx::execution::par, v.begin(), v.end(), 42)),
+        count);
+
+    // rebalancing must not affect the data
+    alloc.migrate(v.data(), v.size());
+    HPX_TEST_EQ(static_cast<std::size_t>(
+                    hpx::count(hpx::execution::par, v.begin(), v.end(), 42)),
+        count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dis(1, 1024 * 1024);
+
+    test_huge_page_size();
+
+    page_size_policy const pages[] = {page_size_policy::default_pages,
+        page_size_policy::transparent_huge_pages, page_size_policy::huge_pages};
+    placement_policy const placements[] = {placement_policy::first_touch,
+        placement_policy::bind, placement_policy::interleave,
+        placement_policy::block_cyclic};
+
+    for (page_size_policy page : pages)
+    {
+        for (placement_policy placement : placements)
+        {
+            memory_policy const policy(page, placement, 3 * 4096);
+
+            std::size_t const count = dis(gen);
+            test_allocate_memory(policy, count);
+            test_block_allocator(policy, count);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,100 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::util::detail {
+
+    // Reader-writer spinlock. Waiting threads yield to the scheduler (see
+    // yield_while), which makes the lock usable from HPX threads. A writer
+    // waiting for the lock prevents new readers from acquiring it, so that
+    // writers are not starved by a continuous stream of readers.
+    class shared_spinlock
+    {
+    private:
+        static constexpr std::uint32_t writer = 0x80000000;
+        static constexpr std::uint32_t writer_pending = 0x40000000;
+        static constexpr std::uint32_t readers = writer_pending - 1;
+
+    public:
+        constexpr shared_spinlock() noexcept
+          : state_(0)
+        {
+        }
+
+        HPX_NON_COPYABLE(shared_spinlock);
+
+        ~shared_spinlock() = default;
+
+        bool try_lock() noexcept
+        {
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            return (s & (writer | readers)) == 0 &&
+                state_.compare_exchange_strong(
+                    s, writer, std::memory_order_acquire);
+        }
+
+        void lock()
+        {
+            hpx::util::yield_while(
+                [this] {
+                    if (try_lock())
+                    {
+                        return false;
+                    }
+
+                    // announce the waiting writer to stop new readers
+                    if ((state_.load(std::memory_order_relaxed) &
+                            writer_pending) == 0)
+                    {
+                        state_.fetch_or(
+                            writer_pending, std::memory_order_relaxed);
+                    }
+                    return true;
+                },
+                "hpx::util::detail::shared_spinlock::lock");
+        }
+
+        void unlock() noexcept
+        {
+            state_.fetch_and(~writer, std::memory_order_release);
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            while ((s & (writer | writer_pending)) == 0)
+            {
+                if (state_.compare_exchange_weak(
+                        s, s + 1, std::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void lock_shared()
+        {
+            hpx::util::yield_while([this] { return !try_lock_shared(); },
+                "hpx::util::detail::shared_spinlock::lock_shared");
+        }
+
+        void unlock_shared() noexcept
+        {
+            state_.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::uint32_t> state_;
+    };
+}    // namespace hpx::util::detail
@@ -0,0 +1,142 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Epoch based safe memory reclamation for lock-free data structures.
+//
+// Objects that were unlinked from a shared data structure are handed to
+// retire() instead of being deleted. They are deleted once no thread can
+// hold a reference to them anymore, i.e. after every participating thread
+// has either passed through a quiescent state or has released its guard.
+//
+// Two kinds of protection are supported:
+//
+//  - Quiescent state based reclamation (QSBR): the worker threads of the
+//    HPX thread pools report a quiescent state from their scheduling loop
+//    each time they switch between HPX threads. The worker threads join
+//    lazily, once the first object was retired or the first guard was
+//    created, until then the scheduling loops pay a single relaxed load per
+//    iteration only. Code running on an HPX thread may access the protected
+//    objects without any further overhead, as long as it does not suspend
+//    while holding a reference.
+//
+//  - Epoch guards: a guard pins the current epoch for its lifetime. Guards
+//    are required on threads that are not HPX worker threads and for HPX
+//    threads that may suspend while holding references. A guard stays valid
+//    if the HPX thread holding it is resumed on a different worker thread.
+//
+// The deleters of retired objects are invoked from retire(), reclaim(), and
+// from the scheduling loop of the worker threads. They must not suspend.
+namespace hpx::util::epoch {
+
+    namespace detail {
+
+        struct record;
+
+        HPX_CORE_EXPORT record* pin();
+        HPX_CORE_EXPORT void unpin(record* rec) noexcept;
+
+        // set once the first object was retired or the first guard was
+        // created
+        HPX_CORE_EXPORT extern std::atomic<bool> in_use;
+
+        HPX_CORE_EXPORT void worker_quiescent_state();
+    }    // namespace detail
+
+    using deleter_type = void (*)(void*);
+
+    // Protects all objects that are reachable from shared data structures
+    // while the guard is alive.
+    class guard
+    {
+    public:
+        guard()
+          : rec_(detail::pin())
+        {
+        }
+
+        guard(guard const&) = delete;
+        guard(guard&&) = delete;
+        guard& operator=(guard const&) = delete;
+        guard& operator=(guard&&) = delete;
+
+        ~guard()
+        {
+            detail::unpin(rec_);
+        }
+
+    private:
+        detail::record* rec_;
+    };
+
+    // Schedule the given object for deletion. The object must already be
+    // unreachable for threads that start accessing the data structure.
+    HPX_CORE_EXPORT void retire(void* p, deleter_type deleter);
+
+    template <typename T>
+    void retire(T* p)
+    {
+        retire(const_cast<void*>(static_cast<void const*>(p)),
+            [](void* q) { delete static_cast<T*>(q); });
+    }
+
+    // Announce that the calling thread does not hold any references to
+    // protected objects outside of guards. This is called by the scheduling
+    // loop, calling it from an HPX thread also vouches for all HPX threads
+    // suspended on the current worker thread.
+    HPX_CORE_EXPORT void quiescent_state() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Interface for the scheduling loops of the worker threads. A running
+    // worker thread is announced by worker_started, the memory retired from
+    // then on is reclaimed only after the worker has reported a quiescent
+    // state by calling worker_quiescent_state (which registers the worker on
+    // first use). worker_stopped takes the worker out of the reclamation,
+    // e.g. while it is suspended.
+    HPX_CORE_EXPORT void worker_started() noexcept;
+    HPX_CORE_EXPORT void worker_stopped() noexcept;
+
+    inline void worker_quiescent_state()
+    {
+        if (detail::in_use.load(std::memory_order_relaxed))
+        {
+            detail::worker_quiescent_state();
+        }
+    }
+
+    // Register the calling thread as a participant that regularly reports
+    // quiescent states (thread_online) or stop doing so (thread_offline).
+    // Objects are only reclaimed once all online threads have reported a
+    // quiescent state. The calls must not be nested.
+    HPX_CORE_EXPORT void thread_online();
+    HPX_CORE_EXPORT void thread_offline() noexcept;
+
+    // Try to advance the global epoch and delete all objects retired by the
+    // calling thread (and by exited threads) that have become unreachable.
+    // Returns the number of deleted objects.
+    HPX_CORE_EXPORT std::size_t reclaim();
+
+    // Wait until all objects retired before this call can be safely deleted
+    // and delete those retired by the calling thread. Objects retired on
+    // other worker threads are deleted by those threads shortly after. Must
+    // not be called while holding a guard.
+    HPX_CORE_EXPORT void synchronize();
+
+    // The current value of the global epoch.
+    [[nodiscard]] HPX_CORE_EXPORT std::uint64_t current_epoch() noexcept;
+}    // namespace hpx::util::epoch
+
+#include <hpx/config/warnings_suffix.hpp>
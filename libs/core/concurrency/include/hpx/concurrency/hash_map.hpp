@@ -0,0 +1,705 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/shared_spinlock.hpp>
+#include <hpx/datastructures/optional.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::concurrent {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hash map that can be accessed concurrently from any number of
+    // threads.
+    //
+    // The map is split into a power of two number of segments, each of which
+    // is a separately locked hash table. The upper bits of the (mixed) hash
+    // of a key select its segment, so operations on keys in different
+    // segments never contend. Lookups lock their segment in shared mode,
+    // modifications lock it exclusively. A segment grows independently of
+    // all others once its load factor exceeds one. Waiting for a segment
+    // yields to the scheduler, which keeps the map usable from HPX threads.
+    //
+    // The map never hands out references or iterators to its elements.
+    // Elements are returned by value (find) or are accessed through a
+    // function object that is invoked while the segment of the element is
+    // locked (visit, for_each, erase_if). These function objects must not
+    // access the map itself.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>,
+        typename Allocator = std::allocator<std::pair<Key const, T>>>
+    class hash_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+
+    private:
+        struct node
+        {
+            template <typename... Ts>
+            explicit node(std::uint64_t h, Ts&&... ts)
+              : next(nullptr)
+              , hash(h)
+              , value(HPX_FORWARD(Ts, ts)...)
+            {
+            }
+
+            node* next;
+            std::uint64_t hash;
+            value_type value;
+        };
+
+        using node_allocator = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+        using mutex_type = hpx::util::detail::shared_spinlock;
+
+        struct segment
+        {
+            segment() = default;
+
+            mutable mutex_type mtx;
+            std::vector<node*> buckets;
+            unsigned bucket_shift = 64;
+            std::atomic<std::size_t> size{0};
+        };
+
+    public:
+        // by default, the number of segments is four times the number of
+        // cores, rounded up to the next power of two
+        static std::size_t default_concurrency() noexcept
+        {
+            return 4 * (std::max) (std::thread::hardware_concurrency(), 1u);
+        }
+
+        explicit hash_map(size_type bucket_count = 0,
+            std::size_t concurrency = default_concurrency(),
+            hasher const& hf = hasher(), key_equal const& equal = key_equal(),
+            allocator_type const& alloc = allocator_type())
+          : hash_(hf)
+          , equal_(equal)
+          , alloc_(alloc)
+        {
+            while ((std::size_t(1) << segment_bits_) < concurrency &&
+                segment_bits_ < max_segment_bits)
+            {
+                ++segment_bits_;
+            }
+
+            segments_.reset(new segment_type[num_segments()]);
+            reserve(bucket_count);
+        }
+
+        // clang-format off
+        template <typename InputIter,
+            HPX_CONCEPT_REQUIRES_(
+                !std::is_integral_v<InputIter>
+            )>
+        // clang-format on
+        hash_map(InputIter first, InputIter last, size_type bucket_count = 0,
+            std::size_t concurrency = default_concurrency(),
+            hasher const& hf = hasher(), key_equal const& equal = key_equal(),
+            allocator_type const& alloc = allocator_type())
+          : hash_map(bucket_count, concurrency, hf, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        HPX_NON_COPYABLE(hash_map);
+
+        ~hash_map()
+        {
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                clear_segment(segments_[i].data_);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // capacity
+
+        // The number of elements, not synchronized with concurrent
+        // modifications.
+        [[nodiscard]] size_type size() const noexcept
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                result +=
+                    segments_[i].data_.size.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] size_type bucket_count() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                segment const& s = segments_[i].data_;
+                std::shared_lock<mutex_type> l(s.mtx);
+                result += s.buckets.size();
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::size_t num_segments() const noexcept
+        {
+            return std::size_t(1) << segment_bits_;
+        }
+
+        // make sure that count elements can be stored without growing any
+        // segment, assuming the keys are evenly distributed
+        void reserve(size_type count)
+        {
+            std::size_t const per_segment =
+                (count + num_segments() - 1) / num_segments();
+
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                segment& s = segments_[i].data_;
+                std::unique_lock<mutex_type> l(s.mtx);
+                if (s.buckets.size() < per_segment)
+                {
+                    rehash(s, per_segment);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // modifiers, the single element versions return whether an element
+        // was inserted
+
+        bool insert(value_type const& value)
+        {
+            return emplace_node(create_node(value));
+        }
+
+        bool insert(value_type&& value)
+        {
+            return emplace_node(create_node(HPX_MOVE(value)));
+        }
+
+        template <typename... Ts>
+        bool emplace(Ts&&... ts)
+        {
+            return emplace_node(create_node(HPX_FORWARD(Ts, ts)...));
+        }
+
+        // does not construct the element if the key is already present
+        template <typename... Ts>
+        bool try_emplace(key_type const& key, Ts&&... ts)
+        {
+            std::uint64_t const h = hash(key);
+            segment& s = segment_for(h);
+
+            std::unique_lock<mutex_type> l(s.mtx);
+            if (find_node(s, h, key) != nullptr)
+            {
+                return false;
+            }
+
+            node* n = create_node_hashed(h, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+            link_node(s, n);
+            return true;
+        }
+
+        template <typename M>
+        bool insert_or_assign(key_type const& key, M&& obj)
+        {
+            std::uint64_t const h = hash(key);
+            segment& s = segment_for(h);
+
+            std::unique_lock<mutex_type> l(s.mtx);
+            if (node* n = find_node(s, h, key); n != nullptr)
+            {
+                n->value.second = HPX_FORWARD(M, obj);
+                return false;
+            }
+
+            link_node(s, create_node_hashed(h, key, HPX_FORWARD(M, obj)));
+            return true;
+        }
+
+        // Insert all elements of [first, last), returns the number of
+        // inserted elements. The elements are allocated and sorted by segment
+        // before any locks are acquired, each segment is locked once.
+        template <typename InputIter>
+        size_type insert(InputIter first, InputIter last)
+        {
+            std::vector<node*> pending(num_segments(), nullptr);
+            for (/**/; first != last; ++first)
+            {
+                node* n = create_node(*first);
+                node*& head = pending[segment_index(n->hash)];
+                n->next = head;
+                head = n;
+            }
+
+            size_type inserted = 0;
+            node* duplicates = nullptr;
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                node* n = pending[i];
+                if (n == nullptr)
+                {
+                    continue;
+                }
+
+                segment& s = segments_[i].data_;
+                std::unique_lock<mutex_type> l(s.mtx);
+                while (n != nullptr)
+                {
+                    node* next = n->next;
+                    if (find_node(s, n->hash, n->value.first) == nullptr)
+                    {
+                        link_node(s, n);
+                        ++inserted;
+                    }
+                    else
+                    {
+                        n->next = duplicates;
+                        duplicates = n;
+                    }
+                    n = next;
+                }
+            }
+
+            // release the rejected nodes after all locks are released
+            destroy_nodes(duplicates);
+            return inserted;
+        }
+
+        // returns the number of erased elements
+        size_type erase(key_type const& key)
+        {
+            std::uint64_t const h = hash(key);
+            segment& s = segment_for(h);
+
+            node* n = nullptr;
+            {
+                std::unique_lock<mutex_type> l(s.mtx);
+                if (s.buckets.empty())
+                {
+                    return 0;
+                }
+
+                for (node** p = &s.buckets[bucket_index(s, h)]; *p != nullptr;
+                     p = &(*p)->next)
+                {
+                    if ((*p)->hash == h && equal_((*p)->value.first, key))
+                    {
+                        n = *p;
+                        *p = n->next;
+                        s.size.fetch_sub(1, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            }
+
+            if (n == nullptr)
+            {
+                return 0;
+            }
+
+            destroy_node(n);
+            return 1;
+        }
+
+        // Erase all elements for which pred(value_type const&) returns true,
+        // returns the number of erased elements.
+        template <typename Pred>
+        size_type erase_if(Pred&& pred)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                segment& s = segments_[i].data_;
+
+                node* removed = nullptr;
+                {
+                    std::unique_lock<mutex_type> l(s.mtx);
+                    for (node*& bucket : s.buckets)
+                    {
+                        node** p = &bucket;
+                        while (*p != nullptr)
+                        {
+                            node* n = *p;
+                            if (pred(std::as_const(n->value)))
+                            {
+                                *p = n->next;
+                                n->next = removed;
+                                removed = n;
+                                s.size.fetch_sub(1, std::memory_order_relaxed);
+                                ++erased;
+                            }
+                            else
+                            {
+                                p = &n->next;
+                            }
+                        }
+                    }
+                }
+                destroy_nodes(removed);
+            }
+            return erased;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                clear_segment(segments_[i].data_);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // lookup
+
+        // return a copy of the value stored for the given key
+        [[nodiscard]] hpx::optional<mapped_type> find(
+            key_type const& key) const
+        {
+            std::uint64_t const h = hash(key);
+            segment const& s = segment_for(h);
+
+            std::shared_lock<mutex_type> l(s.mtx);
+            if (node const* n = find_node(s, h, key); n != nullptr)
+            {
+                return hpx::optional<mapped_type>(n->value.second);
+            }
+            return hpx::optional<mapped_type>();
+        }
+
+        [[nodiscard]] bool contains(key_type const& key) const
+        {
+            std::uint64_t const h = hash(key);
+            segment const& s = segment_for(h);
+
+            std::shared_lock<mutex_type> l(s.mtx);
+            return find_node(s, h, key) != nullptr;
+        }
+
+        [[nodiscard]] size_type count(key_type const& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        // Invoke f(value_type&) for the element with the given key while its
+        // segment is locked exclusively, returns whether the key was found.
+        template <typename F>
+        bool visit(key_type const& key, F&& f)
+        {
+            std::uint64_t const h = hash(key);
+            segment& s = segment_for(h);
+
+            std::unique_lock<mutex_type> l(s.mtx);
+            if (node* n = find_node(s, h, key); n != nullptr)
+            {
+                f(n->value);
+                return true;
+            }
+            return false;
+        }
+
+        // Invoke f(value_type const&) for the element with the given key
+        // while its segment is locked in shared mode, returns whether the
+        // key was found.
+        template <typename F>
+        bool visit(key_type const& key, F&& f) const
+        {
+            std::uint64_t const h = hash(key);
+            segment const& s = segment_for(h);
+
+            std::shared_lock<mutex_type> l(s.mtx);
+            if (node const* n = find_node(s, h, key); n != nullptr)
+            {
+                f(n->value);
+                return true;
+            }
+            return false;
+        }
+
+        // Invoke f(value_type&) for all elements. One segment is locked at a
+        // time, concurrent modifications are allowed. Elements that are
+        // neither inserted nor erased concurrently are visited exactly once.
+        template <typename F>
+        void for_each(F&& f)
+        {
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                segment& s = segments_[i].data_;
+                std::unique_lock<mutex_type> l(s.mtx);
+                for (node* bucket : s.buckets)
+                {
+                    for (node* n = bucket; n != nullptr; n = n->next)
+                    {
+                        f(n->value);
+                    }
+                }
+            }
+        }
+
+        // Invoke f(value_type const&) for all elements, see above.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (std::size_t i = 0; i != num_segments(); ++i)
+            {
+                segment const& s = segments_[i].data_;
+                std::shared_lock<mutex_type> l(s.mtx);
+                for (node const* bucket : s.buckets)
+                {
+                    for (node const* n = bucket; n != nullptr; n = n->next)
+                    {
+                        f(std::as_const(n->value));
+                    }
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] hasher hash_function() const
+        {
+            return hash_;
+        }
+
+        [[nodiscard]] key_equal key_eq() const
+        {
+            return equal_;
+        }
+
+        [[nodiscard]] allocator_type get_allocator() const
+        {
+            return allocator_type(alloc_);
+        }
+
+    private:
+        using segment_type = hpx::util::cache_aligned_data<segment>;
+
+        static constexpr std::size_t max_segment_bits = 16;
+
+        // mix the bits of the hash (Fibonacci hashing), segments and buckets
+        // are selected using the upper bits of the result
+        std::uint64_t hash(key_type const& key) const
+        {
+            return static_cast<std::uint64_t>(hash_(key)) *
+                0x9E3779B97F4A7C15ull;
+        }
+
+        std::size_t segment_index(std::uint64_t h) const noexcept
+        {
+            return segment_bits_ == 0 ?
+                0 :
+                static_cast<std::size_t>(h >> (64 - segment_bits_));
+        }
+
+        segment& segment_for(std::uint64_t h) noexcept
+        {
+            return segments_[segment_index(h)].data_;
+        }
+
+        segment const& segment_for(std::uint64_t h) const noexcept
+        {
+            return segments_[segment_index(h)].data_;
+        }
+
+        // the bucket count of each segment is a power of two, the bits
+        // following the segment bits select the bucket
+        std::size_t bucket_index(
+            segment const& s, std::uint64_t h) const noexcept
+        {
+            HPX_ASSERT(!s.buckets.empty());
+            return static_cast<std::size_t>(
+                (h << segment_bits_) >> s.bucket_shift);
+        }
+
+        node* find_node(segment const& s, std::uint64_t h,
+            key_type const& key) const
+        {
+            if (s.buckets.empty())
+            {
+                return nullptr;
+            }
+
+            for (node* n = s.buckets[bucket_index(s, h)]; n != nullptr;
+                 n = n->next)
+            {
+                if (n->hash == h && equal_(n->value.first, key))
+                {
+                    return n;
+                }
+            }
+            return nullptr;
+        }
+
+        // the segment has to be locked exclusively
+        void link_node(segment& s, node* n)
+        {
+            std::size_t const size = s.size.load(std::memory_order_relaxed);
+            if (size >= s.buckets.size())
+            {
+                rehash(s, 2 * s.buckets.size());
+            }
+
+            node*& bucket = s.buckets[bucket_index(s, n->hash)];
+            n->next = bucket;
+            bucket = n;
+            s.size.store(size + 1, std::memory_order_relaxed);
+        }
+
+        bool emplace_node(node* n)
+        {
+            segment& s = segment_for(n->hash);
+            {
+                std::unique_lock<mutex_type> l(s.mtx);
+                if (find_node(s, n->hash, n->value.first) == nullptr)
+                {
+                    link_node(s, n);
+                    return true;
+                }
+            }
+
+            destroy_node(n);
+            return false;
+        }
+
+        // the segment has to be locked exclusively
+        void rehash(segment& s, std::size_t count)
+        {
+            unsigned bits = 3;
+            while ((std::size_t(1) << bits) < count)
+            {
+                ++bits;
+            }
+
+            std::vector<node*> old_buckets(std::size_t(1) << bits, nullptr);
+            std::swap(s.buckets, old_buckets);
+            s.bucket_shift = 64 - bits;
+
+            for (node* bucket : old_buckets)
+            {
+                while (bucket != nullptr)
+                {
+                    node* next = bucket->next;
+                    node*& b = s.buckets[bucket_index(s, bucket->hash)];
+                    bucket->next = b;
+                    b = bucket;
+                    bucket = next;
+                }
+            }
+        }
+
+        void clear_segment(segment& s)
+        {
+            node* removed = nullptr;
+            {
+                std::unique_lock<mutex_type> l(s.mtx);
+                for (node*& bucket : s.buckets)
+                {
+                    while (bucket != nullptr)
+                    {
+                        node* n = bucket;
+                        bucket = n->next;
+                        n->next = removed;
+                        removed = n;
+                    }
+                }
+                s.size.store(0, std::memory_order_relaxed);
+            }
+            destroy_nodes(removed);
+        }
+
+        template <typename... Ts>
+        node* create_node(Ts&&... ts)
+        {
+            node* n = node_traits::allocate(alloc_, 1);
+            try
+            {
+                node_traits::construct(alloc_, n, 0, HPX_FORWARD(Ts, ts)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc_, n, 1);
+                throw;
+            }
+            n->hash = hash(n->value.first);
+            return n;
+        }
+
+        template <typename... Ts>
+        node* create_node_hashed(std::uint64_t h, Ts&&... ts)
+        {
+            node* n = node_traits::allocate(alloc_, 1);
+            try
+            {
+                node_traits::construct(alloc_, n, h, HPX_FORWARD(Ts, ts)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc_, n, 1);
+                throw;
+            }
+            return n;
+        }
+
+        void destroy_node(node* n) noexcept
+        {
+            node_traits::destroy(alloc_, n);
+            node_traits::deallocate(alloc_, n, 1);
+        }
+
+        void destroy_nodes(node* n) noexcept
+        {
+            while (n != nullptr)
+            {
+                node* next = n->next;
+                destroy_node(n);
+                n = next;
+            }
+        }
+
+    private:
+        hasher hash_;
+        key_equal equal_;
+        node_allocator alloc_;
+
+        unsigned segment_bits_ = 0;
+        std::unique_ptr<segment_type[]> segments_;
+    };
+}    // namespace hpx::concurrent
@@ -0,0 +1,496 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/epoch.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::util::epoch::detail {
+
+    std::atomic<bool> in_use(false);
+
+    struct retired_object
+    {
+        void* object;
+        deleter_type deleter;
+        std::uint64_t epoch;
+    };
+
+    // Every thread that participates in the reclamation owns a record. The
+    // epoch announced in a record is taken into account while the owning
+    // thread is online or while the record is pinned by a guard. Records are
+    // never freed while the process is running, records of exited threads
+    // are reused.
+    struct record
+    {
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<std::uint32_t> pins{0};
+        std::atomic<bool> online{false};
+        std::atomic<bool> in_use{true};
+        record* next = nullptr;
+
+        // only accessed by the owning thread, ordered by epoch
+        std::vector<retired_object> retired;
+        std::size_t retire_count = 0;
+        std::uint32_t quiescent_count = 0;
+    };
+
+    namespace {
+
+        // number of retired objects between two attempts to reclaim memory
+        constexpr std::size_t reclaim_interval = 64;
+
+        // number of quiescent states between two attempts to reclaim memory
+        // if the worker thread has pending retired objects
+        constexpr std::uint32_t quiescent_interval = 64;
+
+        using padded_record = hpx::util::cache_aligned_data_derived<record>;
+
+        std::size_t delete_objects(retired_object const* first,
+            retired_object const* last) noexcept
+        {
+            for (auto const* it = first; it != last; ++it)
+            {
+                it->deleter(it->object);
+            }
+            return static_cast<std::size_t>(last - first);
+        }
+
+        class domain
+        {
+        public:
+            domain() = default;
+
+            domain(domain const&) = delete;
+            domain(domain&&) = delete;
+            domain& operator=(domain const&) = delete;
+            domain& operator=(domain&&) = delete;
+
+            ~domain()
+            {
+                // all threads have exited at this point, delete whatever is
+                // left
+                record* rec = records_.load(std::memory_order_acquire);
+                while (rec != nullptr)
+                {
+                    record* next = rec->next;
+                    delete_objects(rec->retired.data(),
+                        rec->retired.data() + rec->retired.size());
+                    delete static_cast<padded_record*>(rec);
+                    rec = next;
+                }
+                delete_objects(
+                    orphans_.data(), orphans_.data() + orphans_.size());
+            }
+
+            record* acquire()
+            {
+                // reuse the record of an exited thread, if possible
+                for (record* rec = records_.load(std::memory_order_acquire);
+                    rec != nullptr; rec = rec->next)
+                {
+                    bool expected = false;
+                    if (!rec->in_use.load(std::memory_order_relaxed) &&
+                        rec->in_use.compare_exchange_strong(
+                            expected, true, std::memory_order_acquire))
+                    {
+                        return rec;
+                    }
+                }
+
+                record* rec = new padded_record();
+                rec->next = records_.load(std::memory_order_relaxed);
+                while (!records_.compare_exchange_weak(rec->next, rec,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+                return rec;
+            }
+
+            void release(record* rec)
+            {
+                rec->online.store(false, std::memory_order_release);
+                collect(rec);
+
+                // hand the remaining objects to the other threads
+                if (!rec->retired.empty())
+                {
+                    std::lock_guard<hpx::util::spinlock> l(orphans_mtx_);
+                    orphans_.insert(orphans_.end(), rec->retired.begin(),
+                        rec->retired.end());
+                }
+                rec->retired.clear();
+                rec->retired.shrink_to_fit();
+                rec->retire_count = 0;
+                rec->quiescent_count = 0;
+
+                rec->in_use.store(false, std::memory_order_release);
+            }
+
+            std::uint64_t current() const noexcept
+            {
+                return global_epoch_.load(std::memory_order_seq_cst);
+            }
+
+            // Publish the current epoch in the given record. The epoch is
+            // re-read after publishing it, to make sure that no thread could
+            // have advanced past it without taking the record into account.
+            void announce(record* rec) noexcept
+            {
+                std::uint64_t e = current();
+                rec->epoch.store(e, std::memory_order_seq_cst);
+                for (std::uint64_t next = current(); next != e;
+                    next = current())
+                {
+                    e = next;
+                    rec->epoch.store(e, std::memory_order_seq_cst);
+                }
+            }
+
+            // The epoch can be advanced once all active records have
+            // announced the current epoch.
+            bool try_advance() noexcept
+            {
+                // Worker threads join lazily, a worker that has not reported
+                // a quiescent state yet may be running an HPX thread holding
+                // unguarded references. Reading the online workers first
+                // makes sure that a worker going online concurrently is not
+                // mistaken for the one that has not.
+                std::size_t const online =
+                    online_workers_.load(std::memory_order_seq_cst);
+                if (online < workers_.load(std::memory_order_seq_cst))
+                {
+                    return false;
+                }
+
+                std::uint64_t e = current();
+                for (record* rec = records_.load(std::memory_order_acquire);
+                    rec != nullptr; rec = rec->next)
+                {
+                    bool const active =
+                        rec->online.load(std::memory_order_seq_cst) ||
+                        rec->pins.load(std::memory_order_seq_cst) != 0;
+                    if (active &&
+                        rec->epoch.load(std::memory_order_seq_cst) != e)
+                    {
+                        return false;
+                    }
+                }
+                return global_epoch_.compare_exchange_strong(
+                    e, e + 1, std::memory_order_seq_cst);
+            }
+
+            // Objects retired during epoch e might still be referenced by
+            // threads that announced e. Once the global epoch has reached
+            // e + 2, all of those threads have moved on.
+            static bool is_safe(
+                retired_object const& obj, std::uint64_t e) noexcept
+            {
+                return obj.epoch + 2 <= e;
+            }
+
+            std::size_t collect(record* rec)
+            {
+                try_advance();
+                std::uint64_t const e = current();
+
+                std::size_t deleted = 0;
+                auto& retired = rec->retired;
+                if (!retired.empty() && is_safe(retired.front(), e))
+                {
+                    auto const last = std::find_if(retired.begin(),
+                        retired.end(), [e](retired_object const& obj) {
+                            return !is_safe(obj, e);
+                        });
+
+                    // the deleters may retire further objects, detach the
+                    // range to delete first
+                    std::vector<retired_object> safe(retired.begin(), last);
+                    retired.erase(retired.begin(), last);
+                    deleted +=
+                        delete_objects(safe.data(), safe.data() + safe.size());
+                }
+
+                return deleted + collect_orphans(e);
+            }
+
+            void worker_started() noexcept
+            {
+                workers_.fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            void worker_stopped() noexcept
+            {
+                workers_.fetch_sub(1, std::memory_order_seq_cst);
+            }
+
+            void worker_online() noexcept
+            {
+                online_workers_.fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            void worker_offline() noexcept
+            {
+                online_workers_.fetch_sub(1, std::memory_order_seq_cst);
+            }
+
+            void retire(record* rec, retired_object obj)
+            {
+                rec->retired.push_back(obj);
+                if (++rec->retire_count % reclaim_interval == 0)
+                {
+                    collect(rec);
+                }
+            }
+
+        private:
+            std::size_t collect_orphans(std::uint64_t e)
+            {
+                std::vector<retired_object> safe;
+                {
+                    std::unique_lock<hpx::util::spinlock> l(
+                        orphans_mtx_, std::try_to_lock);
+                    if (!l.owns_lock() || orphans_.empty())
+                    {
+                        return 0;
+                    }
+
+                    auto const last = std::partition(orphans_.begin(),
+                        orphans_.end(), [e](retired_object const& obj) {
+                            return is_safe(obj, e);
+                        });
+                    safe.assign(orphans_.begin(), last);
+                    orphans_.erase(orphans_.begin(), last);
+                }
+                return delete_objects(safe.data(), safe.data() + safe.size());
+            }
+
+            std::atomic<std::uint64_t> global_epoch_{0};
+            std::atomic<record*> records_{nullptr};
+
+            // number of running worker threads and the number of those that
+            // have joined the reclamation
+            std::atomic<std::size_t> workers_{0};
+            std::atomic<std::size_t> online_workers_{0};
+
+            hpx::util::spinlock orphans_mtx_;
+            std::vector<retired_object> orphans_;
+        };
+
+        domain& get_domain()
+        {
+            static domain d;
+            return d;
+        }
+
+        // the record of the calling thread, released when the thread exits
+        struct local_record
+        {
+            local_record() = default;
+
+            local_record(local_record const&) = delete;
+            local_record(local_record&&) = delete;
+            local_record& operator=(local_record const&) = delete;
+            local_record& operator=(local_record&&) = delete;
+
+            ~local_record()
+            {
+                if (rec != nullptr)
+                {
+                    get_domain().release(rec);
+                }
+            }
+
+            record* rec = nullptr;
+
+            // the calling thread is a worker thread that has joined the
+            // reclamation
+            bool worker_online = false;
+        };
+
+        local_record& get_local()
+        {
+            thread_local local_record local;
+            return local;
+        }
+
+        record* get_record()
+        {
+            local_record& local = get_local();
+            if (local.rec == nullptr)
+            {
+                // make sure the domain outlives all thread local records
+                domain& d = get_domain();
+                local.rec = d.acquire();
+            }
+            return local.rec;
+        }
+
+        void mark_in_use() noexcept
+        {
+            if (!in_use.load(std::memory_order_relaxed))
+            {
+                in_use.store(true, std::memory_order_seq_cst);
+            }
+        }
+    }    // namespace
+
+    record* pin()
+    {
+        mark_in_use();
+        record* rec = get_record();
+
+        // Only the first guard of an offline record announces the current
+        // epoch. The epoch of an online record was announced by the last
+        // quiescent state of the worker thread, moving it forward here would
+        // invalidate unguarded references held by the running HPX thread.
+        if (rec->pins.fetch_add(1, std::memory_order_seq_cst) == 0 &&
+            !rec->online.load(std::memory_order_relaxed))
+        {
+            get_domain().announce(rec);
+        }
+        return rec;
+    }
+
+    // The guard may be released on a different worker thread than the one
+    // it was created on, the record it pinned is released regardless.
+    void unpin(record* rec) noexcept
+    {
+        HPX_ASSERT(rec->pins.load(std::memory_order_relaxed) != 0);
+        rec->pins.fetch_sub(1, std::memory_order_release);
+    }
+
+    void worker_quiescent_state()
+    {
+        local_record& local = get_local();
+        if (!local.worker_online)
+        {
+            // the scheduling loop doesn't run an HPX thread at this point,
+            // it is safe to join with the current epoch
+            thread_online();
+            local.worker_online = true;
+            get_domain().worker_online();
+        }
+        quiescent_state();
+    }
+}    // namespace hpx::util::epoch::detail
+
+namespace hpx::util::epoch {
+
+    void retire(void* p, deleter_type deleter)
+    {
+        detail::mark_in_use();
+
+        auto& d = detail::get_domain();
+        d.retire(detail::get_record(), {p, deleter, d.current()});
+    }
+
+    void quiescent_state() noexcept
+    {
+        detail::record* rec = detail::get_local().rec;
+        if (rec == nullptr || !rec->online.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // a guard created by a suspended HPX thread keeps the epoch of this
+        // record from moving forward
+        auto& d = detail::get_domain();
+        std::uint64_t const e = d.current();
+        if (rec->epoch.load(std::memory_order_relaxed) != e &&
+            rec->pins.load(std::memory_order_acquire) == 0)
+        {
+            rec->epoch.store(e, std::memory_order_release);
+        }
+
+        if (!rec->retired.empty() &&
+            ++rec->quiescent_count % detail::quiescent_interval == 0)
+        {
+            d.collect(rec);
+        }
+    }
+
+    void worker_started() noexcept
+    {
+        detail::get_domain().worker_started();
+    }
+
+    void worker_stopped() noexcept
+    {
+        detail::local_record& local = detail::get_local();
+        if (local.worker_online)
+        {
+            thread_offline();
+            local.worker_online = false;
+            detail::get_domain().worker_offline();
+        }
+        detail::get_domain().worker_stopped();
+    }
+
+    void thread_online()
+    {
+        detail::record* rec = detail::get_record();
+        HPX_ASSERT(!rec->online.load(std::memory_order_relaxed));
+
+        auto& d = detail::get_domain();
+        if (rec->pins.load(std::memory_order_acquire) == 0)
+        {
+            d.announce(rec);
+        }
+        rec->online.store(true, std::memory_order_seq_cst);
+    }
+
+    void thread_offline() noexcept
+    {
+        detail::record* rec = detail::get_local().rec;
+        if (rec != nullptr)
+        {
+            rec->online.store(false, std::memory_order_release);
+        }
+    }
+
+    std::size_t reclaim()
+    {
+        return detail::get_domain().collect(detail::get_record());
+    }
+
+    void synchronize()
+    {
+        // the worker threads have to join the reclamation for the epoch to
+        // move forward
+        detail::mark_in_use();
+
+        auto& d = detail::get_domain();
+
+        std::uint64_t const target = d.current() + 2;
+        hpx::util::yield_while(
+            [&] {
+                quiescent_state();
+                d.try_advance();
+                return d.current() < target;
+            },
+            "hpx::util::epoch::synchronize");
+
+        // the calling HPX thread may have been resumed on a different worker
+        d.collect(detail::get_record());
+    }
+
+    std::uint64_t current_epoch() noexcept
+    {
+        return detail::get_domain().current();
+    }
+}    // namespace hpx::util::epoch
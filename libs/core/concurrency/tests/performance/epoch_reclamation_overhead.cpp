@@ -0,0 +1,345 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the overhead of the safe memory reclamation schemes on a read-mostly
+// workload: a number of HPX threads read a shared object through an atomic
+// pointer, a fraction of the operations replace the object and retire the old
+// one. The following schemes are compared:
+//
+//  - leak:   retired objects are never deleted (no protection at all)
+//  - qsbr:   hpx::util::epoch without guards, quiescent states are reported
+//            by the scheduling loop
+//  - guard:  hpx::util::epoch with a guard around each operation
+//  - hazard: a straightforward hazard pointer implementation
+
+#include <hpx/assert.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/epoch.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct payload
+{
+    explicit payload(std::uint64_t v) noexcept
+    {
+        for (auto& value : values)
+        {
+            value = v;
+        }
+    }
+
+    std::uint64_t sum() const noexcept
+    {
+        std::uint64_t result = 0;
+        for (auto value : values)
+        {
+            result += value;
+        }
+        return result;
+    }
+
+    std::uint64_t values[8];
+};
+
+std::atomic<payload*> shared_object{nullptr};
+
+///////////////////////////////////////////////////////////////////////////////
+struct leak_scheme
+{
+    static constexpr char const* name = "leak:   ";
+
+    ~leak_scheme()
+    {
+        for (payload* p : retired)
+        {
+            delete p;
+        }
+    }
+
+    template <typename F>
+    std::uint64_t read(F&& f)
+    {
+        return f(shared_object.load(std::memory_order_acquire));
+    }
+
+    void retire(payload* p)
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        retired.push_back(p);
+    }
+
+    std::mutex mtx;
+    std::vector<payload*> retired;
+};
+
+struct qsbr_scheme
+{
+    static constexpr char const* name = "qsbr:   ";
+
+    template <typename F>
+    std::uint64_t read(F&& f)
+    {
+        return f(shared_object.load(std::memory_order_acquire));
+    }
+
+    void retire(payload* p)
+    {
+        hpx::util::epoch::retire(p);
+    }
+};
+
+struct guard_scheme
+{
+    static constexpr char const* name = "guard:  ";
+
+    template <typename F>
+    std::uint64_t read(F&& f)
+    {
+        hpx::util::epoch::guard g;
+        return f(shared_object.load(std::memory_order_acquire));
+    }
+
+    void retire(payload* p)
+    {
+        hpx::util::epoch::retire(p);
+    }
+};
+
+// One hazard pointer per OS thread. The HPX threads do not suspend while
+// holding a hazard pointer, so they can use the slot of the worker thread
+// they are running on.
+struct hazard_scheme
+{
+    static constexpr char const* name = "hazard: ";
+    static constexpr std::size_t max_slots = 256;
+    static constexpr std::size_t scan_threshold = 2 * max_slots;
+
+    struct slot
+    {
+        std::atomic<payload*> hazard{nullptr};
+        std::vector<payload*> retired;
+    };
+
+    hazard_scheme()
+      : slots(new hpx::util::cache_aligned_data<slot>[max_slots])
+    {
+    }
+
+    ~hazard_scheme()
+    {
+        for (std::size_t i = 0; i != max_slots; ++i)
+        {
+            for (payload* p : slots[i].data_.retired)
+            {
+                delete p;
+            }
+        }
+    }
+
+    // the slots are assigned once per OS thread, for all instances
+    static std::size_t local_index()
+    {
+        static std::atomic<std::size_t> next_index(0);
+        thread_local std::size_t const index = next_index++;
+        HPX_ASSERT(index < max_slots);
+        return index;
+    }
+
+    slot& local_slot()
+    {
+        return slots[local_index()].data_;
+    }
+
+    template <typename F>
+    std::uint64_t read(F&& f)
+    {
+        auto& hazard = local_slot().hazard;
+        payload* p = shared_object.load(std::memory_order_acquire);
+        while (true)
+        {
+            hazard.store(p, std::memory_order_seq_cst);
+            payload* q = shared_object.load(std::memory_order_seq_cst);
+            if (p == q)
+            {
+                break;
+            }
+            p = q;
+        }
+
+        std::uint64_t const result = f(p);
+        hazard.store(nullptr, std::memory_order_release);
+        return result;
+    }
+
+    void retire(payload* p)
+    {
+        auto& retired = local_slot().retired;
+        retired.push_back(p);
+        if (retired.size() < scan_threshold)
+        {
+            return;
+        }
+
+        std::vector<payload*> hazards;
+        for (std::size_t i = 0; i != max_slots; ++i)
+        {
+            if (payload* h = slots[i].data_.hazard.load())
+            {
+                hazards.push_back(h);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        auto const last = std::partition(
+            retired.begin(), retired.end(), [&](payload* r) {
+                return std::binary_search(hazards.begin(), hazards.end(), r);
+            });
+        for (auto it = last; it != retired.end(); ++it)
+        {
+            delete *it;
+        }
+        retired.erase(last, retired.end());
+    }
+
+    std::unique_ptr<hpx::util::cache_aligned_data<slot>[]> slots;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Scheme>
+std::uint64_t run_operations(Scheme& scheme, std::size_t ops,
+    unsigned writes_per_mille, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<unsigned> dis(0, 999);
+
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i != ops; ++i)
+    {
+        if (dis(gen) < writes_per_mille)
+        {
+            payload* old = shared_object.exchange(
+                new payload(i), std::memory_order_acq_rel);
+            scheme.retire(old);
+        }
+        else
+        {
+            result += scheme.read([](payload const* p) { return p->sum(); });
+        }
+    }
+    return result;
+}
+
+// returns the average time per operation in nanoseconds
+template <typename Scheme>
+double measure(
+    std::size_t num_tasks, std::size_t ops, unsigned writes_per_mille)
+{
+    Scheme scheme;
+    shared_object = new payload(0);
+
+    std::vector<hpx::future<std::uint64_t>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::chrono::high_resolution_timer const t;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&scheme, i, ops, writes_per_mille]() {
+            return run_operations(
+                scheme, ops, writes_per_mille, static_cast<unsigned>(i));
+        }));
+    }
+    hpx::wait_all(tasks);
+    double const elapsed = t.elapsed();
+
+    scheme.retire(shared_object.exchange(nullptr));
+    hpx::util::epoch::synchronize();
+
+    return elapsed * 1e9 / static_cast<double>(ops);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_tasks = vm["tasks"].as<std::size_t>();
+    if (num_tasks == 0)
+    {
+        num_tasks = hpx::get_os_thread_count();
+    }
+
+    std::size_t const ops = vm["operations"].as<std::size_t>();
+    unsigned const writes = vm["writes"].as<unsigned>();
+    int const iterations = vm["iterations"].as<int>();
+
+    std::cout << "tasks: " << num_tasks << ", operations per task: " << ops
+              << ", writes per 1000 operations: " << writes << '\n';
+
+    double leak = 0.0;
+    double qsbr = 0.0;
+    double guard = 0.0;
+    double hazard = 0.0;
+    for (int i = 0; i != iterations; ++i)
+    {
+        leak += measure<leak_scheme>(num_tasks, ops, writes);
+        qsbr += measure<qsbr_scheme>(num_tasks, ops, writes);
+        guard += measure<guard_scheme>(num_tasks, ops, writes);
+        hazard += measure<hazard_scheme>(num_tasks, ops, writes);
+    }
+
+    std::cout << leak_scheme::name << leak / iterations << " ns/op\n"
+              << qsbr_scheme::name << qsbr / iterations << " ns/op\n"
+              << guard_scheme::name << guard / iterations << " ns/op\n"
+              << hazard_scheme::name << hazard / iterations << " ns/op\n";
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks (default: number of cores)")
+        ("operations", value<std::size_t>()->default_value(10000000),
+         "number of operations executed by each task")
+        ("writes", value<unsigned>()->default_value(1),
+         "number of writes per 1000 operations")
+        ("iterations", value<int>()->default_value(3),
+         "number of iterations to average")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    // Initialize and run HPX.
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,191 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of hpx::concurrent::hash_map for a read-heavy and a
+// write-heavy mix of operations executed concurrently by a number of HPX
+// threads. A std::unordered_map protected by a single spinlock is measured
+// for comparison.
+
+#include <hpx/chrono.hpp>
+#include <hpx/concurrency/hash_map.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+class locked_unordered_map
+{
+public:
+    bool insert(std::pair<std::uint64_t, std::uint64_t> const& value)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx_);
+        return map_.insert(value).second;
+    }
+
+    bool contains(std::uint64_t key) const
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx_);
+        return map_.find(key) != map_.end();
+    }
+
+    std::size_t erase(std::uint64_t key)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx_);
+        return map_.erase(key);
+    }
+
+private:
+    mutable hpx::util::spinlock mtx_;
+    std::unordered_map<std::uint64_t, std::uint64_t> map_;
+};
+
+using hash_map = hpx::concurrent::hash_map<std::uint64_t, std::uint64_t>;
+
+///////////////////////////////////////////////////////////////////////////////
+// execute the given number of operations, reads_percent of them are lookups,
+// the others are split evenly between insertions and erasures
+template <typename Map>
+std::size_t run_operations(Map& m, std::size_t ops, std::uint64_t key_range,
+    unsigned reads_percent, unsigned int seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> keys(0, key_range - 1);
+    std::uniform_int_distribution<unsigned> percent(0, 99);
+
+    std::size_t found = 0;
+    for (std::size_t i = 0; i != ops; ++i)
+    {
+        std::uint64_t const key = keys(gen);
+        unsigned const op = percent(gen);
+
+        if (op < reads_percent)
+        {
+            found += m.contains(key);
+        }
+        else if ((op - reads_percent) % 2 == 0)
+        {
+            m.insert(std::make_pair(key, key));
+        }
+        else
+        {
+            m.erase(key);
+        }
+    }
+    return found;
+}
+
+// return the achieved throughput in operations per second
+template <typename Map>
+double measure(std::size_t num_tasks, std::size_t ops, std::uint64_t key_range,
+    unsigned reads_percent)
+{
+    Map m;
+
+    // fill half of the key range
+    for (std::uint64_t key = 0; key < key_range; key += 2)
+    {
+        m.insert(std::make_pair(key, key));
+    }
+
+    std::vector<hpx::future<std::size_t>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::chrono::high_resolution_timer const t;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&m, i, ops, key_range, reads_percent]() {
+            return run_operations(
+                m, ops, key_range, reads_percent, static_cast<unsigned>(i));
+        }));
+    }
+    hpx::wait_all(tasks);
+    double const elapsed = t.elapsed();
+
+    return static_cast<double>(num_tasks * ops) / elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_tasks = vm["tasks"].as<std::size_t>();
+    if (num_tasks == 0)
+    {
+        num_tasks = hpx::get_os_thread_count();
+    }
+
+    std::size_t const ops = vm["operations"].as<std::size_t>();
+    auto const key_range = vm["key-range"].as<std::uint64_t>();
+    int const iterations = vm["iterations"].as<int>();
+
+    std::cout << "tasks: " << num_tasks << ", operations per task: " << ops
+              << ", key range: " << key_range << '\n';
+
+    for (unsigned reads_percent : {90u, 10u})
+    {
+        double locked = 0.0;
+        double concurrent = 0.0;
+        for (int i = 0; i != iterations; ++i)
+        {
+            locked += measure<locked_unordered_map>(
+                num_tasks, ops, key_range, reads_percent);
+            concurrent +=
+                measure<hash_map>(num_tasks, ops, key_range, reads_percent);
+        }
+
+        std::cout << reads_percent << "% reads:\n"
+                  << "  std::unordered_map + spinlock:  "
+                  << locked / iterations * 1e-6 << " M ops/s\n"
+                  << "  hpx::concurrent::hash_map:      "
+                  << concurrent / iterations * 1e-6 << " M ops/s\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks (default: number of cores)")
+        ("operations", value<std::size_t>()->default_value(1000000),
+         "number of operations executed by each task")
+        ("key-range", value<std::uint64_t>()->default_value(100000),
+         "number of distinct keys")
+        ("iterations", value<int>()->default_value(3),
+         "number of iterations to average")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    // Initialize and run HPX.
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
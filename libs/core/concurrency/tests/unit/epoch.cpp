@@ -0,0 +1,281 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/epoch.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace epoch = hpx::util::epoch;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> created(0);
+std::atomic<std::size_t> destroyed(0);
+
+struct tracked
+{
+    explicit tracked(std::atomic<bool>* deleted = nullptr)
+      : deleted_(deleted)
+    {
+        ++created;
+    }
+
+    tracked(tracked const&) = delete;
+    tracked(tracked&&) = delete;
+    tracked& operator=(tracked const&) = delete;
+    tracked& operator=(tracked&&) = delete;
+
+    ~tracked()
+    {
+        if (deleted_ != nullptr)
+        {
+            *deleted_ = true;
+        }
+        ++destroyed;
+    }
+
+    std::atomic<bool>* deleted_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// synchronize has to return even if nothing was retired before, i.e. the
+// worker threads have not joined the reclamation yet
+void test_synchronize_unused()
+{
+    std::uint64_t const e = epoch::current_epoch();
+    epoch::synchronize();
+    HPX_TEST(epoch::current_epoch() >= e + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_retire()
+{
+    std::size_t const destroyed_before = destroyed;
+
+    std::atomic<bool> deleted(false);
+    epoch::retire(new tracked(&deleted));
+    for (int i = 0; i != 1000; ++i)
+    {
+        epoch::retire(new tracked());
+    }
+
+    std::uint64_t const e = epoch::current_epoch();
+    epoch::synchronize();
+    HPX_TEST(epoch::current_epoch() >= e + 2);
+
+    // the objects might have been retired on a different worker thread
+    while (destroyed - destroyed_before != 1001)
+    {
+        epoch::synchronize();
+    }
+    HPX_TEST(deleted);
+
+    // retiring from an OS thread that is not an HPX worker thread, the
+    // remaining objects are handed over on exit
+    std::thread t([] {
+        epoch::guard g;
+        for (int i = 0; i != 100; ++i)
+        {
+            epoch::retire(new tracked());
+        }
+    });
+    t.join();
+
+    while (destroyed - destroyed_before != 1101)
+    {
+        epoch::synchronize();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// an object retired while a guard is alive is not deleted before the guard is
+// released, even if the HPX thread holding the guard suspends in between
+void test_guard()
+{
+    std::atomic<bool> deleted(false);
+    std::atomic<bool> guarded(false);
+    std::atomic<bool> release(false);
+
+    hpx::future<void> f = hpx::async([&] {
+        epoch::guard g;
+        {
+            // guards can be nested
+            epoch::guard nested;
+        }
+        guarded = true;
+
+        while (!release)
+        {
+            hpx::this_thread::yield();
+        }
+    });
+
+    while (!guarded)
+    {
+        hpx::this_thread::yield();
+    }
+
+    epoch::retire(new tracked(&deleted));
+    for (int i = 0; i != 1000; ++i)
+    {
+        epoch::reclaim();
+        hpx::this_thread::yield();
+    }
+    HPX_TEST(!deleted);
+
+    release = true;
+    f.get();
+
+    while (!deleted)
+    {
+        epoch::synchronize();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a Treiber stack, popped nodes are handed to the epoch based reclamation
+struct stack
+{
+    struct node : tracked
+    {
+        explicit node(std::size_t v)
+          : value(v)
+        {
+        }
+
+        std::size_t value;
+        node* next = nullptr;
+    };
+
+    ~stack()
+    {
+        node* n = head.load();
+        while (n != nullptr)
+        {
+            node* next = n->next;
+            delete n;
+            n = next;
+        }
+    }
+
+    void push(std::size_t value)
+    {
+        node* n = new node(value);
+        n->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(n->next, n))
+        {
+        }
+    }
+
+    bool pop(std::size_t& value)
+    {
+        node* n = head.load();
+        while (n != nullptr && !head.compare_exchange_weak(n, n->next))
+        {
+        }
+
+        if (n == nullptr)
+        {
+            return false;
+        }
+
+        value = n->value;
+        epoch::retire(n);
+        return true;
+    }
+
+    std::atomic<node*> head{nullptr};
+};
+
+void test_stack(bool use_guard)
+{
+    std::size_t const num_tasks = 2 * hpx::get_os_thread_count();
+    std::size_t const num_values = 10000;
+
+    std::size_t const created_before = created;
+    std::size_t const destroyed_before = destroyed;
+
+    std::atomic<std::size_t> popped_sum(0);
+    {
+        stack s;
+
+        std::vector<hpx::future<void>> tasks;
+        for (std::size_t t = 0; t != num_tasks; ++t)
+        {
+            tasks.push_back(hpx::async([&, t] {
+                std::size_t sum = 0;
+                for (std::size_t i = 0; i != num_values; ++i)
+                {
+                    s.push(t * num_values + i);
+
+                    std::size_t value = 0;
+                    if (use_guard)
+                    {
+                        epoch::guard g;
+                        if (s.pop(value))
+                            sum += value;
+                    }
+                    else if (s.pop(value))
+                    {
+                        sum += value;
+                    }
+
+                    if (i % 100 == 0)
+                    {
+                        hpx::this_thread::yield();
+                    }
+                }
+                popped_sum += sum;
+            }));
+        }
+        hpx::wait_all(tasks);
+
+        std::size_t value = 0;
+        while (s.pop(value))
+        {
+            popped_sum += value;
+        }
+        HPX_TEST(s.head.load() == nullptr);
+    }
+
+    std::size_t const n = num_tasks * num_values;
+    HPX_TEST_EQ(popped_sum.load(), n * (n - 1) / 2);
+
+    // all nodes are eventually deleted
+    while (destroyed - destroyed_before != created - created_before)
+    {
+        epoch::synchronize();
+    }
+    HPX_TEST_EQ(created - created_before, n);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // must run first, before the reclamation was used
+    test_synchronize_unused();
+    test_retire();
+    test_guard();
+    test_stack(false);
+    test_stack(true);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
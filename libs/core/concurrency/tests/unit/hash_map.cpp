@@ -0,0 +1,242 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/hash_map.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// all keys end up in the same segment and bucket
+struct bad_hash
+{
+    std::size_t operator()(int) const noexcept
+    {
+        return 42;
+    }
+};
+
+template <typename Map>
+void test_basic(Map& m)
+{
+    HPX_TEST(m.empty());
+
+    HPX_TEST(m.insert(std::make_pair(1, std::string("one"))));
+    HPX_TEST(!m.insert(std::make_pair(1, std::string("uno"))));
+    HPX_TEST(m.emplace(2, "two"));
+    HPX_TEST(!m.emplace(2, "dos"));
+    HPX_TEST(m.try_emplace(3, "three"));
+    HPX_TEST(!m.try_emplace(3, "tres"));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(3));
+
+    HPX_TEST(m.contains(1));
+    HPX_TEST(!m.contains(4));
+    HPX_TEST_EQ(m.count(2), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(m.count(4), static_cast<std::size_t>(0));
+
+    HPX_TEST(m.find(1) && *m.find(1) == "one");
+    HPX_TEST(m.find(2) && *m.find(2) == "two");
+    HPX_TEST(m.find(3) && *m.find(3) == "three");
+    HPX_TEST(!m.find(4));
+
+    HPX_TEST(!m.insert_or_assign(1, "eins"));
+    HPX_TEST(m.insert_or_assign(4, "vier"));
+    HPX_TEST_EQ(*m.find(1), std::string("eins"));
+    HPX_TEST_EQ(*m.find(4), std::string("vier"));
+
+    HPX_TEST(m.visit(2, [](auto& v) { v.second += "!"; }));
+    HPX_TEST(!m.visit(5, [](auto&) { HPX_TEST(false); }));
+    HPX_TEST_EQ(*m.find(2), std::string("two!"));
+
+    Map const& cm = m;
+    std::string value;
+    HPX_TEST(cm.visit(3, [&](auto const& v) { value = v.second; }));
+    HPX_TEST_EQ(value, std::string("three"));
+
+    std::size_t count = 0;
+    int key_sum = 0;
+    cm.for_each([&](auto const& v) {
+        ++count;
+        key_sum += v.first;
+    });
+    HPX_TEST_EQ(count, static_cast<std::size_t>(4));
+    HPX_TEST_EQ(key_sum, 10);
+
+    m.for_each([](auto& v) { v.second = "x"; });
+    HPX_TEST_EQ(*m.find(4), std::string("x"));
+
+    HPX_TEST_EQ(m.erase(1), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(m.erase(1), static_cast<std::size_t>(0));
+    HPX_TEST(!m.contains(1));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(3));
+
+    // bulk insertion, keys that are already present are not inserted
+    std::vector<std::pair<int, std::string>> values;
+    for (int i = 0; i != 1000; ++i)
+    {
+        values.emplace_back(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(m.insert(values.begin(), values.end()),
+        static_cast<std::size_t>(997));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(1000));
+    HPX_TEST_EQ(*m.find(2), std::string("x"));
+    HPX_TEST_EQ(*m.find(999), std::string("999"));
+
+    HPX_TEST_EQ(m.erase_if([](auto const& v) { return v.first % 2 == 0; }),
+        static_cast<std::size_t>(500));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(500));
+    HPX_TEST(!m.contains(998));
+    HPX_TEST(m.contains(997));
+
+    m.clear();
+    HPX_TEST(m.empty());
+    HPX_TEST(!m.contains(997));
+}
+
+void test_basic()
+{
+    {
+        hpx::concurrent::hash_map<int, std::string> m;
+        test_basic(m);
+    }
+    {
+        // a single segment
+        hpx::concurrent::hash_map<int, std::string> m(0, 1);
+        HPX_TEST_EQ(m.num_segments(), static_cast<std::size_t>(1));
+        test_basic(m);
+    }
+    {
+        hpx::concurrent::hash_map<int, std::string, bad_hash> m(1000, 7);
+        HPX_TEST_EQ(m.num_segments(), static_cast<std::size_t>(8));
+        HPX_TEST(m.bucket_count() >= 1000);
+        test_basic(m);
+    }
+
+    // elements are destroyed with the map
+    auto p = std::make_shared<int>(42);
+    {
+        hpx::concurrent::hash_map<int, std::shared_ptr<int>> m;
+        for (int i = 0; i != 100; ++i)
+        {
+            m.emplace(i, p);
+        }
+        HPX_TEST_EQ(p.use_count(), 101l);
+        m.erase(0);
+        HPX_TEST_EQ(p.use_count(), 100l);
+    }
+    HPX_TEST_EQ(p.use_count(), 1l);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent(std::size_t num_tasks)
+{
+    constexpr int keys_per_task = 10000;
+
+    hpx::concurrent::hash_map<int, int> m;
+    std::atomic<std::size_t> found(0);
+
+    // each task inserts its own keys, looks up the keys of all other tasks,
+    // and erases every other one of its own keys
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&, t]() {
+            std::mt19937 gen(seed + static_cast<unsigned int>(t));
+            std::uniform_int_distribution<int> dis(
+                0, static_cast<int>(num_tasks) * keys_per_task - 1);
+
+            int const first = static_cast<int>(t) * keys_per_task;
+            for (int i = first; i != first + keys_per_task; ++i)
+            {
+                HPX_TEST(m.insert(std::make_pair(i, 2 * i)));
+
+                int const key = dis(gen);
+                if (auto value = m.find(key))
+                {
+                    HPX_TEST_EQ(*value, 2 * key);
+                    ++found;
+                }
+
+                m.visit(key, [](auto& v) { HPX_TEST_EQ(v.second % 2, 0); });
+
+                if (i % 64 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+
+            for (int i = first; i != first + keys_per_task; i += 2)
+            {
+                HPX_TEST_EQ(m.erase(i), static_cast<std::size_t>(1));
+            }
+        }));
+    }
+
+    // iterate concurrently with the modifications
+    std::size_t visited = 0;
+    m.for_each([&](auto const& v) {
+        HPX_TEST_EQ(v.second, 2 * v.first);
+        ++visited;
+    });
+
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), num_tasks * keys_per_task / 2);
+    for (int i = 0; i != static_cast<int>(num_tasks) * keys_per_task; ++i)
+    {
+        HPX_TEST_EQ(m.contains(i), i % 2 != 0);
+    }
+
+    std::cout << "found " << found << " keys inserted by other tasks, "
+              << "visited " << visited << " elements\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_basic();
+    test_concurrent(2 * hpx::get_os_thread_count());
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -14,4 +14,6 @@
 #include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/executors/num_cores.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
+#include <hpx/execution/executors/profile_guided_chunk_size.hpp>
+#include <hpx/execution/executors/single_pass_scan.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
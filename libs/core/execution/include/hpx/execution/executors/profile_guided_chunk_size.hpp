@@ -0,0 +1,226 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/profile_guided_chunk_size.hpp
+/// \page hpx::execution::experimental::profile_guided_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // The data learned for one call site, instances are owned by a
+        // process wide registry and are never destroyed.
+        struct chunk_size_profile;
+
+        HPX_CORE_EXPORT chunk_size_profile* get_chunk_size_profile(
+            std::string const& key);
+
+        HPX_CORE_EXPORT std::size_t profile_processing_units_count(
+            chunk_size_profile& profile, std::size_t available_pus,
+            std::size_t count) noexcept;
+        HPX_CORE_EXPORT std::size_t profile_chunk_size(
+            chunk_size_profile& profile, std::uint64_t target_time,
+            std::size_t cores, std::size_t count) noexcept;
+        HPX_CORE_EXPORT void profile_begin_execution(
+            chunk_size_profile& profile) noexcept;
+        HPX_CORE_EXPORT void profile_end_execution(
+            chunk_size_profile& profile) noexcept;
+
+        HPX_CORE_EXPORT std::uint64_t profile_iteration_duration(
+            chunk_size_profile const& profile) noexcept;
+        HPX_CORE_EXPORT std::size_t profile_processing_units(
+            chunk_size_profile const& profile) noexcept;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces whose size is learned from
+    /// previous invocations of algorithms that used the same key (a user
+    /// supplied tag or a source location).
+    ///
+    /// Unlike \a auto_chunk_size and \a persistent_auto_chunk_size this
+    /// executor parameters type does not measure any iterations before
+    /// scheduling the work. Instead, it measures the overall execution time
+    /// of each algorithm invocation and derives the time a single iteration
+    /// takes on one core from it. This estimate is used to select chunks that
+    /// run for the given target time. Additionally, the number of cores used
+    /// is occasionally varied and the best performing number of cores is kept.
+    /// The first invocation for a key uses the default chunking.
+    ///
+    /// The learned data can be written to a file (see
+    /// \a save_chunk_size_profiles) and loaded at startup (see
+    /// \a load_chunk_size_profiles) to avoid the learning phase.
+    ///
+    /// \note Concurrent algorithm invocations using the same key will
+    ///       interfere with each other's measurements.
+    ///
+    struct profile_guided_chunk_size
+    {
+        /// Construct a \a profile_guided_chunk_size executor parameters object
+        ///
+        /// \param key          [in] The user supplied key identifying the
+        ///                     call site.
+        /// \param target_time  [in] The time each of the chunks should run
+        ///                     for (default: 200 microseconds).
+        ///
+        explicit profile_guided_chunk_size(std::string key,
+            hpx::chrono::steady_duration const& target_time =
+                std::chrono::microseconds(200))
+          : key_(HPX_MOVE(key))
+          , target_time_(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    target_time.value())
+                    .count())
+          , profile_(detail::get_chunk_size_profile(key_))
+        {
+        }
+
+        /// Construct a \a profile_guided_chunk_size executor parameters object
+        /// using the given source location as the key, use as
+        /// `profile_guided_chunk_size(HPX_CURRENT_SOURCE_LOCATION())`.
+        ///
+        /// \param loc          [in] The source location identifying the
+        ///                     call site.
+        /// \param target_time  [in] The time each of the chunks should run
+        ///                     for (default: 200 microseconds).
+        ///
+        explicit profile_guided_chunk_size(hpx::source_location const& loc,
+            hpx::chrono::steady_duration const& target_time =
+                std::chrono::microseconds(200))
+          : profile_guided_chunk_size(std::string(loc.file_name()) + ":" +
+                    std::to_string(loc.line()) + ":" + loc.function_name(),
+                target_time)
+        {
+        }
+
+        /// Return the key identifying the call site
+        [[nodiscard]] std::string const& key() const noexcept
+        {
+            return key_;
+        }
+
+        /// Return the learned execution time of one iteration on one core,
+        /// zero if nothing was learned yet
+        [[nodiscard]] std::chrono::nanoseconds iteration_duration()
+            const noexcept
+        {
+            return std::chrono::nanoseconds(
+                detail::profile_iteration_duration(*profile_));
+        }
+
+        /// Return the learned number of cores, zero if nothing was learned
+        /// yet
+        [[nodiscard]] std::size_t processing_units() const noexcept
+        {
+            return detail::profile_processing_units(*profile_);
+        }
+
+        /// \cond NOINTERNAL
+        // discover the number of cores to use for parallelization
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::processing_units_count_t,
+            profile_guided_chunk_size const& this_, Executor&& exec,
+            hpx::chrono::steady_duration const& duration =
+                hpx::chrono::null_duration,
+            std::size_t num_tasks = 0) noexcept
+        {
+            std::size_t const available_pus =
+                hpx::parallel::execution::processing_units_count(
+                    exec, duration, num_tasks);
+            return detail::profile_processing_units_count(
+                *this_.profile_, available_pus, num_tasks);
+        }
+
+        // Return the chunk size derived from the learned iteration duration
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            profile_guided_chunk_size const& this_, Executor&&,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t count) noexcept
+        {
+            return detail::profile_chunk_size(
+                *this_.profile_, this_.target_time_, cores, count);
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_begin_execution_t,
+            profile_guided_chunk_size const& this_, Executor&&) noexcept
+        {
+            detail::profile_begin_execution(*this_.profile_);
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_end_execution_t,
+            profile_guided_chunk_size const& this_, Executor&&) noexcept
+        {
+            detail::profile_end_execution(*this_.profile_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & key_ & target_time_;
+            // clang-format on
+
+            if (!ar.archive_is_saving())
+                profile_ = detail::get_chunk_size_profile(key_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string key_;
+        std::uint64_t target_time_;    // nanoseconds
+        detail::chunk_size_profile* profile_;
+        /// \endcond
+    };
+
+    /// Load the chunk size profiles stored in the given file (see
+    /// \a save_chunk_size_profiles). Returns false if the file could not be
+    /// read.
+    HPX_CORE_EXPORT bool load_chunk_size_profiles(std::string const& filename);
+
+    /// Store the data learned by all \a profile_guided_chunk_size instances
+    /// into the given file. Returns false if the file could not be written.
+    HPX_CORE_EXPORT bool save_chunk_size_profiles(std::string const& filename);
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::profile_guided_chunk_size> : std::true_type
+{
+};
+/// \endcond
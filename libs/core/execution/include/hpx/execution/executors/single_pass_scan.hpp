@@ -0,0 +1,122 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/single_pass_scan.hpp
+/// \page hpx::execution::experimental::single_pass_scan
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Select the single-pass scan for the scan based algorithms (for
+    /// instance \a hpx::inclusive_scan, \a hpx::exclusive_scan, or
+    /// \a hpx::copy_if).
+    ///
+    /// By default, these algorithms run the first step of the scan for all
+    /// partitions, combine the partial results, and run the final step for
+    /// all partitions, which reads the input data twice. With this executor
+    /// parameters type the input is divided into small chunks that are
+    /// processed in order by one task per core. Each chunk publishes its
+    /// partial result as soon as it is known and looks back at the results
+    /// published for the preceding chunks to determine its prefix (decoupled
+    /// look-back). Both steps of the scan run on a chunk while it is still in
+    /// the cache, so the input data is read from memory only once.
+    ///
+    /// \note The chunk size should be chosen such that a chunk fits into the
+    ///       cache of a core.
+    ///
+    struct single_pass_scan
+    {
+        /// \cond NOINTERNAL
+        using uses_single_pass_scan = std::true_type;
+
+        // by default, chunks contain at most this many elements
+        static constexpr std::size_t default_max_chunk_size = 16384;
+        /// \endcond
+
+        /// Construct a \a single_pass_scan executor parameters object
+        ///
+        /// \note By default the chunk size is determined from the number of
+        ///       available cores and the overall number of elements, chunks
+        ///       contain at most 16384 elements.
+        ///
+        single_pass_scan() = default;
+
+        /// Construct a \a single_pass_scan executor parameters object
+        ///
+        /// \param chunk_size   [in] The number of elements to process as one
+        ///                     chunk.
+        ///
+        constexpr explicit single_pass_scan(std::size_t chunk_size) noexcept
+          : chunk_size_(chunk_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            single_pass_scan const& this_, Executor&&,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t num_tasks) noexcept
+        {
+            // use the given chunk size if given
+            if (this_.chunk_size_ != 0)
+            {
+                return this_.chunk_size_;
+            }
+
+            // create at least 8 chunks per core to balance the load, the
+            // chunks are handed out dynamically
+            std::size_t const chunk_size =
+                (num_tasks + 8 * cores - 1) / (8 * cores);
+
+            // clang-format off
+            return (std::clamp) (
+                chunk_size, std::size_t(1), default_max_chunk_size);
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & chunk_size_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunk_size_ = 0;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::single_pass_scan> : std::true_type
+{
+};
+/// \endcond
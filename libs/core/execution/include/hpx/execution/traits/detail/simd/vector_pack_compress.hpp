@@ -0,0 +1,37 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    struct vector_pack_mask_load_store<std::experimental::simd<T, Abi>>
+    {
+        using mask_type = typename std::experimental::simd<T, Abi>::mask_type;
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE static mask_type load(
+            bool const* flags) noexcept
+        {
+            return mask_type(flags, std::experimental::element_aligned);
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void store(
+            mask_type const& msk, bool* flags) noexcept
+        {
+            msk.copy_to(flags, std::experimental::element_aligned);
+        }
+    };
+}    // namespace hpx::parallel::traits
+
+#endif
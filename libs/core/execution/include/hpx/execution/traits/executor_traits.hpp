@@ -35,6 +35,7 @@ namespace hpx::execution {
         struct dynamic_chunk_size;
         struct guided_chunk_size;
         struct persistent_auto_chunk_size;
+        struct profile_guided_chunk_size;
         struct static_chunk_size;
         struct num_cores;
     }    // namespace experimental
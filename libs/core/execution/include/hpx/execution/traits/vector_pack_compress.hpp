@@ -0,0 +1,136 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // Convert between the mask of the vector pack type V and consecutive
+    // flags, the generic implementation handles one element at a time.
+    template <typename V, typename Enable = void>
+    struct vector_pack_mask_load_store
+    {
+        using mask_type = vector_pack_mask_type_t<V>;
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE static mask_type load(
+            bool const* flags) noexcept
+        {
+            if constexpr (std::is_same_v<mask_type, bool>)
+            {
+                return *flags;
+            }
+            else
+            {
+                mask_type msk(false);
+                for (std::size_t i = 0; i != vector_pack_size_v<V>; ++i)
+                {
+                    set(msk, i, flags[i]);
+                }
+                return msk;
+            }
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void store(
+            mask_type const& msk, bool* flags) noexcept
+        {
+            if constexpr (std::is_same_v<mask_type, bool>)
+            {
+                *flags = msk;
+            }
+            else
+            {
+                for (std::size_t i = 0; i != vector_pack_size_v<V>; ++i)
+                {
+                    flags[i] = static_cast<bool>(get(msk, i));
+                }
+            }
+        }
+    };
+
+    template <typename V>
+    HPX_HOST_DEVICE HPX_FORCEINLINE vector_pack_mask_type_t<V> load_mask(
+        bool const* flags) noexcept
+    {
+        return vector_pack_mask_load_store<V>::load(flags);
+    }
+
+    template <typename V>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void store_mask(
+        vector_pack_mask_type_t<V> const& msk, bool* flags) noexcept
+    {
+        vector_pack_mask_load_store<V>::store(msk, flags);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // Store the elements of the vector pack whose flag is equal to select
+    // to consecutive positions starting at dest, return the iterator past
+    // the last element stored.
+    template <typename T, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr Iter compress_store(
+        T const& value, bool flag, Iter dest, bool select = true)
+    {
+        if (flag == select)
+        {
+            *dest = value;
+            ++dest;
+        }
+        return dest;
+    }
+
+    template <typename V, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter compress_store(
+        V value, bool const* flags, Iter dest, bool select = true)
+    {
+        using value_type = typename V::value_type;
+        constexpr std::size_t size = vector_pack_size_v<V>;
+
+        auto const msk = load_mask<V>(flags);
+        if (select ? hpx::parallel::traits::none_of(msk) :
+                     hpx::parallel::traits::all_of(msk))
+        {
+            return dest;
+        }
+
+        alignas(vector_pack_alignment_v<V>) value_type values[size];
+        vector_pack_store<V, value_type>::aligned(value, &values[0]);
+
+        if (select ? hpx::parallel::traits::all_of(msk) :
+                     hpx::parallel::traits::none_of(msk))
+        {
+            return std::copy(&values[0], &values[0] + size, dest);
+        }
+
+        // compact the selected elements without branching on the flags
+        value_type selected[size];
+        std::size_t count = 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            selected[count] = values[i];
+            count += (flags[i] == select);
+        }
+        return std::copy(&selected[0], &selected[0] + count, dest);
+    }
+}    // namespace hpx::parallel::traits
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_compress.hpp>
+#endif
+
+#endif
@@ -0,0 +1,308 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/profile_guided_chunk_size.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        // Every probe_interval invocations the number of cores is varied
+        // (halved or doubled, alternately) for one invocation. A probe is
+        // adopted only if it reduced the execution time per iteration by at
+        // least probe_gain.
+        inline constexpr std::size_t probe_interval = 8;
+        inline constexpr double probe_gain = 0.95;
+
+        // weight of a new measurement in the moving average
+        inline constexpr double smoothing = 0.25;
+
+        struct chunk_size_profile
+        {
+            // state of the current invocation
+            std::atomic<std::uint64_t> begin{0};
+            std::atomic<std::size_t> count{0};
+            std::atomic<std::size_t> cores{0};
+            std::atomic<std::size_t> available_cores{0};
+
+            // learned data
+            std::atomic<double> ns_per_iteration{0.0};    // on one core
+            std::atomic<std::size_t> learned_cores{0};
+            std::atomic<std::size_t> probe_cores{0};
+
+            hpx::spinlock mtx;
+            double wall_per_iteration = 0.0;    // using learned_cores
+            std::size_t invocations = 0;
+            bool probe_up = false;
+        };
+
+        struct chunk_size_profile_registry
+        {
+            using mutex_type = hpx::spinlock;
+
+            chunk_size_profile* get(std::string const& key)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                auto& p = profiles_[key];
+                if (!p)
+                    p = std::make_unique<chunk_size_profile>();
+                return p.get();
+            }
+
+            template <typename F>
+            void for_each(F&& f)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                for (auto const& p : profiles_)
+                    f(p.first, *p.second);
+            }
+
+            mutex_type mtx_;
+            std::unordered_map<std::string,
+                std::unique_ptr<chunk_size_profile>>
+                profiles_;
+        };
+
+        chunk_size_profile_registry& get_chunk_size_profile_registry()
+        {
+            static chunk_size_profile_registry registry;
+            return registry;
+        }
+
+        chunk_size_profile* get_chunk_size_profile(std::string const& key)
+        {
+            return get_chunk_size_profile_registry().get(key);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t profile_processing_units_count(chunk_size_profile& profile,
+            std::size_t available_pus, std::size_t count) noexcept
+        {
+            if (available_pus == 0)
+                available_pus = 1;
+
+            std::size_t cores =
+                profile.probe_cores.load(std::memory_order_relaxed);
+            if (cores == 0)
+                cores = profile.learned_cores.load(std::memory_order_relaxed);
+            if (cores == 0 || cores > available_pus)
+                cores = available_pus;
+
+            profile.count.store(count, std::memory_order_relaxed);
+            profile.cores.store(cores, std::memory_order_relaxed);
+            profile.available_cores.store(
+                available_pus, std::memory_order_relaxed);
+
+            return cores;
+        }
+
+        std::size_t profile_chunk_size(chunk_size_profile& profile,
+            std::uint64_t target_time, std::size_t cores,
+            std::size_t count) noexcept
+        {
+            double const ns =
+                profile.ns_per_iteration.load(std::memory_order_relaxed);
+
+            // nothing learned yet, use the default chunking
+            if (ns <= 0.0 || count == 0)
+                return 0;
+
+            if (cores == 0)
+                cores = 1;
+
+            // make sure every core gets at least one chunk
+            std::size_t const max_chunk = (count + cores - 1) / cores;
+            auto const chunk =
+                static_cast<std::size_t>(static_cast<double>(target_time) / ns);
+
+            return (std::clamp)(chunk, static_cast<std::size_t>(1), max_chunk);
+        }
+
+        void profile_begin_execution(chunk_size_profile& profile) noexcept
+        {
+            profile.begin.store(hpx::chrono::high_resolution_clock::now(),
+                std::memory_order_relaxed);
+        }
+
+        void profile_end_execution(chunk_size_profile& profile) noexcept
+        {
+            std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+            std::uint64_t const begin =
+                profile.begin.exchange(0, std::memory_order_relaxed);
+            std::size_t const count =
+                profile.count.load(std::memory_order_relaxed);
+            std::size_t const cores =
+                profile.cores.load(std::memory_order_relaxed);
+
+            if (begin == 0 || end <= begin || count == 0 || cores == 0)
+                return;
+
+            // The algorithms expose no hook for individual chunks, derive the
+            // time of one iteration from the overall execution time instead.
+            double const wall = static_cast<double>(end - begin) /
+                static_cast<double>(count);
+            double const per_core = wall * static_cast<double>(cores);
+
+            std::lock_guard<hpx::spinlock> l(profile.mtx);
+
+            double const ns =
+                profile.ns_per_iteration.load(std::memory_order_relaxed);
+            profile.ns_per_iteration.store(ns == 0.0 ?
+                    per_core :
+                    (1.0 - smoothing) * ns + smoothing * per_core,
+                std::memory_order_relaxed);
+
+            std::size_t const learned =
+                profile.learned_cores.load(std::memory_order_relaxed);
+            std::size_t const probe =
+                profile.probe_cores.load(std::memory_order_relaxed);
+
+            if (probe != 0)
+            {
+                // this was a probing run, keep the better number of cores
+                if (probe == cores &&
+                    wall < probe_gain * profile.wall_per_iteration)
+                {
+                    profile.learned_cores.store(
+                        cores, std::memory_order_relaxed);
+                    profile.wall_per_iteration = wall;
+                }
+                profile.probe_cores.store(0, std::memory_order_relaxed);
+            }
+            else if (learned == 0 || learned != cores ||
+                profile.wall_per_iteration == 0.0)
+            {
+                profile.learned_cores.store(cores, std::memory_order_relaxed);
+                profile.wall_per_iteration = wall;
+            }
+            else
+            {
+                profile.wall_per_iteration =
+                    (1.0 - smoothing) * profile.wall_per_iteration +
+                    smoothing * wall;
+            }
+
+            if (++profile.invocations % probe_interval == 0)
+            {
+                std::size_t const current =
+                    profile.learned_cores.load(std::memory_order_relaxed);
+                std::size_t const available =
+                    profile.available_cores.load(std::memory_order_relaxed);
+
+                profile.probe_up = !profile.probe_up;
+
+                std::size_t next = profile.probe_up ? current * 2 : current / 2;
+                if (next == 0 || next > available)
+                {
+                    // try the other direction instead
+                    next = profile.probe_up ? current / 2 : current * 2;
+                }
+                if (next != 0 && next <= available && next != current)
+                    profile.probe_cores.store(next, std::memory_order_relaxed);
+            }
+        }
+
+        std::uint64_t profile_iteration_duration(
+            chunk_size_profile const& profile) noexcept
+        {
+            return static_cast<std::uint64_t>(
+                profile.ns_per_iteration.load(std::memory_order_relaxed));
+        }
+
+        std::size_t profile_processing_units(
+            chunk_size_profile const& profile) noexcept
+        {
+            return profile.learned_cores.load(std::memory_order_relaxed);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The file contains one line per key: the learned time of one iteration
+    // [ns], the learned number of cores, and the key (separated by tabs).
+    namespace {
+
+        constexpr char const* const profile_file_header =
+            "# hpx chunk size profiles, version 1";
+    }
+
+    bool load_chunk_size_profiles(std::string const& filename)
+    {
+        std::ifstream in(filename);
+        if (!in.is_open())
+            return false;
+
+        std::string line;
+        if (!std::getline(in, line) || line != profile_file_header)
+            return false;
+
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream strm(line);
+            double ns = 0.0;
+            std::size_t cores = 0;
+            std::string key;
+            if (!(strm >> ns >> cores) || strm.get() != '\t' ||
+                !std::getline(strm, key) || key.empty() || ns <= 0.0)
+            {
+                return false;
+            }
+
+            detail::chunk_size_profile& profile =
+                *detail::get_chunk_size_profile(key);
+
+            std::lock_guard<hpx::spinlock> l(profile.mtx);
+            profile.ns_per_iteration.store(ns, std::memory_order_relaxed);
+            profile.learned_cores.store(cores, std::memory_order_relaxed);
+
+            // the execution time for the learned number of cores will be
+            // measured by the next invocation
+            profile.wall_per_iteration = 0.0;
+        }
+        return true;
+    }
+
+    bool save_chunk_size_profiles(std::string const& filename)
+    {
+        std::ofstream out(filename);
+        if (!out.is_open())
+            return false;
+
+        out << profile_file_header << "\n";
+
+        detail::get_chunk_size_profile_registry().for_each(
+            [&](std::string const& key,
+                detail::chunk_size_profile const& profile) {
+                double const ns =
+                    profile.ns_per_iteration.load(std::memory_order_relaxed);
+                if (ns > 0.0)
+                {
+                    out << ns << "\t"
+                        << profile.learned_cores.load(std::memory_order_relaxed)
+                        << "\t" << key << "\n";
+                }
+            });
+
+        return out.good();
+    }
+}    // namespace hpx::execution::experimental
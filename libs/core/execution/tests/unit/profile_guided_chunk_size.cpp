@@ -0,0 +1,179 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void test_profile_guided_chunk_size()
+{
+    using iterator_tag = std::random_access_iterator_tag;
+
+    {
+        hpx::execution::experimental::profile_guided_chunk_size p(
+            "test_profile_guided_chunk_size:par");
+        test_for_each(hpx::execution::par.with(p), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::profile_guided_chunk_size p(
+            "test_profile_guided_chunk_size:task");
+        test_for_each_async(
+            hpx::execution::par(hpx::execution::task).with(p), iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        hpx::execution::experimental::profile_guided_chunk_size p(
+            HPX_CURRENT_SOURCE_LOCATION());
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::profile_guided_chunk_size p(
+            HPX_CURRENT_SOURCE_LOCATION());
+        test_for_each_async(hpx::execution::par(hpx::execution::task)
+                                .on(par_exec)
+                                .with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_sleep_loop(
+    hpx::execution::experimental::profile_guided_chunk_size const& p,
+    std::size_t count)
+{
+    std::vector<std::size_t> c(count, 0);
+    hpx::for_each(hpx::execution::par.with(p), c.begin(), c.end(),
+        [](std::size_t& v) {
+            hpx::this_thread::sleep_for(std::chrono::microseconds(1));
+            ++v;
+        });
+
+    std::size_t errors = 0;
+    for (std::size_t v : c)
+    {
+        if (v != 1)
+            ++errors;
+    }
+    HPX_TEST_EQ(errors, static_cast<std::size_t>(0));
+}
+
+void test_profile_guided_chunk_size_learning()
+{
+    using hpx::execution::experimental::profile_guided_chunk_size;
+
+    profile_guided_chunk_size p("test_profile_guided_chunk_size:learning");
+
+    // nothing has been learned before the first invocation
+    HPX_TEST(p.iteration_duration() == std::chrono::nanoseconds(0));
+    HPX_TEST_EQ(p.processing_units(), static_cast<std::size_t>(0));
+
+    for (int i = 0; i != 20; ++i)
+        run_sleep_loop(p, 1000);
+
+    HPX_TEST(p.iteration_duration() > std::chrono::nanoseconds(0));
+    HPX_TEST_LTE(p.processing_units(), hpx::get_os_thread_count());
+    HPX_TEST_LT(static_cast<std::size_t>(0), p.processing_units());
+
+    // the learned data is shared by all instances using the same key
+    profile_guided_chunk_size p2("test_profile_guided_chunk_size:learning");
+    HPX_TEST(p2.iteration_duration() == p.iteration_duration());
+    HPX_TEST_EQ(p2.processing_units(), p.processing_units());
+
+    profile_guided_chunk_size p3("test_profile_guided_chunk_size:other");
+    HPX_TEST(p3.iteration_duration() == std::chrono::nanoseconds(0));
+}
+
+void test_profile_guided_chunk_size_persistence()
+{
+    using namespace hpx::execution::experimental;
+
+    std::string const filename =
+        "profile_guided_chunk_size_" + std::to_string(std::time(nullptr));
+
+    profile_guided_chunk_size p("test_profile_guided_chunk_size:persistent");
+    run_sleep_loop(p, 1000);
+
+    std::chrono::nanoseconds const duration = p.iteration_duration();
+    std::size_t const cores = p.processing_units();
+    HPX_TEST(duration > std::chrono::nanoseconds(0));
+
+    HPX_TEST(save_chunk_size_profiles(filename));
+
+    // overwrite the learned data, then restore it from the file
+    run_sleep_loop(p, 1000);
+    HPX_TEST(load_chunk_size_profiles(filename));
+
+    // the file stores the duration with a limited precision
+    auto const delta = p.iteration_duration() - duration;
+    HPX_TEST_LTE(delta.count() < 0 ? -delta.count() : delta.count(),
+        duration.count() / 1000 + 1);
+    HPX_TEST_EQ(p.processing_units(), cores);
+
+    std::remove(filename.c_str());
+
+    HPX_TEST(!load_chunk_size_profiles(filename));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_profile_guided_chunk_size();
+    test_profile_guided_chunk_size_learning();
+    test_profile_guided_chunk_size_persistence();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -105,6 +105,35 @@ namespace hpx::parallel::execution {
     inline constexpr bool extract_invokes_testing_function_v =
         extract_invokes_testing_function<Parameters>::value;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes an embedded type 'uses_single_pass_scan'
+    // the scan based algorithms perform a single pass over the input data.
+    template <typename Parameters, typename Enable = void>
+    struct extract_uses_single_pass_scan : std::false_type
+    {
+        // by default, use the three step scan
+    };
+
+#if !defined(DOXYGEN)
+    // doxygen gets confused by the following construct
+    template <typename Parameters>
+    struct extract_uses_single_pass_scan<Parameters,
+        std::void_t<typename Parameters::uses_single_pass_scan>>
+      : std::true_type
+    {
+    };
+#endif
+
+    template <typename Parameters>
+    struct extract_uses_single_pass_scan<::std::reference_wrapper<Parameters>>
+      : extract_uses_single_pass_scan<Parameters>
+    {
+    };
+
+    template <typename Parameters>
+    inline constexpr bool extract_uses_single_pass_scan_v =
+        extract_uses_single_pass_scan<Parameters>::value;
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
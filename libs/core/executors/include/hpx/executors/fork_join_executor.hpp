@@ -34,12 +34,14 @@
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -64,6 +66,13 @@ namespace hpx::execution::experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// The worker threads are woken up and joined hierarchically: the thread
+    /// scheduling the work wakes up one leader thread per NUMA domain, which
+    /// in turn wakes up the remaining threads of its domain. At the end of
+    /// a parallel region each thread waits for the threads it has woken up
+    /// before reporting back to its own parent. No thread directly wakes up
+    /// or waits for more than a small, fixed number of threads.
     class fork_join_executor
     {
     public:
@@ -124,6 +133,10 @@ namespace hpx::execution::experimental {
                 void const* shape_;
                 void* argument_pack_;
                 void* results_;
+
+                // The threads woken up (and joined) by this thread, fixed for
+                // the lifetime of the executor.
+                std::vector<std::uint32_t> children_;
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -198,6 +211,46 @@ namespace hpx::execution::experimental {
                 return current;
             }
 
+            // Pass the data for the current parallel region on to the
+            // threads woken up by the given thread and wake them up.
+            static void wake_children(
+                region_data_type& rdata, std::size_t thread_index) noexcept
+            {
+                region_data const& data = rdata[thread_index].data_;
+                for (std::uint32_t const child : data.children_)
+                {
+                    region_data& child_data = rdata[child].data_;
+
+                    child_data.thread_function_helper_ =
+                        data.thread_function_helper_;
+                    child_data.element_function_ = data.element_function_;
+                    child_data.shape_ = data.shape_;
+                    child_data.argument_pack_ = data.argument_pack_;
+                    child_data.results_ = data.results_;
+
+                    child_data.state_.store(
+                        thread_state::partitioning_work,
+                        std::memory_order_release);
+                }
+            }
+
+            // Wait for the threads woken up by the given thread to finish
+            // the current parallel region (each of them waits for its own
+            // children first), then mark the given thread as idle.
+            static void join_children(region_data_type& rdata,
+                std::size_t thread_index, std::uint64_t yield_delay) noexcept
+            {
+                region_data& data = rdata[thread_index].data_;
+                for (std::uint32_t const child : data.children_)
+                {
+                    wait_state_this_thread_while(rdata[child].data_.state_,
+                        thread_state::idle, yield_delay,
+                        std::not_equal_to<>());
+                }
+                data.state_.store(
+                    thread_state::idle, std::memory_order_release);
+            }
+
             std::string generate_annotation(
                 std::size_t index, char const* default_name) const
             {
@@ -248,10 +301,15 @@ namespace hpx::execution::experimental {
 
                     while (HPX_LIKELY(state != thread_state::stopping))
                     {
+                        shared_data::wake_children(region_data_, thread_index_);
+
                         data.thread_function_helper_(region_data_,
                             thread_index_, num_threads_, queues_,
                             exception_mutex_, exception_);
 
+                        shared_data::join_children(
+                            region_data_, thread_index_, yield_delay_);
+
                         // wait as long the state is 'idle'
                         state = shared_data::wait_state_this_thread_while(
                             data.state_, thread_state::idle, yield_delay_,
@@ -322,6 +380,9 @@ namespace hpx::execution::experimental {
                 std::size_t t = 0;
                 bool main_thread_ok = false;
 
+                // the PU each of the threads is running on
+                std::vector<std::size_t> pu_nums(num_threads_);
+
                 auto const& rp = hpx::resource::get_partitioner();
                 std::size_t main_pu_num = rp.get_pu_num(main_thread_);
                 if (!hpx::threads::test(pu_mask_, main_pu_num) ||
@@ -330,6 +391,7 @@ namespace hpx::execution::experimental {
                     main_thread_ok = true;
                     main_thread_ = t++;
                     main_pu_num = rp.get_pu_num(main_thread_);
+                    pu_nums[main_thread_] = main_pu_num;
                     set_state_main_thread(thread_state::idle);
                 }
 
@@ -349,6 +411,7 @@ namespace hpx::execution::experimental {
                             main_thread_ok = true;
                             main_thread_ = t++;
                             main_pu_num = rp.get_pu_num(main_thread_);
+                            pu_nums[main_thread_] = main_pu_num;
 
                             set_state_main_thread(thread_state::idle);
                             continue;
@@ -369,6 +432,7 @@ namespace hpx::execution::experimental {
 
                         region_data_[t].data_.state_.store(
                             thread_state::starting, std::memory_order_relaxed);
+                        pu_nums[t] = pu_num;
 
                         auto const policy =
                             launch::async_policy(priority_, stacksize_,
@@ -394,9 +458,84 @@ namespace hpx::execution::experimental {
                 // the PU-mask
                 HPX_ASSERT(t == num_threads_);
 
+                // the tree is published to the worker threads when they are
+                // woken up for the first parallel region
+                init_tree(pu_nums);
+
                 wait_state_all(thread_state::idle);
             }
 
+            // The maximal number of threads a single thread wakes up (and
+            // joins) directly.
+            static constexpr std::size_t tree_fanout = 8;
+
+            // Connect the given threads to a tree of degree tree_fanout that
+            // is rooted at the first of them.
+            void link_tree(std::vector<std::uint32_t> const& threads)
+            {
+                for (std::size_t i = 1; i < threads.size(); ++i)
+                {
+                    std::size_t const parent = (i - 1) / tree_fanout;
+                    region_data_[threads[parent]].data_.children_.push_back(
+                        threads[i]);
+                }
+            }
+
+            // Arrange the threads into the tree used for waking them up and
+            // for joining them at the end of each parallel region. The main
+            // thread wakes up one leader thread per NUMA domain (it is the
+            // leader of its own domain), each leader wakes up the other
+            // threads of its domain.
+            void init_tree(std::vector<std::size_t> const& pu_nums)
+            {
+                auto const& topo = hpx::threads::create_topology();
+
+                // group the threads by NUMA domain, the domain of the main
+                // thread first
+                std::vector<std::size_t> domain_numbers;
+                std::vector<std::vector<std::uint32_t>> domains;
+
+                auto add_thread = [&](std::size_t thread_index) {
+                    std::size_t const domain =
+                        topo.get_numa_node_number(pu_nums[thread_index]);
+                    auto const it = std::find(
+                        domain_numbers.begin(), domain_numbers.end(), domain);
+                    auto const index = static_cast<std::size_t>(
+                        std::distance(domain_numbers.begin(), it));
+                    if (it == domain_numbers.end())
+                    {
+                        domain_numbers.push_back(domain);
+                        domains.emplace_back();
+                    }
+                    domains[index].push_back(
+                        static_cast<std::uint32_t>(thread_index));
+                };
+
+                add_thread(main_thread_);
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    if (t != main_thread_)
+                    {
+                        add_thread(t);
+                    }
+                }
+
+                // wake up the other NUMA domains first, their threads take
+                // longest to be reached
+                std::vector<std::uint32_t> leaders;
+                leaders.reserve(domains.size());
+                for (auto const& domain : domains)
+                {
+                    leaders.push_back(domain.front());
+                }
+                link_tree(leaders);
+
+                for (auto const& domain : domains)
+                {
+                    link_tree(domain);
+                }
+            }
+
             static constexpr void init_local_work_queue(queue_type& queue,
                 std::size_t thread_index, std::size_t num_threads,
                 std::size_t size) noexcept
@@ -579,8 +718,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
 
                 // Main entry point for a single parallel region (dynamic
@@ -679,8 +816,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
             };
 
@@ -740,8 +875,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
             };
 
@@ -762,18 +895,19 @@ namespace hpx::execution::experimental {
                         Args>::call_dynamic;
                 }
 
-                for (std::size_t t = 0; t != num_threads_; ++t)
-                {
-                    region_data& data = region_data_[t].data_;
+                region_data& data = region_data_[main_thread_].data_;
 
-                    data.element_function_ = &f;
-                    data.shape_ = &shape;
-                    data.argument_pack_ = &argument_pack;
-                    data.thread_function_helper_ = func;
-                    data.results_ = results;
+                data.element_function_ = &f;
+                data.shape_ = &shape;
+                data.argument_pack_ = &argument_pack;
+                data.thread_function_helper_ = func;
+                data.results_ = results;
+
+                data.state_.store(state, std::memory_order_relaxed);
+
+                // the other threads are woken up through the tree
+                wake_children(region_data_, main_thread_);
 
-                    data.state_.store(state, std::memory_order_release);
-                }
                 return func;
             }
 
@@ -784,17 +918,18 @@ namespace hpx::execution::experimental {
                 constexpr thread_function_helper_type* func =
                     &thread_function_helper_invoke<Fs, Args>::call;
 
-                for (std::size_t t = 0; t != num_threads_; ++t)
-                {
-                    region_data& data = region_data_[t].data_;
+                region_data& data = region_data_[main_thread_].data_;
 
-                    data.element_function_ = &function_pack;
-                    data.shape_ = nullptr;
-                    data.argument_pack_ = &args;
-                    data.thread_function_helper_ = func;
+                data.element_function_ = &function_pack;
+                data.shape_ = nullptr;
+                data.argument_pack_ = &args;
+                data.thread_function_helper_ = func;
+                data.results_ = nullptr;
 
-                    data.state_.store(state, std::memory_order_release);
-                }
+                data.state_.store(state, std::memory_order_relaxed);
+
+                // the other threads are woken up through the tree
+                wake_children(region_data_, main_thread_);
 
                 return func;
             }
@@ -808,7 +943,7 @@ namespace hpx::execution::experimental {
 
                 // Wait for all threads to finish their work assigned to
                 // them in this parallel region.
-                wait_state_all(thread_state::idle);
+                join_children(region_data_, main_thread_, yield_delay_);
 
                 // rethrow exception, if any
                 if (exception_)
@@ -940,7 +1075,7 @@ namespace hpx::execution::experimental {
 
                 // Wait for all threads to finish their work assigned to
                 // them in this parallel region.
-                wait_state_all(thread_state::idle);
+                join_children(region_data_, main_thread_, yield_delay_);
 
                 // rethrow exception, if any
                 if (exception_)
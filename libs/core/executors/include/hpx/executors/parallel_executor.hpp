@@ -32,10 +32,12 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/scoped_deadline.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <string>
 #include <type_traits>
@@ -219,6 +221,29 @@ namespace hpx::execution {
         }
 #endif
 
+        // The deadline is attached to all tasks created by this executor, it
+        // is taken into account by deadline-aware schedulers only.
+        // clang-format off
+        template <typename Executor_,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_convertible_v<Executor_, parallel_policy_executor>
+            )>
+        // clang-format on
+        friend auto tag_invoke(hpx::execution::experimental::with_deadline_t,
+            Executor_ const& exec, hpx::chrono::steady_duration const& rel_time)
+        {
+            auto exec_with_deadline = exec;
+            exec_with_deadline.deadline_ = rel_time.value();
+            return exec_with_deadline;
+        }
+
+        friend constexpr std::chrono::nanoseconds tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            parallel_policy_executor const& exec) noexcept
+        {
+            return exec.deadline_;
+        }
+
         // clang-format off
         template <typename Executor_,
             HPX_CONCEPT_REQUIRES_(
@@ -306,7 +331,8 @@ namespace hpx::execution {
             parallel_policy_executor const& rhs) const noexcept
         {
             return policy_ == rhs.policy_ && pool_ == rhs.pool_ &&
-                hierarchical_threshold_ == rhs.hierarchical_threshold_;
+                hierarchical_threshold_ == rhs.hierarchical_threshold_ &&
+                deadline_ == rhs.deadline_;
         }
 
         constexpr bool operator!=(
@@ -366,6 +392,7 @@ namespace hpx::execution {
             auto pool = exec.pool_ ?
                 exec.pool_ :
                 threads::detail::get_self_or_default_pool();
+            hpx::threads::scoped_deadline deadline(exec.deadline_);
             return hpx::detail::async_launch_policy_dispatch<Policy>::call(
                 exec.policy_, desc, pool, HPX_FORWARD(F, f),
                 HPX_FORWARD(Ts, ts)...);
@@ -412,6 +439,7 @@ namespace hpx::execution {
 #endif
             auto pool =
                 pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+            hpx::threads::scoped_deadline deadline(deadline_);
             hpx::detail::post_policy_dispatch<Policy>::call(
                 policy_, desc, pool, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
         }
@@ -450,6 +478,8 @@ namespace hpx::execution {
                 hpx::threads::do_not_combine_tasks(
                     exec.policy().get_hint().sharing_mode());
 
+            hpx::threads::scoped_deadline deadline(exec.deadline_);
+
             if (exec.hierarchical_threshold_ == 0 && !do_not_combine_tasks)
             {
                 return parallel::execution::detail::
@@ -569,6 +599,7 @@ namespace hpx::execution {
         std::size_t hierarchical_threshold_ = hierarchical_threshold_default_;
         std::size_t first_core_ = 0;
         std::size_t num_cores_ = 0;
+        std::chrono::nanoseconds deadline_{0};
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
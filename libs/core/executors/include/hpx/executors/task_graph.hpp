@@ -0,0 +1,181 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task_graph records a static directed acyclic graph of tasks. Each
+    /// node of the graph is a function invoked without arguments once all
+    /// nodes it depends on have been executed. The nodes communicate through
+    /// data owned by the application (e.g. the partitions of a stencil), the
+    /// graph itself only describes the order of execution.
+    ///
+    /// Graphs are recorded once using the \a dataflow and \a then member
+    /// functions, which mirror the corresponding free functions operating on
+    /// futures. The recorded graph can then be executed any number of times
+    /// using a \a task_graph_executor, which avoids the per-node cost of
+    /// allocating shared states, registering continuations, and making
+    /// scheduling decisions that rebuilding the graph each time incurs.
+    class task_graph
+    {
+    public:
+        /// Handle referring to a node of a task graph
+        class node
+        {
+        public:
+            node() = default;
+
+            [[nodiscard]] constexpr std::size_t index() const noexcept
+            {
+                return index_;
+            }
+
+        private:
+            friend class task_graph;
+
+            explicit constexpr node(std::size_t index) noexcept
+              : index_(index)
+            {
+            }
+
+            std::size_t index_ = static_cast<std::size_t>(-1);
+        };
+
+        task_graph() = default;
+
+        task_graph(task_graph&&) = default;
+        task_graph& operator=(task_graph&&) = default;
+
+        /// Add a node executing \a f to the graph, \a f will be invoked once
+        /// all given \a dependencies have been executed. The optional
+        /// scheduling hint determines where the node is executed if it is
+        /// not run directly by the node that satisfied its last dependency.
+        template <typename F>
+        node add(F&& f, std::vector<node> const& dependencies,
+            threads::thread_schedule_hint hint = {})
+        {
+            static_assert(std::is_invocable_v<std::decay_t<F>&>,
+                "the function of a task graph node must be invocable "
+                "without arguments");
+
+            node_data data{hpx::move_only_function<void()>(HPX_FORWARD(F, f)),
+                {}, hint};
+            data.dependencies.reserve(dependencies.size());
+            for (node const& n : dependencies)
+            {
+                // nodes can depend on previously added nodes only, this
+                // makes the graph acyclic
+                HPX_ASSERT(n.index_ < nodes_.size());
+                data.dependencies.push_back(n.index_);
+            }
+
+            nodes_.push_back(HPX_MOVE(data));
+            return node(nodes_.size() - 1);
+        }
+
+        /// Add a node executing \a f once all given nodes have been executed
+        template <typename F, typename... Nodes>
+        node dataflow(F&& f, Nodes const&... dependencies)
+        {
+            static_assert((std::is_same_v<Nodes, node> && ...),
+                "the dependencies of a task graph node must be nodes of "
+                "the same task graph");
+
+            return add(HPX_FORWARD(F, f), std::vector<node>{dependencies...});
+        }
+
+        /// Add a node executing \a f once the given node has been executed
+        template <typename F>
+        node then(node const& dependency, F&& f)
+        {
+            return add(HPX_FORWARD(F, f), std::vector<node>{dependency});
+        }
+
+        /// Return the number of nodes in the graph
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return nodes_.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return nodes_.empty();
+        }
+
+    private:
+        friend class task_graph_executor;
+
+        struct node_data
+        {
+            hpx::move_only_function<void()> f;
+            std::vector<std::size_t> dependencies;
+            threads::thread_schedule_hint hint;
+        };
+
+        std::vector<node_data> nodes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The task_graph_executor executes (replays) a recorded \a task_graph.
+    ///
+    /// All state needed for executing the graph is computed once on
+    /// construction: the successors of all nodes are stored in a contiguous
+    /// array, the dependency counters are preallocated and only reset before
+    /// each replay, and each node is assigned to a worker thread. Nodes
+    /// without dependencies are distributed round-robin across the worker
+    /// threads of the pool, all other nodes are placed on the worker thread
+    /// of their first dependency (unless an explicit scheduling hint was
+    /// given). When a node completes, the first of its successors that
+    /// became ready is executed directly on the same thread, all others are
+    /// scheduled on their assigned worker threads.
+    ///
+    /// Replays of the same graph must not overlap.
+    class HPX_CORE_EXPORT task_graph_executor
+    {
+    public:
+        explicit task_graph_executor(task_graph&& graph,
+            threads::thread_pool_base* pool = nullptr,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_);
+
+        task_graph_executor(task_graph_executor&&) noexcept;
+        task_graph_executor& operator=(task_graph_executor&&) noexcept;
+
+        ~task_graph_executor();
+
+        /// Execute all nodes of the graph once. The returned future becomes
+        /// ready once all nodes have been executed. It holds the first
+        /// exception thrown by any of the nodes, no further nodes are
+        /// executed after a node has thrown.
+        hpx::future<void> replay();
+
+        /// Return the number of nodes in the graph
+        [[nodiscard]] std::size_t size() const noexcept;
+
+    private:
+        struct shared_data;
+        std::unique_ptr<shared_data> data_;
+    };
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,269 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/executors/task_graph.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    struct task_graph_executor::shared_data
+    {
+        shared_data(task_graph&& graph, threads::thread_pool_base* pool,
+            threads::thread_priority priority,
+            threads::thread_stacksize stacksize)
+          : pool_(pool ? pool : threads::detail::get_self_or_default_pool())
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , counts_(graph.size())
+        {
+            std::size_t const size = graph.size();
+
+            functions_.reserve(size);
+            initial_counts_.reserve(size);
+            hints_.reserve(size);
+
+            // count the successors of all nodes
+            successor_offsets_.assign(size + 1, 0);
+            for (auto const& n : graph.nodes_)
+            {
+                for (std::size_t dep : n.dependencies)
+                {
+                    ++successor_offsets_[dep + 1];
+                }
+            }
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                successor_offsets_[i + 1] += successor_offsets_[i];
+            }
+
+            // store the successors of all nodes contiguously
+            successors_.resize(successor_offsets_[size]);
+            std::vector<std::size_t> next(
+                successor_offsets_.begin(), successor_offsets_.end() - 1);
+
+            std::size_t const num_threads = pool_->get_os_thread_count();
+            std::size_t next_root_thread = 0;
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                auto& n = graph.nodes_[i];
+                for (std::size_t dep : n.dependencies)
+                {
+                    successors_[next[dep]++] = i;
+                }
+
+                initial_counts_.push_back(
+                    static_cast<std::uint32_t>(n.dependencies.size()));
+
+                if (n.dependencies.empty())
+                {
+                    roots_.push_back(i);
+                }
+
+                // nodes are added after their dependencies, so the placement
+                // of the dependencies is known already
+                if (n.hint.mode != threads::thread_schedule_hint_mode::none)
+                {
+                    hints_.push_back(n.hint);
+                }
+                else if (n.dependencies.empty())
+                {
+                    hints_.emplace_back(
+                        static_cast<std::int16_t>(next_root_thread));
+                    next_root_thread = (next_root_thread + 1) % num_threads;
+                }
+                else
+                {
+                    hints_.push_back(hints_[n.dependencies.front()]);
+                }
+
+                functions_.push_back(HPX_MOVE(n.f));
+            }
+        }
+
+        hpx::future<void> replay()
+        {
+            if (running_.exchange(true, std::memory_order_acquire))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "task_graph_executor::replay",
+                    "a replay of this task graph is still running");
+            }
+
+            if (functions_.empty())
+            {
+                running_.store(false, std::memory_order_release);
+                return hpx::make_ready_future();
+            }
+
+            for (std::size_t i = 0; i != counts_.size(); ++i)
+            {
+                counts_[i].data_.store(
+                    initial_counts_[i], std::memory_order_relaxed);
+            }
+            remaining_.store(functions_.size(), std::memory_order_relaxed);
+            failed_.store(false, std::memory_order_relaxed);
+            exception_ = std::exception_ptr();
+
+            promise_ = hpx::promise<void>();
+            hpx::future<void> f = promise_.get_future();
+
+            for (std::size_t root : roots_)
+            {
+                spawn(root);
+            }
+            return f;
+        }
+
+        void spawn(std::size_t i)
+        {
+            hpx::execution::parallel_executor exec(
+                pool_, priority_, stacksize_, hints_[i]);
+            hpx::parallel::execution::post(exec, [this, i]() { run(i); });
+        }
+
+        void run(std::size_t i)
+        {
+            constexpr std::size_t no_node = static_cast<std::size_t>(-1);
+
+            while (true)
+            {
+                if (!failed_.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        functions_[i]();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard l(mtx_);
+                        if (!failed_.exchange(true))
+                        {
+                            exception_ = std::current_exception();
+                        }
+                    }
+                }
+
+                // release the successors, the first one becoming ready is
+                // executed directly
+                std::size_t next = no_node;
+                for (std::size_t s = successor_offsets_[i];
+                     s != successor_offsets_[i + 1]; ++s)
+                {
+                    std::size_t const succ = successors_[s];
+                    if (counts_[succ].data_.fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next == no_node)
+                        {
+                            next = succ;
+                        }
+                        else
+                        {
+                            spawn(succ);
+                        }
+                    }
+                }
+
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    HPX_ASSERT(next == no_node);
+                    finish();
+                    return;
+                }
+
+                if (next == no_node)
+                {
+                    return;
+                }
+                i = next;
+            }
+        }
+
+        void finish()
+        {
+            // the executor may be destroyed as soon as the promise is set
+            hpx::promise<void> p = HPX_MOVE(promise_);
+            std::exception_ptr e = HPX_MOVE(exception_);
+            running_.store(false, std::memory_order_release);
+
+            if (e)
+            {
+                p.set_exception(HPX_MOVE(e));
+            }
+            else
+            {
+                p.set_value();
+            }
+        }
+
+        threads::thread_pool_base* pool_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+
+        // the (precomputed) graph structure
+        std::vector<hpx::move_only_function<void()>> functions_;
+        std::vector<std::size_t> successor_offsets_;
+        std::vector<std::size_t> successors_;
+        std::vector<std::uint32_t> initial_counts_;
+        std::vector<threads::thread_schedule_hint> hints_;
+        std::vector<std::size_t> roots_;
+
+        // the state of the current replay
+        std::vector<hpx::util::cache_aligned_data<std::atomic<std::uint32_t>>>
+            counts_;
+        std::atomic<std::size_t> remaining_ = 0;
+        std::atomic<bool> running_ = false;
+        std::atomic<bool> failed_ = false;
+        hpx::spinlock mtx_;
+        std::exception_ptr exception_;
+        hpx::promise<void> promise_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_graph_executor::task_graph_executor(task_graph&& graph,
+        threads::thread_pool_base* pool, threads::thread_priority priority,
+        threads::thread_stacksize stacksize)
+      : data_(std::make_unique<shared_data>(
+            HPX_MOVE(graph), pool, priority, stacksize))
+    {
+    }
+
+    task_graph_executor::task_graph_executor(
+        task_graph_executor&&) noexcept = default;
+    task_graph_executor& task_graph_executor::operator=(
+        task_graph_executor&&) noexcept = default;
+
+    task_graph_executor::~task_graph_executor() = default;
+
+    hpx::future<void> task_graph_executor::replay()
+    {
+        return data_->replay();
+    }
+
+    std::size_t task_graph_executor::size() const noexcept
+    {
+        return data_->functions_.size();
+    }
+}    // namespace hpx::execution::experimental
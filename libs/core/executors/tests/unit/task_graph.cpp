@@ -0,0 +1,162 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::execution::experimental::task_graph;
+using hpx::execution::experimental::task_graph_executor;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty_graph()
+{
+    task_graph_executor exec{task_graph()};
+    HPX_TEST_EQ(exec.size(), std::size_t(0));
+
+    hpx::future<void> f = exec.replay();
+    HPX_TEST(f.is_ready());
+    f.get();
+}
+
+// diamond shaped graph: a -> (b, c) -> d
+void test_diamond()
+{
+    std::atomic<int> a(0), b(0), c(0), d(0);
+
+    task_graph graph;
+    auto const na = graph.add([&]() { ++a; }, {});
+    auto const nb = graph.then(na, [&]() {
+        HPX_TEST_EQ(a.load(), b.load() + 1);
+        ++b;
+    });
+    auto const nc = graph.then(na, [&]() {
+        HPX_TEST_EQ(a.load(), c.load() + 1);
+        ++c;
+    });
+    graph.dataflow(
+        [&]() {
+            HPX_TEST_EQ(b.load(), d.load() + 1);
+            HPX_TEST_EQ(c.load(), d.load() + 1);
+            ++d;
+        },
+        nb, nc);
+    HPX_TEST_EQ(graph.size(), std::size_t(4));
+
+    task_graph_executor exec(std::move(graph));
+    for (int i = 0; i != 10; ++i)
+    {
+        exec.replay().get();
+    }
+
+    HPX_TEST_EQ(a.load(), 10);
+    HPX_TEST_EQ(b.load(), 10);
+    HPX_TEST_EQ(c.load(), 10);
+    HPX_TEST_EQ(d.load(), 10);
+}
+
+// a wide graph of independent chains joined by a single node
+void test_chains()
+{
+    constexpr std::size_t num_chains = 64;
+    constexpr std::size_t chain_length = 16;
+
+    std::vector<std::size_t> counts(num_chains, 0);
+    std::atomic<std::size_t> joined(0);
+
+    task_graph graph;
+    std::vector<task_graph::node> last;
+    for (std::size_t c = 0; c != num_chains; ++c)
+    {
+        auto n = graph.add([&counts, c]() { ++counts[c]; }, {});
+        for (std::size_t i = 1; i != chain_length; ++i)
+        {
+            n = graph.then(n, [&counts, c, i]() {
+                // the nodes of each chain are executed in order
+                HPX_TEST_EQ(counts[c] % chain_length, i);
+                ++counts[c];
+            });
+        }
+        last.push_back(n);
+    }
+    graph.add([&]() { ++joined; }, last);
+
+    task_graph_executor exec(std::move(graph));
+    HPX_TEST_EQ(exec.size(), num_chains * chain_length + 1);
+
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        exec.replay().get();
+    }
+
+    HPX_TEST_EQ(joined.load(), std::size_t(5));
+    for (std::size_t c : counts)
+    {
+        HPX_TEST_EQ(c, 5 * chain_length);
+    }
+}
+
+void test_exception()
+{
+    std::atomic<int> executed(0);
+
+    task_graph graph;
+    auto const n = graph.add(
+        []() { throw std::runtime_error("test_exception"); }, {});
+    graph.then(n, [&]() { ++executed; });
+
+    task_graph_executor exec(std::move(graph));
+    for (int i = 0; i != 2; ++i)
+    {
+        bool caught_exception = false;
+        try
+        {
+            exec.replay().get();
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // successors of a failed node are not executed
+    HPX_TEST_EQ(executed.load(), 0);
+}
+
+int hpx_main()
+{
+    test_empty_graph();
+    test_diamond();
+    test_chains();
+    test_exception();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
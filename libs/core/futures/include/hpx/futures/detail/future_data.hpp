@@ -30,6 +30,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -228,6 +229,8 @@ namespace hpx::lcos::detail {
 
         future_data_base() noexcept
           : state_(empty)
+          , on_completed_(0)
+          , waiter_(nullptr)
           , runs_child_(threads::invalid_thread_id)
         {
         }
@@ -235,6 +238,8 @@ namespace hpx::lcos::detail {
         explicit future_data_base(init_no_addref no_addref) noexcept
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , on_completed_(0)
+          , waiter_(nullptr)
           , runs_child_(threads::invalid_thread_id)
         {
         }
@@ -323,21 +328,53 @@ namespace hpx::lcos::detail {
 
         virtual std::exception_ptr get_exception_ptr() const = 0;
 
-        void reserve_callbacks(std::size_t capacity)
-        {
-            on_completed_.reserve(capacity);
-        }
+        // The registered callbacks are kept in a lock-free list, there is
+        // nothing to preallocate.
+        void reserve_callbacks(std::size_t) noexcept {}
+
+        // entry of the list of registered callbacks (see future_data.cpp)
+        struct callback_node;
+
+        // threads suspended waiting for the future (see future_data.cpp)
+        struct future_waiter;
 
     protected:
         // try to perform scoped execution of the associated thread (if any)
         bool execute_thread();
 
+        // invoke all callbacks registered before the future became ready,
+        // callbacks registered afterwards are invoked directly
+        void invoke_on_completed();
+
+        // release all registered callbacks without invoking them, allow for
+        // callbacks to be registered again
+        void reset_on_completed() noexcept;
+
+    private:
+        // return the waiter of this future, create and register it on first
+        // use, returns nullptr if the future has become ready
+        future_waiter* get_waiter();
+
+        // resume all threads suspended waiting for the future
+        void notify_waiter();
+
     protected:
-        mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
 
-        completed_callback_vector_type on_completed_;
-        local::detail::condition_variable cond_;    // threads waiting in read
+        // The registered callbacks (continuations). The low bits of this word
+        // are flags (see future_data.cpp), the remaining bits point to the
+        // most recently registered entry of a lock-free stack of callbacks.
+        // The first callback is stored inline to avoid allocating a list
+        // entry for the common case of a single continuation.
+        std::atomic<std::uintptr_t> on_completed_;
+        completed_callback_type inline_on_completed_;
+
+        // All threads waiting for the future share a single waiter which is
+        // announced by a flag in on_completed_ and is resumed before any of
+        // the callbacks are invoked. Waiting repeatedly (e.g. polling using
+        // wait_for) reuses the same waiter.
+        std::atomic<future_waiter*> waiter_;
+
         threads::thread_id_ref_type runs_child_;
     };
 
@@ -465,15 +502,6 @@ namespace hpx::lcos::detail {
             auto* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-            [[maybe_unused]] util::ignore_while_checking il(&l);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
@@ -482,7 +510,6 @@ namespace hpx::lcos::detail {
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
@@ -492,41 +519,9 @@ namespace hpx::lcos::detail {
             // alive as long as the future
             this->base_type::runs_child_.reset();
 
-            // 26111: Caller failing to release lock 'this->mtx_'
-            // 26115: Failing to release lock 'this->mtx_'
-            // 26800: Use of a moved from object 'l'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26111 26115 26800)
-#endif
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       that avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-            il.reset_owns_registration();
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
-
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
+            // resume all threads waiting for the future to become ready and
+            // invoke the callback (continuation) functions
+            this->base_type::invoke_on_completed();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -544,24 +539,15 @@ namespace hpx::lcos::detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             hpx::construct_at(exception_ptr, HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-            [[maybe_unused]] util::ignore_while_checking il(&l);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'exception' at this
-            // point signals to all other threads that this future is ready.
+            // The exception has been set, changing the state to 'exception'
+            // at this point signals to all other threads that this future is
+            // ready.
             state expected = empty;
             if (!state_.compare_exchange_strong(
                     expected, exception, std::memory_order_release))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
@@ -571,41 +557,9 @@ namespace hpx::lcos::detail {
             // alive as long as the future
             this->base_type::runs_child_.reset();
 
-            // 26111: Caller failing to release lock 'this->mtx_'
-            // 26115: Failing to release lock 'this->mtx_'
-            // 26800: Use of a moved from object 'l'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26111 26115 26800)
-#endif
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       that avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-            il.reset_owns_registration();
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
-
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
+            // resume all threads waiting for the future to become ready and
+            // invoke the callback (continuation) functions
+            this->base_type::invoke_on_completed();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -674,7 +628,7 @@ namespace hpx::lcos::detail {
                 break;
             }
 
-            on_completed_.clear();
+            this->base_type::reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -684,12 +638,9 @@ namespace hpx::lcos::detail {
         }
 
     protected:
-        using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         future_data_storage_t<Result> storage_;
     };
 
@@ -852,9 +803,6 @@ namespace hpx::lcos::detail {
         using result_type = typename future_data<Result>::result_type;
         using init_no_addref = typename base_type::init_no_addref;
 
-        using mutex_type = typename base_type::mutex_type;
-        using base_type::mtx_;
-
     public:
         task_base()
           : base_type()
@@ -1000,7 +948,6 @@ namespace hpx::lcos::detail {
         using init_no_addref = typename task_base<Result>::init_no_addref;
 
         using mutex_type = typename base_type::mutex_type;
-        using base_type::mtx_;
 
     protected:
         threads::thread_id_type get_thread_id() const noexcept
@@ -1107,6 +1054,7 @@ namespace hpx::lcos::detail {
         }
 
     protected:
+        mutable mutex_type mtx_;
         threads::thread_id_type id_;
     };
 }    // namespace hpx::lcos::detail
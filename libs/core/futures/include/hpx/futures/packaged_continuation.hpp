@@ -135,8 +135,6 @@ namespace hpx::lcos::detail {
         using result_type = typename base_type::result_type;
 
     protected:
-        using base_type::mtx_;
-
         threads::thread_id_type get_id() const
         {
             std::lock_guard<mutex_type> l(mtx_);
@@ -342,6 +340,7 @@ namespace hpx::lcos::detail {
         }
 
     protected:
+        mutable mutex_type mtx_;
         bool started_;
         threads::thread_id_type id_;
         std::decay_t<F> f_;
@@ -19,9 +19,14 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -39,6 +44,170 @@ namespace hpx::lcos::detail {
 
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Entry of the lock-free stack of registered callbacks. Entries are pushed
+    // by set_on_completed until the future becomes ready, at which point the
+    // whole stack is taken over (and closed) by a single atomic exchange.
+    struct alignas(16)
+        future_data_base<traits::detail::future_data_void>::callback_node
+    {
+        explicit callback_node(completed_callback_type&& f) noexcept
+          : f_(HPX_MOVE(f))
+        {
+        }
+
+        completed_callback_type f_;
+        callback_node* next_ = nullptr;
+    };
+
+    namespace {
+
+        using callback_node =
+            future_data_base<traits::detail::future_data_void>::callback_node;
+
+        // flags stored in the low bits of future_data_base::on_completed_
+        constexpr std::uintptr_t callbacks_closed = 0x1;    // future is ready
+        constexpr std::uintptr_t inline_callback_busy = 0x2;     // being set
+        constexpr std::uintptr_t inline_callback_ready = 0x4;    // was set
+        constexpr std::uintptr_t waiter_registered = 0x8;    // threads wait
+        constexpr std::uintptr_t callbacks_flags = 0xf;
+
+        // the nodes are allocated using malloc (see internal_allocator)
+        static_assert(alignof(callback_node) > callbacks_flags);
+        static_assert(alignof(callback_node) <= alignof(std::max_align_t));
+
+        using callback_node_allocator =
+            hpx::util::internal_allocator<callback_node>;
+        using callback_node_traits =
+            std::allocator_traits<callback_node_allocator>;
+
+        callback_node* allocate_callback_node(
+            future_data_refcnt_base::completed_callback_type&& f)
+        {
+            callback_node_allocator alloc;
+            callback_node* node = callback_node_traits::allocate(alloc, 1);
+            callback_node_traits::construct(alloc, node, HPX_MOVE(f));
+            return node;
+        }
+
+        void deallocate_callback_node(callback_node* node) noexcept
+        {
+            callback_node_allocator alloc;
+            callback_node_traits::destroy(alloc, node);
+            callback_node_traits::deallocate(alloc, node, 1);
+        }
+
+        callback_node* get_callback_node(std::uintptr_t w) noexcept
+        {
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            return reinterpret_cast<callback_node*>(w & ~callbacks_flags);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Threads waiting for a future to become ready are parked on demand: the
+    // first waiting thread creates the waiter and announces it by setting a
+    // flag in the word holding the registered callbacks. The waiter is not
+    // part of the list of callbacks, making the future ready resumes all
+    // waiting threads before any continuation is invoked. The waiter is owned
+    // by the shared state and is reused by all later waits, including those
+    // that have timed out before.
+    struct future_data_base<traits::detail::future_data_void>::future_waiter
+    {
+        hpx::spinlock mtx_;
+        local::detail::condition_variable cond_;
+        bool ready_ = false;
+    };
+
+    namespace {
+
+        using future_waiter =
+            future_data_base<traits::detail::future_data_void>::future_waiter;
+
+        using future_waiter_allocator =
+            hpx::util::internal_allocator<future_waiter>;
+        using future_waiter_traits =
+            std::allocator_traits<future_waiter_allocator>;
+
+        future_waiter* allocate_future_waiter()
+        {
+            future_waiter_allocator alloc;
+            future_waiter* waiter = future_waiter_traits::allocate(alloc, 1);
+            future_waiter_traits::construct(alloc, waiter);
+            return waiter;
+        }
+
+        void deallocate_future_waiter(future_waiter* waiter) noexcept
+        {
+            future_waiter_allocator alloc;
+            future_waiter_traits::destroy(alloc, waiter);
+            future_waiter_traits::deallocate(alloc, waiter, 1);
+        }
+    }    // namespace
+
+    future_data_base<traits::detail::future_data_void>::future_waiter*
+    future_data_base<traits::detail::future_data_void>::get_waiter()
+    {
+        future_waiter* waiter = waiter_.load(std::memory_order_acquire);
+        if (waiter == nullptr)
+        {
+            future_waiter* new_waiter = allocate_future_waiter();
+            if (waiter_.compare_exchange_strong(waiter, new_waiter,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                waiter = new_waiter;
+            }
+            else
+            {
+                // another thread has created its waiter first
+                deallocate_future_waiter(new_waiter);
+            }
+        }
+
+        // Announce the waiter, this fails if the future has become ready in
+        // the meantime. Making the future ready closes the list of callbacks
+        // with a single exchange, thus either the waiter is seen by
+        // invoke_on_completed or the future is seen as ready here.
+        std::uintptr_t w = on_completed_.load(std::memory_order_acquire);
+        while (!(w & waiter_registered))
+        {
+            if (w & callbacks_closed)
+            {
+                return nullptr;
+            }
+
+            if (on_completed_.compare_exchange_weak(w, w | waiter_registered,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+        return waiter;
+    }
+
+    // resume all threads waiting for the future to become ready
+    void future_data_base<traits::detail::future_data_void>::notify_waiter()
+    {
+        future_waiter* waiter = waiter_.load(std::memory_order_acquire);
+        HPX_ASSERT(waiter != nullptr);
+
+        std::unique_lock l(waiter->mtx_);
+        waiter->ready_ = true;
+
+        // Note: we use notify_one repeatedly instead of notify_all as we
+        //       know: a) that most of the time we have at most one thread
+        //       waiting on the future (most futures are not shared), and
+        //       b) our implementation of condition_variable::notify_one
+        //       relinquishes the lock before resuming the waiting thread
+        //       that avoids suspension of this thread when it tries to
+        //       re-lock the mutex while exiting from condition_variable::wait
+        while (waiter->cond_.notify_one(
+            HPX_MOVE(l), threads::thread_priority::boost))
+        {
+            l = std::unique_lock(waiter->mtx_);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct handle_continuation_recursion_count
     {
@@ -110,6 +279,8 @@ namespace hpx::lcos::detail {
 
             runs_child_ = threads::invalid_thread_id;
         }
+
+        reset_on_completed();
     }
 
     // try to performed scoped execution of the associated thread (if any)
@@ -327,23 +498,147 @@ namespace hpx::lcos::detail {
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(HPX_MOVE(data_sink));
+            return;
         }
-        else
+
+        hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
+
+        // the first callback is stored inline, claim the inline slot before
+        // writing to it
+        std::uintptr_t w = on_completed_.load(std::memory_order_acquire);
+        while (!(w & (callbacks_closed | inline_callback_busy |
+                   inline_callback_ready)))
         {
-            hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
+            if (on_completed_.compare_exchange_weak(w,
+                    w | inline_callback_busy, std::memory_order_acquire))
+            {
+                inline_on_completed_ = HPX_MOVE(data_sink);
+
+                w |= inline_callback_busy;
+                while (!on_completed_.compare_exchange_weak(w,
+                    (w & ~inline_callback_busy) | inline_callback_ready,
+                    std::memory_order_release, std::memory_order_acquire))
+                {
+                    if (w & callbacks_closed)
+                    {
+                        // the future became ready while the inline slot was
+                        // being written, invoke the callback directly
+                        handle_on_completed(HPX_MOVE(inline_on_completed_));
+                        return;
+                    }
+                }
+                return;
+            }
+        }
 
-            std::unique_lock l(mtx_);
-            if (is_ready())
+        // push all other callbacks onto the lock-free stack
+        callback_node* node = nullptr;
+        while (!(w & callbacks_closed))
+        {
+            if (node == nullptr)
             {
-                l.unlock();
+                node = allocate_callback_node(HPX_MOVE(data_sink));
+            }
 
-                // invoke the callback (continuation) function
-                handle_on_completed(HPX_MOVE(data_sink));
+            node->next_ = get_callback_node(w);
+            if (on_completed_.compare_exchange_weak(w,
+                    reinterpret_cast<std::uintptr_t>(node) |
+                        (w & callbacks_flags),
+                    std::memory_order_release, std::memory_order_acquire))
+            {
+                return;
             }
-            else
+        }
+
+        // the future became ready in the meantime, invoke the callback
+        // (continuation) function directly
+        if (node != nullptr)
+        {
+            data_sink = HPX_MOVE(node->f_);
+            deallocate_callback_node(node);
+        }
+        handle_on_completed(HPX_MOVE(data_sink));
+    }
+
+    // invoke all callbacks registered before the future became ready
+    void
+    future_data_base<traits::detail::future_data_void>::invoke_on_completed()
+    {
+        // close the list of callbacks, all callbacks registered from now on
+        // will be invoked directly
+        std::uintptr_t const w =
+            on_completed_.exchange(callbacks_closed, std::memory_order_acq_rel);
+
+        // resume all suspended threads first, they shouldn't have to wait for
+        // the continuations to run
+        if (w & waiter_registered)
+        {
+            notify_waiter();
+        }
+
+        // Note: the inline callback is invoked by the registering thread if
+        //       it was still being written
+        callback_node* node = get_callback_node(w);
+        if (node == nullptr)
+        {
+            if (w & inline_callback_ready)
             {
-                on_completed_.push_back(HPX_MOVE(data_sink));
+                handle_on_completed(HPX_MOVE(inline_on_completed_));
             }
+            return;
+        }
+
+        // invoke all callbacks in the order they were registered
+        completed_callback_vector_type on_completed;
+        if (w & inline_callback_ready)
+        {
+            on_completed.push_back(HPX_MOVE(inline_on_completed_));
+        }
+
+        callback_node* reversed = nullptr;
+        while (node != nullptr)
+        {
+            callback_node* next = node->next_;
+            node->next_ = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed != nullptr)
+        {
+            callback_node* next = reversed->next_;
+            on_completed.push_back(HPX_MOVE(reversed->f_));
+            deallocate_callback_node(reversed);
+            reversed = next;
+        }
+
+        handle_on_completed(HPX_MOVE(on_completed));
+    }
+
+    // release all registered callbacks without invoking them
+    void future_data_base<
+        traits::detail::future_data_void>::reset_on_completed() noexcept
+    {
+        std::uintptr_t const w =
+            on_completed_.exchange(0, std::memory_order_relaxed);
+
+        if (w & inline_callback_ready)
+        {
+            inline_on_completed_.reset();
+        }
+
+        callback_node* node = get_callback_node(w);
+        while (node != nullptr)
+        {
+            callback_node* next = node->next_;
+            deallocate_callback_node(node);
+            node = next;
+        }
+
+        if (future_waiter* waiter =
+                waiter_.exchange(nullptr, std::memory_order_relaxed))
+        {
+            deallocate_future_waiter(waiter);
         }
     }
 
@@ -356,19 +651,21 @@ namespace hpx::lcos::detail {
         {
             hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
 
-            std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
-            if (s == empty)
+            if (future_waiter* waiter = get_waiter())
             {
-                cond_.wait(l, "future_data_base::wait", ec);
-                if (ec)
+                std::unique_lock l(waiter->mtx_);
+                while (!waiter->ready_)
                 {
-                    return s;
+                    waiter->cond_.wait(l, "future_data_base::wait", ec);
+                    if (ec)
+                    {
+                        return s;
+                    }
                 }
-
-                // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
             }
+
+            // reload the state, it's not empty anymore
+            s = state_.load(std::memory_order_acquire);
         }
 
         if (&ec != &throws)
@@ -387,20 +684,26 @@ namespace hpx::lcos::detail {
         {
             hpx::intrusive_ptr<future_data_base> this_(this);    // keep alive
 
-            std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            // Note: the waiter stays registered if waiting times out, it is
+            //       reused by subsequent waits
+            if (future_waiter* waiter = get_waiter())
             {
-                threads::thread_restart_state const reason = cond_.wait_until(
-                    l, abs_time, "future_data_base::wait_until", ec);
-                if (ec)
+                std::unique_lock l(waiter->mtx_);
+                while (!waiter->ready_)
                 {
-                    return hpx::future_status::uninitialized;
-                }
+                    threads::thread_restart_state const reason =
+                        waiter->cond_.wait_until(
+                            l, abs_time, "future_data_base::wait_until", ec);
+                    if (ec)
+                    {
+                        return hpx::future_status::uninitialized;
+                    }
 
-                if (reason == threads::thread_restart_state::timeout &&
-                    state_.load(std::memory_order_acquire) == empty)
-                {
-                    return hpx::future_status::timeout;
+                    if (reason == threads::thread_restart_state::timeout &&
+                        !waiter->ready_)
+                    {
+                        return hpx::future_status::timeout;
+                    }
                 }
             }
         }
@@ -0,0 +1,188 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that continuations and waiting threads attached to a
+// shared state concurrently with it becoming ready are invoked exactly once.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// attach a number of continuations while the future becomes ready
+void test_concurrent_continuations()
+{
+    constexpr std::size_t num_continuations = 16;
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        hpx::promise<int> p;
+        hpx::shared_future<int> f = p.get_future().share();
+
+        std::atomic<std::size_t> invoked(0);
+        std::vector<hpx::future<void>> attached;
+        attached.reserve(num_continuations);
+
+        hpx::future<void> setter = hpx::async([&p]() { p.set_value(42); });
+        for (std::size_t j = 0; j != num_continuations; ++j)
+        {
+            attached.push_back(f.then([&invoked](hpx::shared_future<int>&& f) {
+                HPX_TEST_EQ(f.get(), 42);
+                ++invoked;
+            }));
+        }
+
+        setter.get();
+        hpx::wait_all(attached);
+
+        HPX_TEST_EQ(invoked.load(), num_continuations);
+    }
+}
+
+// continuations are invoked in the order they were attached
+void test_continuation_order()
+{
+    hpx::promise<void> p;
+    hpx::shared_future<void> f = p.get_future().share();
+
+    std::vector<int> order;
+    std::vector<hpx::future<void>> attached;
+    for (int i = 0; i != 5; ++i)
+    {
+        attached.push_back(f.then(hpx::launch::sync,
+            [&order, i](hpx::shared_future<void>&&) { order.push_back(i); }));
+    }
+
+    p.set_value();
+    hpx::wait_all(attached);
+
+    HPX_TEST_EQ(order.size(), std::size_t(5));
+    for (int i = 0; i != 5; ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+}
+
+// wait for the future from several threads, with and without timeouts
+void test_concurrent_waiters()
+{
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::promise<void> p;
+        hpx::shared_future<void> f = p.get_future().share();
+
+        std::vector<hpx::future<void>> waiters;
+        for (std::size_t j = 0; j != 4; ++j)
+        {
+            waiters.push_back(hpx::async([f]() { f.wait(); }));
+            waiters.push_back(hpx::async([f]() {
+                while (f.wait_for(std::chrono::microseconds(100)) ==
+                    hpx::future_status::timeout)
+                {
+                }
+            }));
+        }
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        p.set_value();
+
+        hpx::wait_all(waiters);
+        HPX_TEST(f.is_ready());
+    }
+}
+
+// repeatedly poll a future which is not ready, the (shared) waiter has to
+// resume all threads once the future becomes ready
+void test_polling()
+{
+    hpx::promise<int> p;
+    hpx::shared_future<int> f = p.get_future().share();
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(f.wait_for(std::chrono::microseconds(1)) ==
+            hpx::future_status::timeout);
+    }
+
+    hpx::future<void> waiter = hpx::async([f]() { HPX_TEST_EQ(f.get(), 42); });
+
+    p.set_value(42);
+
+    waiter.get();
+    HPX_TEST(f.wait_for(std::chrono::microseconds(1)) ==
+        hpx::future_status::ready);
+}
+
+// threads waiting for a future are resumed before the continuations that
+// were attached earlier are invoked
+void test_waiters_before_continuations()
+{
+    if (hpx::get_os_thread_count() < 2)
+    {
+        return;
+    }
+
+    hpx::promise<void> p;
+    hpx::shared_future<void> f = p.get_future().share();
+
+    std::atomic<bool> woken(false);
+    hpx::future<void> continuation =
+        f.then(hpx::launch::sync, [&](hpx::shared_future<void>&&) {
+            // wait for the suspended thread to run (on another worker)
+            auto const deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!woken && std::chrono::steady_clock::now() < deadline)
+            {
+                hpx::this_thread::yield();
+            }
+            HPX_TEST(woken.load());
+        });
+
+    hpx::future<void> waiter = hpx::async([f, &woken]() {
+        f.wait();
+        woken = true;
+    });
+
+    // make sure the waiting thread is suspended
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    p.set_value();
+
+    continuation.get();
+    waiter.get();
+}
+
+int hpx_main()
+{
+    test_concurrent_continuations();
+    test_continuation_order();
+    test_concurrent_waiters();
+    test_polling();
+    test_waiters_before_continuations();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
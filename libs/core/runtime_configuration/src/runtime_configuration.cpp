@@ -192,6 +192,12 @@ namespace hpx::util {
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
 
+            // stealing of tasks submitted using async_stealable between
+            // localities, the interval is given in microseconds
+            "[hpx.distributed_stealing]",
+            "enable = ${HPX_DISTRIBUTED_STEALING_ENABLE:0}",
+            "interval = ${HPX_DISTRIBUTED_STEALING_INTERVAL:1000}",
+
             // connect back to the given latch if specified
             "[hpx.on_startup]",
             "wait_on_latch = ${HPX_ON_STARTUP_WAIT_ON_LATCH}",
@@ -258,6 +264,12 @@ namespace hpx::util {
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
 
+            // task event tracing, see hpx/threading_base/task_tracer.hpp
+            "[hpx.trace]",
+            "enable = ${HPX_TRACE_ENABLE:0}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:65536}",
+            "destination = ${HPX_TRACE_DESTINATION:hpx_trace.json}",
+
             "[hpx.commandline]",
             // enable aliasing
             "aliasing = ${HPX_COMMANDLINE_ALIASING:1}",
@@ -36,6 +36,7 @@
 #include <hpx/thread_support/set_thread_name.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -219,6 +220,13 @@ namespace hpx {
         }
         std::abort();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the next worker thread running out of work starts writing the trace
+    void task_trace_handler(int)
+    {
+        hpx::threads::tracing::request_dump();
+    }
 }    // namespace hpx
 
 #endif
@@ -295,6 +303,16 @@ namespace hpx {
             sigaction(SIGSEGV, &new_action, nullptr);    // Segmentation fault
             sigaction(SIGSYS, &new_action, nullptr);     // Bad syscall
 
+            if (hpx::util::get_entry_as<int>(cfg, "hpx.trace.enable", 0))
+            {
+                struct sigaction trace_action;
+                trace_action.sa_handler = hpx::task_trace_handler;
+                sigemptyset(&trace_action.sa_mask);
+                trace_action.sa_flags = SA_RESTART;
+
+                sigaction(SIGUSR2, &trace_action, nullptr);    // Write trace
+            }
+
             hpx::threads::coroutines::register_signal_handler = true;
         }
         else
@@ -346,6 +364,44 @@ namespace hpx {
             global_on_stop_func;
         threads::policies::callback_notifier::on_error_type
             global_on_error_func;
+
+        void init_task_tracing(hpx::util::runtime_configuration const& cfg)
+        {
+            threads::tracing::set_buffer_size(
+                hpx::util::get_entry_as<std::size_t>(
+                    cfg, "hpx.trace.buffer_size", 65536));
+            threads::tracing::set_destination(
+                hpx::util::get_entry_as<std::string>(
+                    cfg, "hpx.trace.destination", ""));
+
+            if (hpx::util::get_entry_as<int>(cfg, "hpx.trace.enable", 0))
+            {
+                threads::tracing::enable();
+            }
+        }
+
+        // write the collected task events after all threads have stopped
+        void write_task_trace() noexcept
+        {
+            if (!threads::tracing::enabled())
+            {
+                return;
+            }
+
+            try
+            {
+                threads::tracing::dump();
+            }
+            catch (std::exception const& e)
+            {
+                LRT_(error).format(
+                    "runtime_local: failed to write task trace: {}", e.what());
+            }
+            catch (...)
+            {
+                LRT_(error).format("runtime_local: failed to write task trace");
+            }
+        }
     }    // namespace
 
     ///////////////////////////////////////////////////////////////////////////
@@ -390,6 +446,7 @@ namespace hpx {
             threads::detail::network_background_callback_type{});
 
         init_global_data();
+        init_task_tracing(rtcfg_);
         util::reinit_construct();
 
         if (initialize)
@@ -423,6 +480,7 @@ namespace hpx {
       , stop_done_(false)
     {
         init_global_data();
+        init_task_tracing(rtcfg_);
         util::reinit_construct();
 
         LPROGRESS_;
@@ -1648,6 +1706,7 @@ namespace hpx {
         else
         {
             thread_manager_->stop(blocking);    // wait for thread manager
+            write_task_trace();
 
             deinit_global_data();
 
@@ -1684,6 +1743,7 @@ namespace hpx {
     {
         // wait for thread manager to exit
         thread_manager_->stop(blocking);    // wait for thread manager
+        write_task_trace();
 
         deinit_global_data();
 
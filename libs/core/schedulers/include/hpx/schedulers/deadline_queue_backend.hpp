@@ -0,0 +1,174 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::policies {
+
+    struct deadline_fifo;
+
+    namespace detail {
+
+        inline std::uint64_t get_thread_deadline(
+            thread_id_ref_type::thread_repr* thrd) noexcept
+        {
+            return static_cast<thread_data*>(thrd)->get_deadline();
+        }
+
+        // thread_queue::thread_description (HPX_HAVE_THREAD_QUEUE_WAITTIME)
+        template <typename ThreadDescription>
+        std::uint64_t get_thread_deadline(ThreadDescription* desc) noexcept
+        {
+            return get_thread_id_data(desc->data)->get_deadline();
+        }
+
+        // Number of threads with a deadline currently held by any of the
+        // deadline_fifo_backend instances. Allows schedulers to skip looking
+        // at the queues if there are none.
+        HPX_CORE_EXPORT std::atomic<std::int64_t>&
+        deadline_threads_pending() noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first
+    //
+    // Threads with a deadline are kept in a binary min-heap ordered by their
+    // deadline (ties are broken in FIFO order), all other threads are kept in
+    // a lock-free FIFO queue. Threads with a deadline are always dequeued
+    // before threads without one. Threads which are rescheduled at the other
+    // end of the queue (e.g. yielding threads) are put into the FIFO queue as
+    // well to avoid starving the remaining threads.
+    template <typename T>
+    struct deadline_fifo_backend
+    {
+        using fifo_type = lockfree_fifo_backend<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        explicit deadline_fifo_backend(size_type initial_size = 0,
+            size_type num_thread = static_cast<size_type>(-1))
+          : fifo_(initial_size, num_thread)
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            std::uint64_t const deadline = detail::get_thread_deadline(val);
+            if (deadline == 0 || other_end)
+            {
+                return fifo_.push(val);
+            }
+
+            std::lock_guard<mutex_type> l(mtx_.data_);
+
+            heap_.push_back(heap_entry{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), heap_compare{});
+            detail::deadline_threads_pending().fetch_add(
+                1, std::memory_order_relaxed);
+
+            update_top_deadline();
+            return true;
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (top_deadline_.load(std::memory_order_acquire) != 0)
+            {
+                std::lock_guard<mutex_type> l(mtx_.data_);
+                if (!heap_.empty())
+                {
+                    std::pop_heap(heap_.begin(), heap_.end(), heap_compare{});
+                    val = HPX_MOVE(heap_.back().value);
+                    heap_.pop_back();
+                    detail::deadline_threads_pending().fetch_sub(
+                        1, std::memory_order_relaxed);
+
+                    update_top_deadline();
+                    return true;
+                }
+            }
+            return fifo_.pop(val, steal);
+        }
+
+        bool empty() noexcept
+        {
+            return top_deadline_.load(std::memory_order_acquire) == 0 &&
+                fifo_.empty();
+        }
+
+        // Return the earliest deadline stored in this queue, zero if none.
+        std::uint64_t peek_deadline() const noexcept
+        {
+            return top_deadline_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        using mutex_type = hpx::util::spinlock;
+
+        struct heap_entry
+        {
+            std::uint64_t deadline;
+            std::uint64_t sequence;
+            T value;
+        };
+
+        // std::push_heap and std::pop_heap maintain a max-heap
+        struct heap_compare
+        {
+            bool operator()(
+                heap_entry const& lhs, heap_entry const& rhs) const noexcept
+            {
+                return lhs.deadline > rhs.deadline ||
+                    (lhs.deadline == rhs.deadline &&
+                        lhs.sequence > rhs.sequence);
+            }
+        };
+
+        void update_top_deadline() noexcept
+        {
+            top_deadline_.store(heap_.empty() ? 0 : heap_.front().deadline,
+                std::memory_order_release);
+        }
+
+        fifo_type fifo_;
+
+        hpx::util::cache_aligned_data<mutex_type> mtx_;
+        std::vector<heap_entry> heap_;
+        std::uint64_t sequence_ = 0;
+
+        std::atomic<std::uint64_t> top_deadline_{0};
+    };
+
+    struct deadline_fifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = deadline_fifo_backend<T>;
+        };
+    };
+}    // namespace hpx::threads::policies
@@ -0,0 +1,167 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/deadline_queue_backend.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/scoped_deadline.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_local_deadline_queue_scheduler_terminated_queue =
+        lockfree_lifo;
+#else
+    using default_local_deadline_queue_scheduler_terminated_queue =
+        lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_deadline_queue_scheduler maintains exactly one queue of work
+    /// items (threads) per OS thread, where this OS thread pulls its next work
+    /// from. Each queue runs the threads with the earliest deadline first,
+    /// threads without a deadline are run in FIFO order whenever no thread
+    /// with a deadline is available. Idle OS threads (and OS threads whose
+    /// own queue has later deadlines only) steal from the queue holding the
+    /// earliest deadline.
+    ///
+    /// Threads inherit the deadline of the thread creating them unless a
+    /// deadline is set explicitly (see hpx::threads::scoped_deadline and the
+    /// with_deadline executor property).
+    template <typename Mutex = std::mutex,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_deadline_queue_scheduler_terminated_queue>
+    class local_deadline_queue_scheduler final
+      : public local_queue_scheduler<Mutex, deadline_fifo, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, deadline_fifo,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+        explicit local_deadline_queue_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "local_deadline_queue_scheduler";
+        }
+
+        // create a new thread and schedule it if the initial state is equal
+        // to pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            if (data.deadline == 0)
+            {
+                data.deadline = threads::get_spawn_deadline();
+            }
+
+            // threads with a deadline bypass the staged queue to be ordered
+            // right away
+            if (data.deadline != 0 &&
+                data.initial_state == thread_schedule_state::pending)
+            {
+                data.run_now = true;
+            }
+
+            base_type::create_thread(data, id, ec);
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available. Note: get_next_thread is not virtual, the scheduling
+        // loop invokes it on the most derived scheduler type.
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            // avoid looking at all queues if no thread has a deadline
+            if (running &&
+                detail::deadline_threads_pending().load(
+                    std::memory_order_relaxed) != 0 &&
+                this->has_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing))
+            {
+                // run the thread with the earliest deadline, even if it is
+                // held by a different queue
+                std::size_t const victim = find_earliest_deadline(num_thread);
+                if (victim != num_thread)
+                {
+                    thread_queue_type* q = this->queues_[victim];
+                    if (q->get_next_thread(thrd, running))
+                    {
+                        q->increment_num_stolen_from_pending();
+                        this->queues_[num_thread]
+                            ->increment_num_stolen_to_pending();
+                        return true;
+                    }
+                }
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+    private:
+        // Return the index of the queue holding the earliest deadline which
+        // is earlier than the one held by the queue of the given OS thread.
+        // Returns num_thread if there is no such queue.
+        std::size_t find_earliest_deadline(std::size_t num_thread) const
+        {
+            std::size_t const queues_size = this->queues_.size();
+
+            std::size_t result = num_thread;
+            std::uint64_t earliest =
+                this->queues_[num_thread]->get_next_deadline();
+
+            bool const numa_stealing = this->has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing_numa);
+
+            for (std::size_t i = 1; i != queues_size; ++i)
+            {
+                std::size_t const idx = (i + num_thread) % queues_size;
+
+                if (!numa_stealing &&
+                    !test(this->numa_domain_masks_[num_thread],
+                        this->affinity_data_.get_pu_num(idx)))    //-V600
+                {
+                    continue;
+                }
+
+                std::uint64_t const deadline =
+                    this->queues_[idx]->get_next_deadline();
+                if (deadline != 0 && (earliest == 0 || deadline < earliest))
+                {
+                    earliest = deadline;
+                    result = idx;
+                }
+            }
+            return result;
+        }
+    };
+}    // namespace hpx::threads::policies
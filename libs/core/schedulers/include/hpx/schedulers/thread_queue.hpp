@@ -17,6 +17,7 @@
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
 #include <hpx/threading_base/thread_data_stackless.hpp>
@@ -581,6 +582,13 @@ namespace hpx::threads::policies {
             return new_tasks_count_.data_.load(order);
         }
 
+        // This returns the earliest deadline of the pending threads, zero if
+        // none (requires a deadline-aware PendingQueuing policy)
+        std::uint64_t get_next_deadline() const noexcept
+        {
+            return work_items_.peek_deadline();
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::uint64_t get_average_task_wait_time() const noexcept
         {
@@ -882,6 +890,11 @@ namespace hpx::threads::policies {
                 thrd = HPX_MOVE(tdesc->data);
                 delete tdesc;
 
+                if (steal)
+                {
+                    tracing::record(tracing::event_type::thread_steal,
+                        get_thread_id_data(thrd));
+                }
                 return true;
             }
 #else
@@ -890,6 +903,12 @@ namespace hpx::threads::policies {
             {
                 thrd.reset(next_thrd, false);    // do not addref!
                 --work_items_count_.data_;
+
+                if (steal)
+                {
+                    tracing::record(
+                        tracing::event_type::thread_steal, next_thrd);
+                }
                 return true;
             }
 #endif
@@ -0,0 +1,22 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/schedulers/deadline_queue_backend.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::threads::policies::detail {
+
+    std::atomic<std::int64_t>& deadline_threads_pending() noexcept
+    {
+        static hpx::util::cache_aligned_data<std::atomic<std::int64_t>>
+            pending;
+        return pending.data_;
+    }
+}    // namespace hpx::threads::policies::detail
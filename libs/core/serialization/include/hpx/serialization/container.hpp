@@ -46,5 +46,7 @@ namespace hpx::serialization {
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(
             void* address, std::size_t count, bool allow_zero_copy_receive) = 0;
+        virtual void* try_adopt_binary_chunk(
+            std::size_t count, std::size_t alignment) = 0;
     };
 }    // namespace hpx::serialization
@@ -0,0 +1,39 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <memory>
+
+namespace hpx::serialization::detail {
+
+    // An input archive tagged with this extra data guarantees that the memory
+    // referenced by its zero-copy (pointer) chunks is kept alive by the stored
+    // owner. Types able to share the ownership of their data (for instance
+    // serialize_buffer) may then adopt the received chunks instead of copying
+    // them.
+    struct zero_copy_chunks_owner
+    {
+        std::shared_ptr<void> owner_;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::zero_copy_chunks_owner>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(
+        serialization::detail::zero_copy_chunks_owner* data) noexcept
+    {
+        data->owner_.reset();
+    }
+};
@@ -308,6 +308,24 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Return the address of the received zero-copy chunk holding the next
+        // count bytes, if the chunk is suitably aligned. The data is not
+        // copied, the caller is responsible for keeping the chunk alive (see
+        // detail::zero_copy_chunks_owner). Returns nullptr if the data has
+        // to be loaded using load_binary_chunk instead.
+        void* try_adopt_binary_chunk(std::size_t count, std::size_t alignment)
+        {
+            if (HPX_UNLIKELY(0 == count) || disable_receive_data_chunking())
+                return nullptr;
+
+            void* address = buffer_->try_adopt_binary_chunk(count, alignment);
+            if (address != nullptr)
+            {
+                size_ += count;
+            }
+            return address;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
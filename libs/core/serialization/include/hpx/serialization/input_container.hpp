@@ -212,6 +212,42 @@ namespace hpx::serialization {
             }
         }
 
+        void* try_adopt_binary_chunk(
+            std::size_t count, std::size_t alignment) override
+        {
+            HPX_ASSERT(static_cast<std::int64_t>(count) >= 0);
+
+            // only data that was sent as a separate zero-copy chunk and
+            // already has been received can be adopted
+            if (chunks_ == nullptr ||
+                count < zero_copy_serialization_threshold_ ||
+                filter_ != nullptr)
+            {
+                return nullptr;
+            }
+
+            HPX_ASSERT(current_chunk_ != static_cast<std::size_t>(-1));
+            if (get_chunk_type(current_chunk_) !=
+                    chunk_type::chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "input_container::try_adopt_binary_chunk",
+                    "archive data bstream data chunk size mismatch");
+            }
+
+            void* buffer = get_chunk_data(current_chunk_).pos_;
+            if (buffer == nullptr ||
+                reinterpret_cast<std::uintptr_t>(buffer) % alignment != 0)
+            {
+                // the caller falls back to load_binary_chunk
+                return nullptr;
+            }
+
+            ++current_chunk_;
+            return buffer;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -12,9 +12,12 @@
 #include <hpx/modules/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/zero_copy_chunks_owner.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/serialize_buffer_fwd.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -22,6 +25,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace hpx::serialization {
 
@@ -390,6 +394,11 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
+            if (size_ != 0 && adopt_zero_copy_chunk(ar))
+            {
+                return;
+            }
+
             data_ = buffer_type(
                 detail::array_allocator<allocator_type>()(alloc_, size_),
                 [alloc = this->alloc_, size = this->size_](T* p) noexcept {
@@ -402,6 +411,47 @@ namespace hpx::serialization {
             }
         }
 
+        // Reference the received data in place instead of copying it, if
+        // the archive is able to share the ownership of its zero-copy chunks.
+        template <typename Archive>
+        bool adopt_zero_copy_chunk([[maybe_unused]] Archive& ar)
+        {
+            using element_type = std::remove_const_t<T>;
+
+            constexpr bool use_optimized =
+                std::is_trivially_copyable_v<element_type> &&
+                (hpx::traits::is_bitwise_serializable_v<element_type> ||
+                    !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+
+            if constexpr (std::is_same_v<Archive, input_archive> &&
+                use_optimized)
+            {
+                auto const* chunks_owner = ar.template try_get_extra_data<
+                    detail::zero_copy_chunks_owner>();
+                if (chunks_owner == nullptr || !chunks_owner->owner_ ||
+                    ar.disable_array_optimization() || ar.endianess_differs())
+                {
+                    return false;
+                }
+
+                void* p =
+                    ar.try_adopt_binary_chunk(size_ * sizeof(T), alignof(T));
+                if (p == nullptr)
+                {
+                    return false;
+                }
+
+                // the deleter keeps the received chunks alive
+                data_ = buffer_type(static_cast<T*>(p),
+                    [owner = chunks_owner->owner_](T*) noexcept {});
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
@@ -0,0 +1,160 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the de-serialization of large arrays of doubles that
+// were sent as zero-copy chunks. It compares loading the data into a
+// std::vector (always copied), into a serialize_buffer (copied), and into a
+// serialize_buffer adopting the received chunk (not copied).
+
+#include <hpx/serialization/detail/zero_copy_chunks_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+using chunks_type = std::vector<hpx::serialization::serialization_chunk>;
+
+///////////////////////////////////////////////////////////////////////////////
+// Serialize the given value and copy all zero-copy chunks into separately
+// allocated memory, similar to what a parcelport does while receiving data.
+template <typename T>
+std::size_t serialize(T const& t, std::vector<char>& data, chunks_type& chunks,
+    std::shared_ptr<std::vector<std::vector<char>>>& received)
+{
+    data.clear();
+    chunks.clear();
+
+    hpx::serialization::output_archive oarchive(data, 0, &chunks);
+    oarchive << t;
+
+    received = std::make_shared<std::vector<std::vector<char>>>();
+    for (auto& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            auto const* p = static_cast<char const*>(c.data());
+            std::vector<char>& r = received->emplace_back(p, p + c.size_);
+            c = hpx::serialization::create_pointer_chunk(r.data(), r.size());
+        }
+    }
+    return oarchive.bytes_written();
+}
+
+template <typename T>
+double measure(char const* name, T const& value, std::size_t bytes,
+    std::size_t iterations, bool adopt)
+{
+    std::vector<char> data;
+    chunks_type chunks;
+    std::shared_ptr<std::vector<std::vector<char>>> received;
+    std::size_t const size = serialize(value, data, chunks, received);
+
+    std::chrono::nanoseconds elapsed(0);
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        // reset the chunks as they are advanced while loading
+        chunks_type current_chunks = chunks;
+
+        auto const start = std::chrono::high_resolution_clock::now();
+        {
+            hpx::serialization::input_archive iarchive(
+                data, size, &current_chunks);
+            if (adopt)
+            {
+                iarchive
+                    .get_extra_data<
+                        hpx::serialization::detail::zero_copy_chunks_owner>()
+                    .owner_ = received;
+            }
+
+            T result;
+            iarchive >> result;
+
+            if (result.size() != value.size() ||
+                result[value.size() - 1] != value[value.size() - 1])
+            {
+                throw std::logic_error("de-serialization failed");
+            }
+        }
+        elapsed += std::chrono::high_resolution_clock::now() - start;
+    }
+
+    double const seconds = std::chrono::duration<double>(elapsed).count();
+    double const gbps = (static_cast<double>(bytes) *
+                            static_cast<double>(iterations)) /
+        seconds / 1e9;
+
+    std::cout << name << ": " << seconds * 1e3 / iterations
+              << " ms per iteration, " << gbps << " GB/s" << std::endl;
+
+    return seconds;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cout << "usage: " << argv[0] << " MB N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " MB -- size of the array in megabytes" << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t megabytes;
+    std::size_t iterations;
+    try
+    {
+        megabytes = hpx::util::from_string<std::size_t>(argv[1]);
+        iterations = hpx::util::from_string<std::size_t>(argv[2]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "Both positional arguments must be integers."
+                  << std::endl;
+        return -1;
+    }
+
+    std::size_t const count = (megabytes << 20) / sizeof(double);
+    if (count == 0 || iterations == 0)
+    {
+        std::cerr << "Error: size and number of iterations must be positive"
+                  << std::endl;
+        return -1;
+    }
+
+    std::vector<double> v(count);
+    std::iota(v.begin(), v.end(), 0.0);
+
+    buffer_type b(v.data(), v.size(), buffer_type::reference);
+
+    std::size_t const bytes = count * sizeof(double);
+    std::cout << "array size: " << bytes << " bytes" << std::endl;
+
+    measure("std::vector (copy)             ", v, bytes, iterations, false);
+    double const copy = measure(
+        "serialize_buffer (copy)        ", b, bytes, iterations, false);
+    double const adopt = measure(
+        "serialize_buffer (adopt chunk) ", b, bytes, iterations, true);
+
+    std::cout << "speedup of adopting the chunk: " << copy / adopt
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/zero_copy_chunks_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+///////////////////////////////////////////////////////////////////////////////
+// Simulate a parcelport: the zero-copy chunks are received into separately
+// allocated memory which is referenced by the (pointer) chunks.
+struct received_message
+{
+    explicit received_message(buffer_type const& b, std::vector<double>& v)
+    {
+        hpx::serialization::output_archive oarchive(data, 0, &chunks);
+        oarchive << b << v;
+        size = oarchive.bytes_written();
+
+        auto received = std::make_shared<std::vector<std::vector<char>>>();
+        for (auto& c : chunks)
+        {
+            if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+            {
+                auto const* p = static_cast<char const*>(c.data());
+                std::vector<char>& r = received->emplace_back(p, p + c.size_);
+                c = hpx::serialization::create_pointer_chunk(
+                    r.data(), r.size());
+            }
+        }
+        owner = received;
+    }
+
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    std::shared_ptr<void> owner;
+};
+
+void test_serialize_buffer(std::size_t size, bool adopt)
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    buffer_type ob(data.data(), data.size(), buffer_type::reference);
+    std::vector<double> ov(data);
+
+    received_message msg(ob, ov);
+
+    buffer_type ib;
+    std::vector<double> iv;
+    {
+        hpx::serialization::input_archive iarchive(
+            msg.data, msg.size, &msg.chunks);
+        if (adopt)
+        {
+            iarchive
+                .get_extra_data<
+                    hpx::serialization::detail::zero_copy_chunks_owner>()
+                .owner_ = msg.owner;
+        }
+        iarchive >> ib >> iv;
+    }
+
+    HPX_TEST_EQ(ib.size(), ob.size());
+    HPX_TEST(std::equal(ib.begin(), ib.end(), ob.begin()));
+    HPX_TEST(iv == ov);
+
+    // only the serialize_buffer may reference the received chunk
+    bool const is_zero_copy = size * sizeof(double) >=
+        HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+    if (adopt && is_zero_copy)
+    {
+        auto const& received =
+            *std::static_pointer_cast<std::vector<std::vector<char>>>(
+                msg.owner);
+        HPX_TEST_EQ(static_cast<void*>(ib.data()),
+            static_cast<void const*>(received[0].data()));
+        HPX_TEST_EQ(msg.owner.use_count(), 2l);
+
+        // the received chunks are kept alive by the buffer
+        std::weak_ptr<void> owner = msg.owner;
+        msg.owner.reset();
+        HPX_TEST(!owner.expired());
+        HPX_TEST_EQ(ib[size - 1], static_cast<double>(size - 1));
+
+        ib = buffer_type();
+        HPX_TEST(owner.expired());
+    }
+    else
+    {
+        HPX_TEST_EQ(msg.owner.use_count(), 1l);
+    }
+}
+
+int main()
+{
+    for (bool adopt : {false, true})
+    {
+        test_serialize_buffer(16, adopt);
+        test_serialize_buffer(100000, adopt);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,465 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::lcos::local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free, unbounded channel supporting multiple producers and
+    // multiple consumers. The data is stored in a lock-free concurrent queue,
+    // i.e. neither set() nor the non-blocking get operations acquire a lock or
+    // allocate a shared state (the queue allocates its storage in blocks).
+    //
+    // Items are delivered in FIFO order per producer, there is no global
+    // ordering between items set by different producers. A producer is either
+    // an explicit producer token (see make_producer_token()) or, for set()
+    // without a token, the OS thread calling set(). As HPX threads may be
+    // resumed on a different OS thread after any suspension, the values set
+    // without a token by the same HPX thread are ordered only if there is no
+    // suspension point in between. Use a producer token where the order has
+    // to be preserved, e.g. for the stages of a pipeline.
+    //
+    // Consumers either poll the channel (try_get, get_n) or use async_get(),
+    // which returns a sender that completes inline if an item is available.
+    // Only if the channel is empty the operation state of the connected
+    // receiver is registered (without allocation) with the channel and is
+    // completed by the next producer.
+    template <typename T>
+    class unbounded_channel
+    {
+    private:
+        using mutex_type = hpx::spinlock;
+        using queue_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        // Operation states of pending async_get() operations are linked into
+        // an intrusive FIFO list protected by mtx_.
+        struct waiter_base
+        {
+            virtual void deliver(T&& val) noexcept = 0;
+            virtual void cancel(std::exception_ptr const& e) noexcept = 0;
+
+            waiter_base* next_ = nullptr;
+
+        protected:
+            ~waiter_base() = default;
+        };
+
+    public:
+        // Identifies a single producer, the values stored through the same
+        // token are retrieved in the order they were stored. A token may be
+        // used by one thread at a time only, it must not outlive the channel.
+        using producer_token = typename queue_type::producer_token_t;
+
+        unbounded_channel() = default;
+
+        explicit unbounded_channel(std::size_t initial_capacity)
+          : queue_(initial_capacity)
+        {
+        }
+
+        unbounded_channel(unbounded_channel const&) = delete;
+        unbounded_channel(unbounded_channel&&) = delete;
+        unbounded_channel& operator=(unbounded_channel const&) = delete;
+        unbounded_channel& operator=(unbounded_channel&&) = delete;
+
+        ~unbounded_channel()
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                close(l);
+            }
+            HPX_ASSERT(waiters_head_ == nullptr);
+        }
+
+        // Store the given value in the channel. Returns false if the channel
+        // was closed.
+        bool set(T&& t)
+        {
+            if (closed_.load(std::memory_order_acquire) ||
+                !queue_.enqueue(HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        bool set(T const& t)
+        {
+            if (closed_.load(std::memory_order_acquire) || !queue_.enqueue(t))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        // Store the n values starting at first in the channel. Returns false
+        // if the channel was closed.
+        template <typename Iterator>
+        bool set_n(Iterator first, std::size_t n)
+        {
+            if (closed_.load(std::memory_order_acquire) ||
+                !queue_.enqueue_bulk(first, n))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        // Create a new producer token for this channel.
+        [[nodiscard]] producer_token make_producer_token()
+        {
+            return producer_token(queue_);
+        }
+
+        // Store the given value(s) in the channel on behalf of the producer
+        // identified by the given token. Returns false if the channel was
+        // closed.
+        bool set(producer_token const& token, T&& t)
+        {
+            if (closed_.load(std::memory_order_acquire) ||
+                !queue_.enqueue(token, HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        bool set(producer_token const& token, T const& t)
+        {
+            if (closed_.load(std::memory_order_acquire) ||
+                !queue_.enqueue(token, t))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        template <typename Iterator>
+        bool set_n(producer_token const& token, Iterator first, std::size_t n)
+        {
+            if (closed_.load(std::memory_order_acquire) ||
+                !queue_.enqueue_bulk(token, first, n))
+            {
+                return false;
+            }
+
+            notify_waiters();
+            return true;
+        }
+
+        // Retrieve one value from the channel, if available. Returns false if
+        // the channel is empty.
+        bool try_get(T& val)
+        {
+            return queue_.try_dequeue(val);
+        }
+
+        // Retrieve up to max values from the channel, storing them using the
+        // given output iterator. Returns the number of values retrieved.
+        template <typename OutIterator>
+        std::size_t get_n(OutIterator out, std::size_t max)
+        {
+            return queue_.try_dequeue_bulk(out, max);
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            return queue_.size_approx() == 0;
+        }
+
+        [[nodiscard]] std::size_t size_approx() const noexcept
+        {
+            return queue_.size_approx();
+        }
+
+        [[nodiscard]] bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+        // Close the channel. Values already stored in the channel can still
+        // be retrieved, all pending async_get() operations are completed
+        // with an error. Returns the number of canceled operations.
+        std::size_t close()
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::unbounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+            return close(l);
+        }
+
+    private:
+        template <typename R>
+        struct operation_state final : waiter_base
+        {
+            std::decay_t<R> r;
+            unbounded_channel* channel;
+
+            template <typename R_>
+            operation_state(R_&& r, unbounded_channel* channel)
+              : r(HPX_FORWARD(R_, r))
+              , channel(channel)
+            {
+            }
+
+            operation_state(operation_state&&) = delete;
+            operation_state& operator=(operation_state&&) = delete;
+            operation_state(operation_state const&) = delete;
+            operation_state& operator=(operation_state const&) = delete;
+
+            void deliver(T&& val) noexcept override
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r), HPX_MOVE(val));
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r), HPX_MOVE(ep));
+                    });
+            }
+
+            void cancel(std::exception_ptr const& e) noexcept override
+            {
+                hpx::execution::experimental::set_error(HPX_MOVE(r), e);
+            }
+
+            void start() noexcept
+            {
+                // fast path: the value is available, complete inline
+                std::optional<T> val;
+                if (channel->queue_.try_dequeue(val))
+                {
+                    deliver(HPX_MOVE(*val));
+                    return;
+                }
+                channel->add_waiter(this);
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                os.start();
+            }
+        };
+
+        struct sender
+        {
+            unbounded_channel* channel;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<T>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                sender const&, Env) -> generate_completion_signatures<Env>;
+
+            template <typename R>
+            friend operation_state<R> tag_invoke(
+                hpx::execution::experimental::connect_t, sender&& s, R&& r)
+            {
+                return {HPX_FORWARD(R, r), s.channel};
+            }
+
+            template <typename R>
+            friend operation_state<R> tag_invoke(
+                hpx::execution::experimental::connect_t, sender const& s,
+                R&& r)
+            {
+                return {HPX_FORWARD(R, r), s.channel};
+            }
+        };
+
+    public:
+        // Return a sender that completes with the next value retrieved from
+        // the channel. The sender completes with an error if the channel is
+        // (or becomes) closed while being empty.
+        [[nodiscard]] sender async_get() noexcept
+        {
+            return sender{this};
+        }
+
+    private:
+        // The producers publish a value and then check for waiters, the
+        // consumers register as a waiter and then check for values. The fences
+        // guarantee that at least one of both sides sees the other.
+        void notify_waiters()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (num_waiters_.data_.load(std::memory_order_relaxed) != 0)
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                deliver_to_waiters(l);
+            }
+        }
+
+        void add_waiter(waiter_base* w)
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+
+            if (waiters_tail_ != nullptr)
+            {
+                waiters_tail_->next_ = w;
+            }
+            else
+            {
+                waiters_head_ = w;
+            }
+            waiters_tail_ = w;
+            num_waiters_.data_.fetch_add(1, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            deliver_to_waiters(l);
+
+            // a closed empty channel will never be able to satisfy waiters
+            if (waiters_head_ != nullptr &&
+                closed_.load(std::memory_order_relaxed))
+            {
+                cancel_waiters(l);
+            }
+        }
+
+        waiter_base* pop_waiter(std::unique_lock<mutex_type>& l) noexcept
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            waiter_base* w = waiters_head_;
+            waiters_head_ = w->next_;
+            if (waiters_head_ == nullptr)
+            {
+                waiters_tail_ = nullptr;
+            }
+            w->next_ = nullptr;
+            num_waiters_.data_.fetch_sub(1, std::memory_order_relaxed);
+            return w;
+        }
+
+        void deliver_to_waiters(std::unique_lock<mutex_type>& l)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            // T is not required to be default constructible
+            std::optional<T> val;
+            while (waiters_head_ != nullptr && queue_.try_dequeue(val))
+            {
+                waiter_base* w = pop_waiter(l);
+
+                // the receiver may run arbitrary code
+                hpx::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                w->deliver(HPX_MOVE(*val));
+            }
+        }
+
+        std::size_t cancel_waiters(std::unique_lock<mutex_type>& l)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            if (waiters_head_ == nullptr)
+            {
+                return 0;
+            }
+
+            std::exception_ptr e;
+            {
+                hpx::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                e = HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                    hpx::throwmode::lightweight,
+                    "hpx::lcos::local::unbounded_channel::async_get",
+                    "this channel is empty and was closed");
+            }
+
+            std::size_t count = 0;
+            while (waiters_head_ != nullptr)
+            {
+                waiter_base* w = pop_waiter(l);
+                ++count;
+
+                hpx::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                w->cancel(e);
+            }
+            return count;
+        }
+
+        std::size_t close(std::unique_lock<mutex_type>& l)
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            closed_.store(true, std::memory_order_release);
+
+            // values stored concurrently to close() are handed out first
+            deliver_to_waiters(l);
+            return cancel_waiters(l);
+        }
+
+    private:
+        // keep the queue, the mutex, and the waiter count in separate cache
+        // lines
+        queue_type queue_;
+        hpx::util::cache_aligned_data<mutex_type> mtx_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> num_waiters_{
+            0};
+
+        waiter_base* waiters_head_ = nullptr;
+        waiter_base* waiters_tail_ = nullptr;
+
+        std::atomic<bool> closed_{false};
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // The lock-free counterpart of channel_mpmc without a size limit.
+    template <typename T>
+    using channel_mpmc_unbounded = unbounded_channel<T>;
+}    // namespace hpx::lcos::local
@@ -0,0 +1,199 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the throughput of the lock-free unbounded channel
+// with the bounded channel_spsc and channel_mpmc implementations using a single
+// producer and a single consumer.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/thread.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data() = default;
+
+    explicit data(int d)
+    {
+        data_[0] = d;
+    }
+
+    int data_[8];
+};
+
+#if HPX_DEBUG
+constexpr int NUM_TESTS = 1000000;
+#else
+constexpr int NUM_TESTS = 10000000;
+#endif
+
+constexpr std::size_t BATCH_SIZE = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+// bounded channels
+template <typename Channel>
+inline data channel_get(Channel const& c)
+{
+    data result;
+    while (!c.get(&result))
+    {
+        hpx::this_thread::yield();
+    }
+    return result;
+}
+
+template <typename Channel>
+inline void channel_set(Channel& c, data&& val)
+{
+    while (!c.set(std::move(val)))    // NOLINT
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+// unbounded channel
+inline data channel_get(hpx::lcos::local::channel_mpmc_unbounded<data>& c)
+{
+    data result;
+    while (!c.try_get(result))
+    {
+        hpx::this_thread::yield();
+    }
+    return result;
+}
+
+inline void channel_set(
+    hpx::lcos::local::channel_mpmc_unbounded<data>& c, data&& val)
+{
+    c.set(std::move(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Produce
+template <typename Channel>
+double produce(Channel& c)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != NUM_TESTS; ++i)
+    {
+        channel_set(c, data{i});
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+// Consume
+template <typename Channel>
+double consume(Channel& c)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != NUM_TESTS; ++i)
+    {
+        data d = channel_get(c);
+        if (d.data_[0] != i)
+        {
+            std::cout << "Error!\n";
+        }
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+// Consume in batches
+double consume_batched(hpx::lcos::local::channel_mpmc_unbounded<data>& c)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::array<data, BATCH_SIZE> batch;
+    int i = 0;
+    while (i != NUM_TESTS)
+    {
+        std::size_t const count = c.get_n(batch.begin(), BATCH_SIZE);
+        if (count == 0)
+        {
+            hpx::this_thread::yield();
+            continue;
+        }
+
+        for (std::size_t j = 0; j != count; ++j, ++i)
+        {
+            if (batch[j].data_[0] != i)
+            {
+                std::cout << "Error!\n";
+            }
+        }
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_results(
+    std::string const& name, double producer_time, double consumer_time)
+{
+    std::cout << name << ":\n";
+    std::cout << "  Producer throughput: " << (NUM_TESTS / producer_time)
+              << " [op/s] (" << (producer_time / NUM_TESTS) << " [s/op])\n";
+    std::cout << "  Consumer throughput: " << (NUM_TESTS / consumer_time)
+              << " [op/s] (" << (consumer_time / NUM_TESTS) << " [s/op])\n";
+}
+
+template <typename Channel, typename Consume>
+void run_benchmark(std::string const& name, Channel& c, Consume&& consumer_func)
+{
+    hpx::future<double> producer = hpx::async(&produce<Channel>, std::ref(c));
+    hpx::future<double> consumer = hpx::async(consumer_func, std::ref(c));
+
+    auto producer_time = producer.get();
+    auto consumer_time = consumer.get();
+    print_results(name, producer_time, consumer_time);
+}
+
+int hpx_main()
+{
+    {
+        hpx::lcos::local::channel_spsc<data> c(10000);
+        run_benchmark("channel_spsc", c, &consume<decltype(c)>);
+    }
+    {
+        hpx::lcos::local::channel_mpmc<data> c(10000);
+        run_benchmark("channel_mpmc", c, &consume<decltype(c)>);
+    }
+    {
+        hpx::lcos::local::channel_mpmc_unbounded<data> c;
+        run_benchmark("channel_mpmc_unbounded", c, &consume<decltype(c)>);
+    }
+    {
+        hpx::lcos::local::channel_mpmc_unbounded<data> c;
+        run_benchmark("channel_mpmc_unbounded (get_n)", c, &consume_batched);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
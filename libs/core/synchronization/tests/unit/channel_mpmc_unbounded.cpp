@@ -0,0 +1,250 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace tt = hpx::this_thread::experimental;
+
+constexpr int NUM_ITEMS = 10000;
+constexpr int NUM_PRODUCERS = 4;
+constexpr int NUM_CONSUMERS = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_set_try_get()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<int> c;
+    HPX_TEST(c.is_empty());
+
+    int val = 0;
+    HPX_TEST(!c.try_get(val));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.set(i));
+    }
+    HPX_TEST_EQ(c.size_approx(), std::size_t(10));
+
+    // values set by the same thread are retrieved in order
+    HPX_TEST(c.try_get(val));
+    HPX_TEST_EQ(val, 0);
+
+    std::vector<int> values;
+    HPX_TEST_EQ(c.get_n(std::back_inserter(values), 5), std::size_t(5));
+    HPX_TEST_EQ(values.size(), std::size_t(5));
+    for (int i = 0; i != 5; ++i)
+    {
+        HPX_TEST_EQ(values[i], i + 1);
+    }
+
+    values.clear();
+    HPX_TEST_EQ(c.get_n(std::back_inserter(values), 100), std::size_t(4));
+    HPX_TEST(c.is_empty());
+
+    std::vector<int> bulk(10);
+    std::iota(bulk.begin(), bulk.end(), 0);
+    HPX_TEST(c.set_n(bulk.begin(), bulk.size()));
+    HPX_TEST_EQ(c.size_approx(), std::size_t(10));
+}
+
+void test_async_get_ready()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<int> c;
+    c.set(42);
+
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(c.async_get())), 42);
+}
+
+void test_async_get_pending()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<int> c;
+
+    std::vector<hpx::future<long>> consumers;
+    consumers.reserve(NUM_CONSUMERS);
+    for (int i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        consumers.push_back(hpx::async([&c]() {
+            long sum = 0;
+            for (int j = 0; j != NUM_ITEMS; ++j)
+            {
+                sum += hpx::get<0>(*tt::sync_wait(c.async_get()));
+            }
+            return sum;
+        }));
+    }
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(NUM_PRODUCERS);
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(hpx::async([&c]() {
+            for (int j = 0; j != NUM_ITEMS; ++j)
+            {
+                HPX_TEST(c.set(j));
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+
+    long sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    long const expected =
+        long(NUM_PRODUCERS) * (long(NUM_ITEMS) * (NUM_ITEMS - 1) / 2);
+    HPX_TEST_EQ(sum, expected);
+    HPX_TEST(c.is_empty());
+}
+
+void test_close()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<int> c;
+    c.set(1);
+
+    hpx::future<void> f = hpx::async([&c]() {
+        // the first value is still available, the second request fails
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(c.async_get())), 1);
+
+        bool caught_exception = false;
+        try
+        {
+            tt::sync_wait(c.async_get());
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    });
+
+    hpx::this_thread::yield();
+    c.close();
+    HPX_TEST(c.is_closed());
+    HPX_TEST(!c.set(2));
+
+    f.get();
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// values set through a producer token are retrieved in order, even if the
+// producing thread is suspended (and possibly resumed on a different worker
+// thread) in between
+void test_producer_token()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<int> c;
+
+    constexpr int num_values = 1000;
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(NUM_PRODUCERS);
+    for (int i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        producers.push_back(hpx::async([&c, i]() {
+            auto const token = c.make_producer_token();
+            for (int j = 0; j != num_values; ++j)
+            {
+                HPX_TEST(c.set(token, i * num_values + j));
+                if (j % 10 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    std::vector<int> last(NUM_PRODUCERS, -1);
+    for (int n = 0; n != NUM_PRODUCERS * num_values; ++n)
+    {
+        int const val = hpx::get<0>(*tt::sync_wait(c.async_get()));
+        int const producer = val / num_values;
+        HPX_TEST_LT(last[producer], val % num_values);
+        last[producer] = val % num_values;
+    }
+
+    hpx::wait_all(producers);
+    HPX_TEST(c.is_empty());
+
+    std::vector<int> bulk(10);
+    std::iota(bulk.begin(), bulk.end(), 0);
+
+    auto const token = c.make_producer_token();
+    HPX_TEST(c.set_n(token, bulk.begin(), bulk.size()));
+
+    std::vector<int> values;
+    HPX_TEST_EQ(c.get_n(std::back_inserter(values), 100), bulk.size());
+    HPX_TEST(values == bulk);
+}
+
+// the value type is not required to be default constructible
+struct no_default
+{
+    explicit no_default(int v)
+      : value(v)
+    {
+    }
+
+    int value;
+};
+
+void test_no_default_constructor()
+{
+    hpx::lcos::local::channel_mpmc_unbounded<no_default> c;
+
+    // delivered inline
+    c.set(no_default(1));
+    HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(c.async_get())).value, 1);
+
+    // delivered to a waiting consumer
+    hpx::future<int> f = hpx::async(
+        [&c]() { return hpx::get<0>(*tt::sync_wait(c.async_get())).value; });
+
+    hpx::this_thread::yield();
+    c.set(no_default(2));
+    HPX_TEST_EQ(f.get(), 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_set_try_get();
+    test_async_get_ready();
+    test_async_get_pending();
+    test_close();
+    test_producer_token();
+    test_no_default_constructor();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
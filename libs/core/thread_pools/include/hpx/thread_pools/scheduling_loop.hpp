@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/epoch.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
 #include <hpx/hardware/timestamp.hpp>
@@ -18,6 +19,7 @@
 #include <hpx/threading_base/detail/switch_status.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
@@ -36,6 +38,27 @@
 
 namespace hpx::threads::detail {
 
+    ///////////////////////////////////////////////////////////////////////
+    inline void trace_thread_run(thread_data const* thrdptr) noexcept
+    {
+        if (HPX_UNLIKELY(tracing::enabled()))
+        {
+            tracing::detail::record(tracing::event_type::thread_run, thrdptr,
+                tracing::get_name(thrdptr->get_description()),
+                static_cast<std::uint32_t>(thrdptr->get_thread_phase()));
+        }
+    }
+
+    inline void trace_thread_stop(
+        thread_data const* thrdptr, thread_schedule_state state) noexcept
+    {
+        tracing::record(state == thread_schedule_state::terminated ||
+                    state == thread_schedule_state::deleted ?
+                tracing::event_type::thread_terminate :
+                tracing::event_type::thread_suspend,
+            thrdptr);
+    }
+
     ///////////////////////////////////////////////////////////////////////
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
     struct idle_collect_rate
@@ -136,10 +159,19 @@ namespace hpx::threads::detail {
             context_storage =
                 hpx::execution_base::this_thread::detail::get_agent_storage();
 
+        // this worker thread reports a quiescent state to the epoch based
+        // memory reclamation whenever it switches between HPX threads (once
+        // the reclamation is used at all)
+        hpx::util::epoch::worker_started();
+        auto epoch_stopped = hpx::experimental::scope_exit(
+            [] { hpx::util::epoch::worker_stopped(); });
+
         auto added = static_cast<std::size_t>(-1);
         thread_id_ref_type next_thrd;
         while (true)
         {
+            hpx::util::epoch::worker_quiescent_state();
+
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
             next_thrd = thread_id_ref_type();
 
@@ -239,6 +271,8 @@ namespace hpx::threads::detail {
                                             idle_rate.collect_exec_time(ts);
                                         });
 #endif
+                                trace_thread_run(thrdptr);
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -267,6 +301,9 @@ namespace hpx::threads::detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+
+                                trace_thread_stop(
+                                    thrdptr, thrd_stat.get_previous());
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
@@ -414,6 +451,9 @@ namespace hpx::threads::detail {
             {
                 ++idle_loop_count;
 
+                // write the task trace if this was requested asynchronously
+                tracing::handle_dump_request();
+
                 next_thrd = thread_id_ref_type();
                 if (scheduler.wait_or_add_new(num_thread, running,
                         idle_loop_count, enable_stealing_staged, added,
@@ -431,7 +471,11 @@ namespace hpx::threads::detail {
                     {
                         if (can_exit)
                         {
+                            // a sleeping worker must not hold up the
+                            // reclamation of memory
+                            hpx::util::epoch::worker_stopped();
                             scheduler.SchedulingPolicy::suspend(num_thread);
+                            hpx::util::epoch::worker_started();
                         }
                     }
                     else
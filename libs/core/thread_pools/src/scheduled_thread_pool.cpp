@@ -7,6 +7,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/local_deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
@@ -29,6 +30,9 @@ template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::background_scheduler<>>;
 
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_deadline_queue_scheduler<>>;
+
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
         hpx::threads::policies::lockfree_fifo>>;
@@ -293,8 +293,7 @@ namespace hpx {
         protected:
             using base_type = lcos::detail::future_data<void>;
             using result_type = base_type::result_type;
-
-            using base_type::mtx_;
+            using mutex_type = base_type::mutex_type;
 
         public:
             thread_task_base(threads::thread_id_ref_type const& id)
@@ -341,6 +340,7 @@ namespace hpx {
             }
 
         private:
+            mutable mutex_type mtx_;
             threads::thread_id_ref_type id_;
         };
     }    // namespace detail
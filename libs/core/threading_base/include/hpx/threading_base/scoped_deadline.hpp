@@ -0,0 +1,69 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the deadline (in nanoseconds as returned by
+    // hpx::chrono::high_resolution_clock::now()) to be attached to threads
+    // created from the current context, zero if none. On an HPX thread this
+    // is the deadline of the running thread, i.e. deadlines are inherited by
+    // child threads. Otherwise this is the deadline set by a
+    // scoped_deadline on the calling OS thread.
+    HPX_CORE_EXPORT std::uint64_t get_spawn_deadline() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Set the deadline for all threads created from the current context while
+    // this object is alive. The given duration is relative to the time of
+    // construction, a zero duration leaves the current deadline unchanged.
+    //
+    // This is constructed on every launch of a task through the
+    // parallel_executor, the (common) case of no deadline is handled inline.
+    class HPX_CORE_EXPORT scoped_deadline
+    {
+    public:
+        explicit scoped_deadline(std::chrono::nanoseconds rel_deadline)
+          : previous_(0)
+          , active_(rel_deadline.count() > 0)
+        {
+            if (active_)
+            {
+                activate(rel_deadline);
+            }
+        }
+
+        ~scoped_deadline()
+        {
+            if (active_)
+            {
+                deactivate();
+            }
+        }
+
+        scoped_deadline(scoped_deadline const&) = delete;
+        scoped_deadline(scoped_deadline&&) = delete;
+        scoped_deadline& operator=(scoped_deadline const&) = delete;
+        scoped_deadline& operator=(scoped_deadline&&) = delete;
+
+    private:
+        void activate(std::chrono::nanoseconds rel_deadline);
+        void deactivate() noexcept;
+
+        std::uint64_t previous_;
+        bool active_;
+    };
+}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,150 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_tracer.hpp
+/// \page hpx::threads::tracing
+/// \headerfile hpx/threading_base/task_tracer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+// The task tracer records task level events (creation, execution, suspension,
+// termination, and stealing of HPX threads, sending and receiving parcels)
+// into per-OS-thread ring buffers. Recording an event does not synchronize
+// with other threads and does not allocate memory (except when the first
+// event is recorded on an OS thread). Once a buffer is full the oldest events
+// are overwritten, i.e. a dump always contains the most recent events.
+//
+// The collected events can be written in the Chrome trace event format
+// (JSON, can be loaded into chrome://tracing or https://ui.perfetto.dev) or
+// in the Perfetto protobuf trace format.
+//
+// The tracer is controlled by the following configuration settings:
+//
+//   hpx.trace.enable=0|1       enable recording events
+//   hpx.trace.buffer_size=N    number of events stored per OS thread
+//   hpx.trace.destination=F    file the trace is written to on shutdown, on
+//                              SIGUSR2, and when the performance counters are
+//                              reset; the format is derived from the file
+//                              extension ('.pftrace' and '.perfetto-trace'
+//                              select the Perfetto format, Chrome JSON is
+//                              used otherwise)
+namespace hpx::threads::tracing {
+
+    /// Type of a recorded event
+    enum class event_type : std::uint8_t
+    {
+        thread_create = 0,       ///< an HPX thread was created
+        thread_run = 1,          ///< an HPX thread starts/resumes executing
+        thread_suspend = 2,      ///< an HPX thread was suspended or yielded
+        thread_terminate = 3,    ///< an HPX thread has run to completion
+        thread_steal = 4,        ///< an HPX thread was stolen by a worker
+        parcel_send = 5,         ///< a parcel was handed to the parcel layer
+        parcel_receive = 6       ///< a parcel was received and decoded
+    };
+
+    /// Output format of the trace
+    enum class trace_format : std::uint8_t
+    {
+        chrome_json = 0,    ///< Chrome trace event format (JSON)
+        perfetto = 1        ///< Perfetto protobuf trace format
+    };
+
+    /// The data stored for each event, 32 bytes on 64 bit platforms
+    struct event
+    {
+        std::uint64_t timestamp;    // hardware time stamp
+        void const* id;             // thread id or parcel address
+        char const* name;           // function annotation or action name
+        std::uint32_t arg;          // event specific argument
+        event_type type;
+    };
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> tracing_enabled;
+        HPX_CORE_EXPORT extern std::atomic<bool> dump_requested;
+
+        HPX_CORE_EXPORT void record(event_type type, void const* id,
+            char const* name, std::uint32_t arg) noexcept;
+
+        HPX_CORE_EXPORT void handle_dump_request() noexcept;
+    }    // namespace detail
+
+    /// Return whether events are currently being recorded
+    [[nodiscard]] inline bool enabled() noexcept
+    {
+        return detail::tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Enable or disable recording events
+    HPX_CORE_EXPORT void enable(bool enable = true);
+
+    /// Set the number of events each OS thread keeps (rounded up to the next
+    /// power of two). Affects only buffers allocated after this call.
+    HPX_CORE_EXPORT void set_buffer_size(std::size_t num_events);
+
+    /// Set the file the trace is written to by \a dump()
+    HPX_CORE_EXPORT void set_destination(std::string destination);
+    HPX_CORE_EXPORT std::string get_destination();
+
+    /// Record an event, does nothing if tracing is not enabled
+    inline void record(event_type type, void const* id,
+        char const* name = nullptr, std::uint32_t arg = 0) noexcept
+    {
+        if (HPX_UNLIKELY(enabled()))
+        {
+            detail::record(type, id, name, arg);
+        }
+    }
+
+    /// Return the name to record for a thread with the given description
+    [[nodiscard]] inline char const* get_name(
+        thread_description const& desc) noexcept
+    {
+        return desc.kind() == thread_description::data_type_description ?
+            desc.get_description() :
+            nullptr;
+    }
+
+    /// Write all events currently stored in the buffers to the given stream.
+    HPX_CORE_EXPORT void write_trace(std::ostream& os, trace_format format);
+
+    /// Write all events currently stored to the configured destination, does
+    /// nothing if no destination was set.
+    HPX_CORE_EXPORT void dump();
+
+    /// Request writing the trace from an asynchronous context (e.g. a signal
+    /// handler). The request is picked up by the next worker thread calling
+    /// \a handle_dump_request(), the trace is written on a separate OS
+    /// thread.
+    inline void request_dump() noexcept
+    {
+        detail::dump_requested.store(true, std::memory_order_relaxed);
+    }
+
+    /// Start writing the trace if it was requested by \a request_dump(),
+    /// does not block the calling thread on file I/O
+    inline void handle_dump_request() noexcept
+    {
+        if (HPX_UNLIKELY(
+                detail::dump_requested.load(std::memory_order_relaxed)))
+        {
+            detail::handle_dump_request();
+        }
+    }
+
+    /// Discard all recorded events
+    HPX_CORE_EXPORT void clear();
+}    // namespace hpx::threads::tracing
@@ -443,6 +443,17 @@ namespace hpx::threads {
             priority_ = priority;
         }
 
+        // The absolute deadline of this thread (in nanoseconds as returned by
+        // hpx::chrono::high_resolution_clock::now()), zero if none.
+        constexpr std::uint64_t get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -634,6 +645,7 @@ namespace hpx::threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
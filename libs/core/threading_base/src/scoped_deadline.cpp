@@ -0,0 +1,76 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/scoped_deadline.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    namespace {
+
+        // The deadline is stored in the thread_data of HPX threads to stay
+        // valid if the thread is resumed on a different OS thread, this is
+        // used only if no HPX thread is running.
+        std::uint64_t& os_thread_deadline() noexcept
+        {
+            thread_local std::uint64_t deadline = 0;
+            return deadline;
+        }
+
+        thread_data* get_self_data() noexcept
+        {
+            if (threads::get_self_ptr() == nullptr)
+            {
+                return nullptr;
+            }
+            return get_thread_id_data(threads::get_self_id());
+        }
+    }    // namespace
+
+    std::uint64_t get_spawn_deadline() noexcept
+    {
+        if (thread_data const* self = get_self_data())
+        {
+            return self->get_deadline();
+        }
+        return os_thread_deadline();
+    }
+
+    void scoped_deadline::activate(std::chrono::nanoseconds rel_deadline)
+    {
+        std::uint64_t const deadline =
+            hpx::chrono::high_resolution_clock::now() +
+            static_cast<std::uint64_t>(rel_deadline.count());
+
+        if (thread_data* self = get_self_data())
+        {
+            previous_ = self->get_deadline();
+            self->set_deadline(deadline);
+        }
+        else
+        {
+            previous_ = os_thread_deadline();
+            os_thread_deadline() = deadline;
+        }
+    }
+
+    void scoped_deadline::deactivate() noexcept
+    {
+        if (thread_data* self = get_self_data())
+        {
+            self->set_deadline(previous_);
+        }
+        else
+        {
+            os_thread_deadline() = previous_;
+        }
+    }
+}    // namespace hpx::threads
@@ -0,0 +1,813 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace detail {
+
+        std::atomic<bool> tracing_enabled(false);
+        std::atomic<bool> dump_requested(false);
+    }    // namespace detail
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Storage for one event. The members are accessed using relaxed
+        // atomic operations only, as a reader may copy a slot while the
+        // owning thread overwrites it.
+        struct event_slot
+        {
+            void store(event const& e) noexcept
+            {
+                timestamp_.store(e.timestamp, std::memory_order_relaxed);
+                id_.store(e.id, std::memory_order_relaxed);
+                name_.store(e.name, std::memory_order_relaxed);
+                arg_.store(e.arg, std::memory_order_relaxed);
+                type_.store(e.type, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] event load() const noexcept
+            {
+                return event{timestamp_.load(std::memory_order_relaxed),
+                    id_.load(std::memory_order_relaxed),
+                    name_.load(std::memory_order_relaxed),
+                    arg_.load(std::memory_order_relaxed),
+                    type_.load(std::memory_order_relaxed)};
+            }
+
+            std::atomic<std::uint64_t> timestamp_{0};
+            std::atomic<void const*> id_{nullptr};
+            std::atomic<char const*> name_{nullptr};
+            std::atomic<std::uint32_t> arg_{0};
+            std::atomic<event_type> type_{event_type::thread_create};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The events of one OS thread. Only the owning thread writes to the
+        // buffer, readers may observe partially overwritten events which are
+        // discarded based on the head index (similar to a sequence lock).
+        struct event_buffer
+        {
+            event_buffer(std::size_t capacity, std::uint32_t tid,
+                std::size_t global_thread_num)
+              : events_(new event_slot[capacity])
+              , mask_(capacity - 1)
+              , head_(0)
+              , tail_(0)
+              , tid_(tid)
+              , global_thread_num_(global_thread_num)
+            {
+            }
+
+            std::unique_ptr<event_slot[]> events_;
+            std::size_t mask_;
+            std::atomic<std::uint64_t> head_;
+            std::atomic<std::uint64_t> tail_;    // events before were cleared
+            std::uint32_t tid_;
+            std::size_t global_thread_num_;
+        };
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        struct tracer_data
+        {
+            ~tracer_data()
+            {
+                if (dump_thread_.joinable())
+                {
+                    dump_thread_.join();
+                }
+            }
+
+            std::mutex mtx_;
+            std::vector<std::shared_ptr<event_buffer>> buffers_;
+            std::size_t buffer_size_ = 65536;
+            std::string destination_;
+
+            // reference points used to convert hardware time stamps to
+            // nanoseconds
+            std::uint64_t start_timestamp_ = 0;
+            std::uint64_t start_time_ = 0;
+
+            // serializes writing the trace to the destination
+            std::mutex dump_mtx_;
+
+            // requested dumps are written on a separate OS thread to avoid
+            // blocking a worker thread on file I/O, the thread is owned by
+            // whoever sets dump_running_
+            std::atomic<bool> dump_running_{false};
+            std::thread dump_thread_;
+        };
+
+        tracer_data& get_tracer_data()
+        {
+            static tracer_data data;
+            return data;
+        }
+
+        thread_local event_buffer* local_buffer = nullptr;
+
+        event_buffer* register_buffer() noexcept
+        {
+            try
+            {
+                tracer_data& data = get_tracer_data();
+
+                std::lock_guard<std::mutex> l(data.mtx_);
+                auto buffer = std::make_shared<event_buffer>(
+                    data.buffer_size_,
+                    static_cast<std::uint32_t>(data.buffers_.size() + 1),
+                    threads::detail::get_global_thread_num_tss());
+                data.buffers_.push_back(buffer);
+
+                local_buffer = buffer.get();
+                return local_buffer;
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct thread_events
+        {
+            std::uint32_t tid;
+            std::size_t global_thread_num;
+            std::vector<event> events;
+        };
+
+        // copy the events currently stored in all buffers
+        std::vector<thread_events> take_snapshot(tracer_data& data)
+        {
+            std::vector<std::shared_ptr<event_buffer>> buffers;
+            {
+                std::lock_guard<std::mutex> l(data.mtx_);
+                buffers = data.buffers_;
+            }
+
+            std::vector<thread_events> result;
+            result.reserve(buffers.size());
+
+            for (auto const& buffer : buffers)
+            {
+                std::size_t const capacity = buffer->mask_ + 1;
+                std::uint64_t const head =
+                    buffer->head_.load(std::memory_order_acquire);
+                std::uint64_t const first = (std::max)(
+                    head > capacity ? head - capacity : 0,
+                    (std::min)(
+                        buffer->tail_.load(std::memory_order_relaxed), head));
+
+                thread_events& te = result.emplace_back();
+                te.tid = buffer->tid_;
+                te.global_thread_num = buffer->global_thread_num_;
+                te.events.reserve(static_cast<std::size_t>(head - first));
+
+                for (std::uint64_t i = first; i != head; ++i)
+                {
+                    te.events.push_back(
+                        buffer->events_[i & buffer->mask_].load());
+                }
+
+                // Discard the events the owning thread may have overwritten
+                // while they were being copied. The fence synchronizes with
+                // the release fence in record() if any of the copied slots
+                // was modified, in which case the head read below includes
+                // the event being written. This event overwrites the slot of
+                // event 'new_head - capacity', which is discarded as well.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                std::uint64_t const new_head =
+                    buffer->head_.load(std::memory_order_relaxed);
+                if (new_head - first >= capacity)
+                {
+                    auto const overwritten = static_cast<std::size_t>(
+                        (std::min)(new_head - first - capacity + 1,
+                            head - first));
+                    te.events.erase(te.events.begin(),
+                        te.events.begin() +
+                            static_cast<std::ptrdiff_t>(overwritten));
+                }
+            }
+            return result;
+        }
+
+        // converts hardware time stamps into nanoseconds since the tracer was
+        // enabled
+        class time_converter
+        {
+        public:
+            explicit time_converter(tracer_data const& data) noexcept
+              : start_timestamp_(data.start_timestamp_)
+              , ticks_per_ns_(1.0)
+            {
+                std::uint64_t const timestamp = util::hardware::timestamp();
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                if (timestamp > data.start_timestamp_ && now > data.start_time_)
+                {
+                    ticks_per_ns_ =
+                        static_cast<double>(
+                            timestamp - data.start_timestamp_) /
+                        static_cast<double>(now - data.start_time_);
+                }
+            }
+
+            [[nodiscard]] double operator()(
+                std::uint64_t timestamp) const noexcept
+            {
+                if (timestamp < start_timestamp_)
+                {
+                    return 0.0;
+                }
+                return static_cast<double>(timestamp - start_timestamp_) /
+                    ticks_per_ns_;
+            }
+
+        private:
+            std::uint64_t start_timestamp_;
+            double ticks_per_ns_;
+        };
+
+        std::string get_thread_name(thread_events const& te)
+        {
+            if (te.global_thread_num != static_cast<std::size_t>(-1))
+            {
+                return hpx::util::format(
+                    "worker-thread#{}", te.global_thread_num);
+            }
+            return hpx::util::format("thread#{}", te.tid);
+        }
+
+        std::uint32_t get_process_id()
+        {
+            std::uint32_t const id =
+                threads::detail::get_locality_id(hpx::throws);
+            return id == ~static_cast<std::uint32_t>(0) ? 0 : id;
+        }
+
+        char const* get_category(event_type type) noexcept
+        {
+            switch (type)
+            {
+            case event_type::thread_create:
+                return "thread_create";
+            case event_type::thread_run:
+                [[fallthrough]];
+            case event_type::thread_suspend:
+                [[fallthrough]];
+            case event_type::thread_terminate:
+                return "thread";
+            case event_type::thread_steal:
+                return "thread_steal";
+            case event_type::parcel_send:
+                return "parcel_send";
+            case event_type::parcel_receive:
+                return "parcel_receive";
+            }
+            return "<unknown>";
+        }
+
+        char const* get_event_name(event const& e) noexcept
+        {
+            return e.name != nullptr ? e.name : "<unknown>";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_json_string(std::ostream& os, char const* str)
+        {
+            os << '"';
+            for (char const* p = str; *p != '\0'; ++p)
+            {
+                auto const c = static_cast<unsigned char>(*p);
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << *p;
+                }
+                else if (c < 0x20)
+                {
+                    hpx::util::format_to(
+                        os, "\\u{:04x}", static_cast<unsigned int>(c));
+                }
+                else
+                {
+                    os << *p;
+                }
+            }
+            os << '"';
+        }
+
+        void write_chrome_json(
+            std::ostream& os, std::vector<thread_events> const& threads,
+            time_converter const& to_ns, std::uint32_t pid)
+        {
+            os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+            hpx::util::format_to(os,
+                "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},"
+                "\"args\":{{\"name\":\"locality#{}\"}}}}",
+                pid, pid);
+
+            for (thread_events const& te : threads)
+            {
+                hpx::util::format_to(os,
+                    ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},"
+                    "\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+                    pid, te.tid, get_thread_name(te));
+
+                bool running = false;
+                for (event const& e : te.events)
+                {
+                    // skip end events for which the matching begin event was
+                    // overwritten
+                    bool const is_end =
+                        e.type == event_type::thread_suspend ||
+                        e.type == event_type::thread_terminate;
+                    if (is_end && !running)
+                    {
+                        continue;
+                    }
+
+                    os << ",\n{\"name\":";
+                    write_json_string(os, get_event_name(e));
+                    hpx::util::format_to(os,
+                        ",\"cat\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},",
+                        get_category(e.type), pid, te.tid,
+                        to_ns(e.timestamp) / 1000.0);
+
+                    switch (e.type)
+                    {
+                    case event_type::thread_run:
+                        running = true;
+                        hpx::util::format_to(os,
+                            "\"ph\":\"B\",\"args\":{{\"id\":\"{}\","
+                            "\"phase\":{}}}}}",
+                            e.id, e.arg);
+                        break;
+
+                    case event_type::thread_suspend:
+                        [[fallthrough]];
+                    case event_type::thread_terminate:
+                        running = false;
+                        hpx::util::format_to(os,
+                            "\"ph\":\"E\",\"args\":{{\"state\":\"{}\"}}}}",
+                            e.type == event_type::thread_suspend ?
+                                "suspended" :
+                                "terminated");
+                        break;
+
+                    case event_type::parcel_send:
+                        hpx::util::format_to(os,
+                            "\"ph\":\"i\",\"s\":\"t\",\"args\":{{"
+                            "\"parcel\":\"{}\",\"destination\":{}}}}}",
+                            e.id, e.arg);
+                        break;
+
+                    case event_type::parcel_receive:
+                        hpx::util::format_to(os,
+                            "\"ph\":\"i\",\"s\":\"t\",\"args\":{{"
+                            "\"parcel\":\"{}\",\"source\":{}}}}}",
+                            e.id, e.arg);
+                        break;
+
+                    default:
+                        hpx::util::format_to(os,
+                            "\"ph\":\"i\",\"s\":\"t\",\"args\":{{"
+                            "\"id\":\"{}\"}}}}",
+                            e.id);
+                        break;
+                    }
+                }
+            }
+
+            os << "\n]}\n";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Minimal protobuf encoder for the subset of the Perfetto trace format
+        // (protos/perfetto/trace/trace.proto) used here.
+        class proto_message
+        {
+        public:
+            void add_varint(std::uint32_t field, std::uint64_t value)
+            {
+                write_varint((static_cast<std::uint64_t>(field) << 3) | 0);
+                write_varint(value);
+            }
+
+            void add_bytes(
+                std::uint32_t field, char const* data, std::size_t size)
+            {
+                write_varint((static_cast<std::uint64_t>(field) << 3) | 2);
+                write_varint(size);
+                data_.append(data, size);
+            }
+
+            void add_string(std::uint32_t field, std::string const& str)
+            {
+                add_bytes(field, str.data(), str.size());
+            }
+
+            void add_message(std::uint32_t field, proto_message const& msg)
+            {
+                add_bytes(field, msg.data_.data(), msg.data_.size());
+            }
+
+            [[nodiscard]] std::string const& data() const noexcept
+            {
+                return data_;
+            }
+
+        private:
+            void write_varint(std::uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    data_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                    value >>= 7;
+                }
+                data_.push_back(static_cast<char>(value));
+            }
+
+            std::string data_;
+        };
+
+        namespace perfetto {
+
+            // field numbers
+            inline constexpr std::uint32_t trace_packet = 1;
+
+            inline constexpr std::uint32_t packet_timestamp = 8;
+            inline constexpr std::uint32_t packet_sequence_id = 10;
+            inline constexpr std::uint32_t packet_track_event = 11;
+            inline constexpr std::uint32_t packet_track_descriptor = 60;
+
+            inline constexpr std::uint32_t track_uuid = 1;
+            inline constexpr std::uint32_t track_name = 2;
+            inline constexpr std::uint32_t track_process = 3;
+            inline constexpr std::uint32_t track_thread = 4;
+            inline constexpr std::uint32_t track_parent_uuid = 5;
+
+            inline constexpr std::uint32_t process_pid = 1;
+            inline constexpr std::uint32_t process_name = 6;
+
+            inline constexpr std::uint32_t thread_pid = 1;
+            inline constexpr std::uint32_t thread_tid = 2;
+            inline constexpr std::uint32_t thread_name = 5;
+
+            inline constexpr std::uint32_t track_event_type = 9;
+            inline constexpr std::uint32_t track_event_track_uuid = 11;
+            inline constexpr std::uint32_t track_event_categories = 22;
+            inline constexpr std::uint32_t track_event_name = 23;
+
+            // TrackEvent::Type
+            inline constexpr std::uint64_t type_slice_begin = 1;
+            inline constexpr std::uint64_t type_slice_end = 2;
+            inline constexpr std::uint64_t type_instant = 3;
+
+            inline constexpr std::uint32_t sequence_id = 1;
+        }    // namespace perfetto
+
+        void write_packet(std::ostream& os, proto_message const& packet)
+        {
+            proto_message trace;
+            trace.add_message(perfetto::trace_packet, packet);
+            os.write(trace.data().data(),
+                static_cast<std::streamsize>(trace.data().size()));
+        }
+
+        void write_perfetto(std::ostream& os,
+            std::vector<thread_events> const& threads,
+            time_converter const& to_ns, std::uint32_t pid)
+        {
+            // the tracks of all threads are children of the process track
+            std::uint64_t const process_uuid =
+                (static_cast<std::uint64_t>(pid) + 1) << 32;
+            {
+                proto_message process;
+                process.add_varint(perfetto::process_pid, pid);
+                process.add_string(perfetto::process_name,
+                    hpx::util::format("locality#{}", pid));
+
+                proto_message track;
+                track.add_varint(perfetto::track_uuid, process_uuid);
+                track.add_message(perfetto::track_process, process);
+
+                proto_message packet;
+                packet.add_message(perfetto::packet_track_descriptor, track);
+                write_packet(os, packet);
+            }
+
+            for (thread_events const& te : threads)
+            {
+                std::uint64_t const thread_uuid = process_uuid + te.tid;
+                {
+                    std::string const name = get_thread_name(te);
+
+                    proto_message thread;
+                    thread.add_varint(perfetto::thread_pid, pid);
+                    thread.add_varint(perfetto::thread_tid, te.tid);
+                    thread.add_string(perfetto::thread_name, name);
+
+                    proto_message track;
+                    track.add_varint(perfetto::track_uuid, thread_uuid);
+                    track.add_varint(perfetto::track_parent_uuid, process_uuid);
+                    track.add_string(perfetto::track_name, name);
+                    track.add_message(perfetto::track_thread, thread);
+
+                    proto_message packet;
+                    packet.add_message(
+                        perfetto::packet_track_descriptor, track);
+                    write_packet(os, packet);
+                }
+
+                bool running = false;
+                for (event const& e : te.events)
+                {
+                    proto_message track_event;
+                    track_event.add_varint(
+                        perfetto::track_event_track_uuid, thread_uuid);
+
+                    switch (e.type)
+                    {
+                    case event_type::thread_run:
+                        running = true;
+                        track_event.add_varint(perfetto::track_event_type,
+                            perfetto::type_slice_begin);
+                        break;
+
+                    case event_type::thread_suspend:
+                        [[fallthrough]];
+                    case event_type::thread_terminate:
+                        if (!running)
+                        {
+                            continue;
+                        }
+                        running = false;
+                        track_event.add_varint(perfetto::track_event_type,
+                            perfetto::type_slice_end);
+                        break;
+
+                    default:
+                        track_event.add_varint(perfetto::track_event_type,
+                            perfetto::type_instant);
+                        break;
+                    }
+
+                    track_event.add_string(
+                        perfetto::track_event_categories, get_category(e.type));
+                    track_event.add_string(
+                        perfetto::track_event_name, get_event_name(e));
+
+                    proto_message packet;
+                    packet.add_varint(perfetto::packet_timestamp,
+                        static_cast<std::uint64_t>(to_ns(e.timestamp)));
+                    packet.add_varint(
+                        perfetto::packet_sequence_id, perfetto::sequence_id);
+                    packet.add_message(
+                        perfetto::packet_track_event, track_event);
+                    write_packet(os, packet);
+                }
+            }
+        }
+
+        trace_format get_format(std::string const& destination) noexcept
+        {
+            auto const ends_with = [&](std::string const& suffix) {
+                return destination.size() >= suffix.size() &&
+                    destination.compare(destination.size() - suffix.size(),
+                        suffix.size(), suffix) == 0;
+            };
+
+            if (ends_with(".pftrace") || ends_with(".perfetto-trace"))
+            {
+                return trace_format::perfetto;
+            }
+            return trace_format::chrome_json;
+        }
+
+        void write_requested_dump(tracer_data& data) noexcept
+        {
+            try
+            {
+                dump();
+            }
+            catch (std::exception const& e)
+            {
+                LERR_(error).format(
+                    "tracing::handle_dump_request: failed to write trace: {}",
+                    e.what());
+            }
+            catch (...)
+            {
+                LERR_(error).format("tracing::handle_dump_request: failed to "
+                                    "write trace");
+            }
+            data.dump_running_.store(false, std::memory_order_release);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void record(event_type type, void const* id, char const* name,
+            std::uint32_t arg) noexcept
+        {
+            event_buffer* buffer = local_buffer;
+            if (HPX_UNLIKELY(buffer == nullptr))
+            {
+                buffer = register_buffer();
+                if (buffer == nullptr)
+                {
+                    return;
+                }
+            }
+
+            std::uint64_t const head =
+                buffer->head_.load(std::memory_order_relaxed);
+
+            // orders the store of the previous head before overwriting the
+            // slot, see take_snapshot()
+            std::atomic_thread_fence(std::memory_order_release);
+
+            buffer->events_[head & buffer->mask_].store(
+                event{util::hardware::timestamp(), id, name, arg, type});
+
+            buffer->head_.store(head + 1, std::memory_order_release);
+        }
+
+        void handle_dump_request() noexcept
+        {
+            tracer_data& data = get_tracer_data();
+
+            // a request arriving while a dump is being written stays pending
+            if (data.dump_running_.exchange(true, std::memory_order_acquire))
+            {
+                return;
+            }
+
+            if (!dump_requested.exchange(false, std::memory_order_relaxed))
+            {
+                data.dump_running_.store(false, std::memory_order_release);
+                return;
+            }
+
+            try
+            {
+                // the previous dump thread has finished writing already
+                if (data.dump_thread_.joinable())
+                {
+                    data.dump_thread_.join();
+                }
+                data.dump_thread_ =
+                    std::thread([&data] { write_requested_dump(data); });
+            }
+            catch (std::system_error const& e)
+            {
+                LERR_(error).format("tracing::handle_dump_request: failed to "
+                                    "start writing trace: {}",
+                    e.what());
+                data.dump_running_.store(false, std::memory_order_release);
+            }
+        }
+    }    // namespace detail
+
+    void enable(bool enable)
+    {
+        if (enable)
+        {
+            tracer_data& data = get_tracer_data();
+
+            std::lock_guard<std::mutex> l(data.mtx_);
+            if (data.start_timestamp_ == 0)
+            {
+                data.start_timestamp_ = util::hardware::timestamp();
+                data.start_time_ = hpx::chrono::high_resolution_clock::now();
+            }
+        }
+        detail::tracing_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    void set_buffer_size(std::size_t num_events)
+    {
+        tracer_data& data = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        data.buffer_size_ =
+            next_power_of_two((std::max)(num_events, std::size_t(2)));
+    }
+
+    void set_destination(std::string destination)
+    {
+        tracer_data& data = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        data.destination_ = HPX_MOVE(destination);
+    }
+
+    std::string get_destination()
+    {
+        tracer_data& data = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        return data.destination_;
+    }
+
+    void write_trace(std::ostream& os, trace_format format)
+    {
+        tracer_data& data = get_tracer_data();
+
+        std::vector<thread_events> const threads = take_snapshot(data);
+        time_converter const to_ns(data);
+        std::uint32_t const pid = get_process_id();
+
+        if (format == trace_format::perfetto)
+        {
+            write_perfetto(os, threads, to_ns, pid);
+        }
+        else
+        {
+            write_chrome_json(os, threads, to_ns, pid);
+        }
+    }
+
+    void dump()
+    {
+        std::string destination = get_destination();
+        if (destination.empty())
+        {
+            return;
+        }
+
+        // allow for separate files to be written by each locality
+        std::string const placeholder = "{locality}";
+        if (auto const pos = destination.find(placeholder);
+            pos != std::string::npos)
+        {
+            destination.replace(
+                pos, placeholder.size(), std::to_string(get_process_id()));
+        }
+
+        tracer_data& data = get_tracer_data();
+        std::lock_guard<std::mutex> l(data.dump_mtx_);
+
+        std::ofstream os(destination,
+            std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        if (!os)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::tracing::dump",
+                "could not open trace destination: {}", destination);
+        }
+
+        write_trace(os, get_format(destination));
+    }
+
+    void clear()
+    {
+        tracer_data& data = get_tracer_data();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        for (auto const& buffer : data.buffers_)
+        {
+            // the head is owned by the recording thread
+            buffer->tail_.store(buffer->head_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+        }
+    }
+}    // namespace hpx::threads::tracing
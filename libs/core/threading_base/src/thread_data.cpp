@@ -14,6 +14,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
@@ -71,6 +72,7 @@ namespace hpx::threads {
       , backtrace_(nullptr)
 #endif
       , priority_(init_data.priority)
+      , deadline_(init_data.deadline)
       , requested_interrupt_(false)
       , enabled_interrupt_(true)
       , ran_exit_funcs_(false)
@@ -85,6 +87,11 @@ namespace hpx::threads {
     {
         LTM_(debug).format(
             "thread::thread({}), description({})", this, get_description());
+        if (tracing::enabled())
+        {
+            tracing::detail::record(tracing::event_type::thread_create, this,
+                tracing::get_name(get_description()), 0);
+        }
 
         HPX_ASSERT(stacksize_enum_ != threads::thread_stacksize::current);
 
@@ -220,6 +227,7 @@ namespace hpx::threads {
         backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
+        deadline_ = init_data.deadline;
         requested_interrupt_ = false;
         enabled_interrupt_ = true;
         ran_exit_funcs_ = false;
@@ -241,6 +249,11 @@ namespace hpx::threads {
 
         LTM_(debug).format("thread::thread({}), description({}), rebind", this,
             get_description());
+        if (tracing::enabled())
+        {
+            tracing::detail::record(tracing::event_type::thread_create, this,
+                tracing::get_name(get_description()), 0);
+        }
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
         // store the thread id of the parent thread, mainly for debugging
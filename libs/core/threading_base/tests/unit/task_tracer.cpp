@@ -0,0 +1,159 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tracing = hpx::threads::tracing;
+
+///////////////////////////////////////////////////////////////////////////////
+std::string write_trace(tracing::trace_format format)
+{
+    std::ostringstream os;
+    tracing::write_trace(os, format);
+    return os.str();
+}
+
+void test_chrome_json()
+{
+    tracing::clear();
+    tracing::enable(true);
+
+    std::vector<hpx::future<void>> tasks;
+    for (int i = 0; i != 10; ++i)
+    {
+        tasks.push_back(hpx::async(
+            hpx::annotated_function([] {}, "traced_task")));
+    }
+    hpx::wait_all(tasks);
+
+    tracing::enable(false);
+
+    std::string const trace = write_trace(tracing::trace_format::chrome_json);
+
+    HPX_TEST_EQ(trace.find("{\"displayTimeUnit\":\"ns\""), std::size_t(0));
+    HPX_TEST_NEQ(trace.find("\"thread_name\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"ph\":\"B\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"ph\":\"E\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"cat\":\"thread_create\""), std::string::npos);
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(trace.find("\"name\":\"traced_task\""), std::string::npos);
+#endif
+}
+
+void test_perfetto()
+{
+    tracing::clear();
+    tracing::enable(true);
+
+    hpx::async([] {}).get();
+
+    tracing::enable(false);
+
+    std::string const trace = write_trace(tracing::trace_format::perfetto);
+
+    // each packet is stored as a length delimited field with number 1
+    HPX_TEST(!trace.empty());
+    HPX_TEST_EQ(trace[0], '\x0a');
+}
+
+void test_disabled()
+{
+    tracing::clear();
+
+    hpx::async([] {}).get();
+
+    std::string const trace = write_trace(tracing::trace_format::chrome_json);
+    HPX_TEST_EQ(trace.find("\"ph\":\"B\""), std::string::npos);
+}
+
+void test_record()
+{
+    tracing::clear();
+    tracing::enable(true);
+
+    int dummy = 0;
+    tracing::record(tracing::event_type::parcel_send, &dummy,
+        "with \"quotes\"\n", 42);
+
+    tracing::enable(false);
+
+    std::string const trace = write_trace(tracing::trace_format::chrome_json);
+    HPX_TEST_NEQ(trace.find("\"name\":\"with \\\"quotes\\\"\\u000a\""),
+        std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"destination\":42"), std::string::npos);
+}
+
+// the trace is written on a separate OS thread, the requesting thread does
+// not wait for it
+void test_dump_request()
+{
+    std::string const destination = "task_tracer_dump_request.json";
+    std::remove(destination.c_str());
+
+    tracing::clear();
+    tracing::enable(true);
+    hpx::async(hpx::annotated_function([] {}, "dumped_task")).get();
+    tracing::enable(false);
+
+    tracing::set_destination(destination);
+    tracing::request_dump();
+    tracing::handle_dump_request();
+
+    std::string trace;
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        std::ifstream is(destination);
+        trace.assign(std::istreambuf_iterator<char>(is),
+            std::istreambuf_iterator<char>());
+        std::string const end = "\n]}\n";
+        if (trace.size() >= end.size() &&
+            trace.compare(trace.size() - end.size(), end.size(), end) == 0)
+        {
+            break;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    tracing::set_destination("");
+
+    HPX_TEST_EQ(trace.find("{\"displayTimeUnit\":\"ns\""), std::size_t(0));
+    HPX_TEST_NEQ(trace.find("\"ph\":\"B\""), std::string::npos);
+
+    std::remove(destination.c_str());
+}
+
+int hpx_main()
+{
+    test_chrome_json();
+    test_perfetto();
+    test_disabled();
+    test_record();
+    test_dump_request();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -299,6 +299,13 @@ namespace hpx::threads {
         bool set_area_membind_nodeset(
             void const* addr, std::size_t len, void* nodeset) const;
 
+        /// bind the given memory area to the numa node set as specified by
+        /// the policy and flags (see hwloc docs), returns false if the binding
+        /// could not be applied
+        bool set_area_membind(void const* addr, std::size_t len,
+            hwloc_bitmap_ptr const& nodeset, hpx_hwloc_membind_policy policy,
+            int flags) const noexcept;
+
         int get_numa_domain(void const* addr) const;
 
         /// Free memory that was previously allocated by allocate
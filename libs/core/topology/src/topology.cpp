@@ -1366,6 +1366,30 @@ namespace hpx::threads {
         return true;
     }
 
+    bool topology::set_area_membind([[maybe_unused]] void const* addr,
+        [[maybe_unused]] std::size_t len,
+        [[maybe_unused]] hwloc_bitmap_ptr const& nodeset,
+        [[maybe_unused]] hpx_hwloc_membind_policy policy,
+        [[maybe_unused]] int flags) const noexcept
+    {
+#if !defined(__APPLE__)
+        if (!nodeset || !*nodeset)
+            return false;
+
+#if HWLOC_API_VERSION >= 0x00010b06
+        return hwloc_set_area_membind(topo, addr, len, nodeset->get_bmp(),
+                   static_cast<hwloc_membind_policy_t>(policy),
+                   flags | HWLOC_MEMBIND_BYNODESET) == 0;
+#else
+        return hwloc_set_area_membind_nodeset(topo, addr, len,
+                   nodeset->get_bmp(),
+                   static_cast<hwloc_membind_policy_t>(policy), flags) == 0;
+#endif
+#else
+        return false;
+#endif
+    }
+
     static hpx_hwloc_bitmap_wrapper& bitmap_storage()
     {
         static thread_local hpx_hwloc_bitmap_wrapper bitmap_storage_(nullptr);
@@ -19,6 +19,7 @@
 #include <hpx/actions_base/detail/per_action_data_counter_registry.hpp>
 #include <hpx/actions_base/preassigned_action_id.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
+#include <hpx/actions_base/traits/action_is_stealable.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_remote_result.hpp>
 #include <hpx/actions_base/traits/action_stacksize.hpp>
@@ -669,6 +670,20 @@ namespace hpx::actions {
 /**/
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+#define HPX_ACTION_IS_STEALABLE(action) /**/
+#else
+#define HPX_ACTION_IS_STEALABLE(action)                                        \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct action_is_stealable<action> : std::true_type                    \
+        {                                                                      \
+        };                                                                     \
+    }                                                                          \
+    /**/
+#endif
+
 /// \endcond
 
 /// \def HPX_REGISTER_ACTION_DECLARATION(action)
@@ -46,6 +46,7 @@ namespace hpx::actions {
         hpx_lcos_server_barrier_create_component_action_id,
         hpx_lcos_server_latch_create_component_action_id,
         hpx_lcos_server_latch_wait_action_id,
+        invalidate_agas_cache_action_id,
         list_component_type_action_id,
         list_symbolic_name_action_id,
         load128_action_id,
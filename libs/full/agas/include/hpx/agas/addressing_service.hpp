@@ -11,6 +11,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/agas/detail/gva_range_table.hpp>
+#include <hpx/agas/detail/refcnt_buffers.hpp>
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
@@ -74,6 +76,9 @@ namespace hpx { namespace agas {
         mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
 
+        // non-evictable gva ranges (filled by prefetch_gva_ranges)
+        mutable detail::gva_range_table gva_range_table_;
+
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
 
@@ -83,10 +88,25 @@ namespace hpx { namespace agas {
         std::size_t const max_refcnt_requests_;
 
         mutex_type refcnt_requests_mtx_;
-        std::size_t refcnt_requests_count_;
-        bool enable_refcnt_caching_;
+        std::atomic<bool> enable_refcnt_caching_;
+        std::atomic<bool> refcnt_flush_scheduled_;
+
+        // Decrements are accumulated per worker thread and are merged into
+        // refcnt_requests_ (while holding refcnt_requests_mtx_) before being
+        // sent. A flush is scheduled once a buffer holds more than its share
+        // of max_refcnt_requests_.
+        detail::refcnt_buffers refcnt_buffers_;
+        std::size_t const max_buffered_refcnt_requests_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+        std::uint64_t refcnt_requests_oldest_;
+
+        // decref statistics, refcnt_decrefs_ counts the decrements which
+        // were not buffered (the buffers count their own)
+        std::atomic<std::uint64_t> refcnt_decrefs_;
+        std::atomic<std::uint64_t> refcnt_batches_;
+        std::atomic<std::uint64_t> refcnt_batch_requests_;
+        std::atomic<std::uint64_t> refcnt_batch_latency_;
 
         service_mode const service_type;
         runtime_mode const runtime_type;
@@ -235,6 +255,20 @@ namespace hpx { namespace agas {
         void send_refcnt_requests(
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
 
+        /// Assumes that \a refcnt_requests_mtx_ is locked. Moves the
+        /// requests held by the per worker thread buffers into
+        /// \a refcnt_requests_ and returns all pending requests (or nullptr)
+        /// and the time stamp of the oldest of those.
+        std::shared_ptr<refcnt_requests_type> extract_refcnt_requests(
+            std::unique_lock<mutex_type>& l, std::uint64_t& oldest);
+
+        /// Collects the statistics for a set of requests sent to AGAS.
+        void record_refcnt_batches(std::size_t batches, std::size_t requests,
+            std::uint64_t oldest) noexcept;
+
+        /// Sends all buffered decrements from a new HPX thread.
+        void schedule_refcnt_flush(error_code& ec = throws);
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
             std::unique_lock<mutex_type>& l, error_code& ec);
@@ -265,6 +299,18 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+        // Helper functions to access the statistics of the range table
+        std::uint64_t get_range_table_entries(bool) const;
+        std::uint64_t get_range_table_hits(bool) const;
+        std::uint64_t get_range_table_misses(bool) const;
+        std::uint64_t get_range_table_invalidations(bool) const;
+
+        // Helper functions to access the statistics of the decref batching
+        std::uint64_t get_decref_requests(bool reset);
+        std::uint64_t get_decref_batches(bool reset);
+        std::uint64_t get_decref_batch_requests(bool reset);
+        std::uint64_t get_decref_batch_latency(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
@@ -1216,6 +1262,16 @@ namespace hpx { namespace agas {
 
         // Pre-cache locality endpoints in hosted locality namespace
         void pre_cache_endpoints(std::vector<parcelset::endpoints_type> const&);
+
+        /// \brief Resolve the given global ids and store the gva ranges they
+        ///        belong to in the (non-evictable) range table.
+        ///
+        /// Ids managed by this locality and ids whose range is already known
+        /// are skipped. Subsequent address resolutions for any id in the
+        /// prefetched ranges are satisfied locally until the range is
+        /// invalidated (e.g. by migrating one of its objects).
+        hpx::future<void> prefetch_gva_ranges(
+            std::vector<naming::gid_type> const& gids);
     };
 
 }}    // namespace hpx::agas
@@ -0,0 +1,169 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A sharded hash index of (non-evictable) GVA ranges.
+    //
+    // The global id space is split into fixed-size granules. Each range is
+    // stored in the buckets of all granules it overlaps, the buckets are
+    // distributed over a set of independently locked shards. A lookup hashes
+    // the granule of the requested id, takes a shared lock on a single shard
+    // and scans the (usually single element) bucket for the range containing
+    // the id. Both the per-shard hash maps and the number of ranges grow
+    // dynamically.
+    //
+    // Unlike the LRU gva cache, lookups do not modify the table and can
+    // proceed concurrently. Entries are only removed by explicit invalidation.
+    class HPX_EXPORT gva_range_table
+    {
+    public:
+        // each granule covers 2^16 consecutive global ids
+        static constexpr std::size_t granule_bits = 16;
+
+        // ranges spanning more granules than this are not stored
+        static constexpr std::uint64_t max_granules_per_range = 64;
+
+        // num_shards is rounded up to the next power of two
+        explicit gva_range_table(std::size_t num_shards = 64);
+
+        gva_range_table(gva_range_table const&) = delete;
+        gva_range_table(gva_range_table&&) = delete;
+        gva_range_table& operator=(gva_range_table const&) = delete;
+        gva_range_table& operator=(gva_range_table&&) = delete;
+
+        ~gva_range_table();
+
+        // Insert the range [lower, lower + g.count). Returns false if the
+        // range (or an overlapping one) is already known or if the range can't
+        // be stored in the table.
+        bool insert(naming::gid_type const& lower, gva const& g)
+        {
+            return insert(lower, g, generation());
+        }
+
+        // Insert the range only if the table was not invalidated (see
+        // generation()) since the given generation was observed. This is
+        // used to drop resolved ranges that arrive after an invalidation
+        // which might have concerned them.
+        bool insert(naming::gid_type const& lower, gva const& g,
+            std::uint64_t generation);
+
+        // Return the current invalidation generation of the table. It is
+        // incremented by each call to erase() or clear().
+        [[nodiscard]] std::uint64_t generation() const noexcept
+        {
+            return generation_.load(std::memory_order_acquire);
+        }
+
+        // Look up the range containing the given (stripped) id.
+        bool find(naming::gid_type const& id, gva& g,
+            naming::gid_type& idbase) const;
+
+        // Check whether the range containing the given id is known.
+        bool contains(naming::gid_type const& id) const;
+
+        // Remove the range containing the given id, returns whether a range
+        // was removed.
+        bool erase(naming::gid_type const& id);
+
+        void clear();
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return num_ranges_.load(std::memory_order_relaxed);
+        }
+
+        // statistics
+        std::uint64_t hits(bool reset) noexcept;
+        std::uint64_t misses(bool reset) noexcept;
+        std::uint64_t insertions(bool reset) noexcept;
+        std::uint64_t invalidations(bool reset) noexcept;
+
+    private:
+        struct entry
+        {
+            naming::gid_type lower;
+            naming::gid_type upper;    // inclusive
+            gva g;
+        };
+
+        struct granule_key
+        {
+            std::uint64_t msb;
+            std::uint64_t block;
+
+            friend bool operator==(
+                granule_key const& lhs, granule_key const& rhs) noexcept
+            {
+                return lhs.msb == rhs.msb && lhs.block == rhs.block;
+            }
+        };
+
+        struct granule_hash
+        {
+            std::size_t operator()(granule_key const& k) const noexcept
+            {
+                // mix the bits of both halves (boost::hash_combine)
+                std::size_t seed = static_cast<std::size_t>(k.msb);
+                seed ^= static_cast<std::size_t>(k.block) + 0x9e3779b9 +
+                    (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
+        using bucket_type = hpx::detail::small_vector<entry, 1>;
+        using index_type =
+            std::unordered_map<granule_key, bucket_type, granule_hash>;
+
+        struct shard
+        {
+            mutable hpx::shared_mutex mtx_;
+            index_type index_;
+        };
+
+        static granule_key make_key(naming::gid_type const& id) noexcept;
+
+        shard& get_shard(granule_key const& k) const noexcept;
+
+        // returns the entry containing id in the given bucket, if any
+        static entry const* find_entry(
+            bucket_type const& bucket, naming::gid_type const& id) noexcept;
+
+        std::size_t mask_;
+        std::unique_ptr<hpx::util::cache_aligned_data<shard>[]> shards_;
+
+        std::atomic<std::size_t> num_ranges_;
+        std::atomic<std::uint64_t> generation_;
+
+        mutable hpx::util::cache_aligned_data<std::atomic<std::uint64_t>>
+            hits_;
+        mutable hpx::util::cache_aligned_data<std::atomic<std::uint64_t>>
+            misses_;
+        std::atomic<std::uint64_t> insertions_;
+        std::atomic<std::uint64_t> invalidations_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,102 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Per worker thread buffers for pending credit decrements.
+    //
+    // Each worker thread accumulates its decrements in its own buffer, so
+    // that dropping id_types concurrently on many worker threads does not
+    // contend on a single lock. The lock of a buffer is taken by other
+    // threads only while the buffers are merged for sending the requests to
+    // AGAS and while an incref looks for pending decrements to compensate.
+    //
+    // A small table of counters, indexed by the hash of the ids, tracks how
+    // many buffers hold an entry for any of the ids mapping to a slot. An
+    // incref looks into the buffers only if the slot of its id is non-zero.
+    //
+    // All stored credits are negative (decrements).
+    class HPX_EXPORT refcnt_buffers
+    {
+    public:
+        using requests_type = std::map<naming::gid_type, std::int64_t>;
+
+        explicit refcnt_buffers(std::size_t num_buffers);
+
+        refcnt_buffers(refcnt_buffers const&) = delete;
+        refcnt_buffers(refcnt_buffers&&) = delete;
+        refcnt_buffers& operator=(refcnt_buffers const&) = delete;
+        refcnt_buffers& operator=(refcnt_buffers&&) = delete;
+
+        ~refcnt_buffers();
+
+        // Add a decrement of the given (positive) credit for the given
+        // (stripped) id to the buffer of the calling worker thread. Returns
+        // the number of requests pending in that buffer.
+        std::size_t add(naming::gid_type const& id, std::int64_t credit);
+
+        // Remove all pending decrements for the given id, returns their
+        // (negative) sum or zero. Decrements added concurrently may be
+        // missed, those will be sent with the next batch.
+        std::int64_t extract(naming::gid_type const& id);
+
+        // Move all pending decrements into the given map. Returns the time
+        // stamp (see hpx::chrono::high_resolution_clock) of the oldest merged
+        // request or zero if there was none.
+        std::uint64_t merge_into(requests_type& requests);
+
+        // The number of requests added since the last merge (approximate).
+        [[nodiscard]] std::size_t pending() const noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return num_buffers_;
+        }
+
+        // The overall number of decrements added.
+        std::uint64_t decrefs(bool reset) noexcept;
+
+    private:
+        static constexpr std::size_t num_filter_slots = 1024;
+
+        struct buffer
+        {
+            hpx::spinlock mtx_;
+            std::unordered_map<naming::gid_type, std::int64_t> requests_;
+            std::uint64_t oldest_ = 0;
+            std::atomic<std::size_t> count_{0};
+            std::atomic<std::uint64_t> decrefs_{0};
+        };
+
+        buffer& local_buffer() const noexcept;
+
+        std::atomic<std::uint32_t>& filter_slot(
+            naming::gid_type const& id) const noexcept;
+
+        std::size_t num_buffers_;
+        std::unique_ptr<hpx::util::cache_aligned_data<buffer>[]> buffers_;
+        std::unique_ptr<std::atomic<std::uint32_t>[]> filter_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -16,6 +16,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -34,10 +35,14 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -120,9 +125,18 @@ namespace hpx::agas {
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
-      , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
+      , refcnt_flush_scheduled_(false)
+      , refcnt_buffers_(ini_.get_os_thread_count())
+      , max_buffered_refcnt_requests_((std::max)(std::size_t(1),
+            (max_refcnt_requests_ + refcnt_buffers_.size() - 1) /
+                refcnt_buffers_.size()))
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_requests_oldest_(0)
+      , refcnt_decrefs_(0)
+      , refcnt_batches_(0)
+      , refcnt_batch_requests_(0)
+      , refcnt_batch_latency_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -154,7 +168,11 @@ namespace hpx::agas {
     namespace detail {
 
         std::uint32_t get_number_of_pus_in_cores(std::uint32_t num_cores);
-    }
+
+#if defined(HPX_HAVE_NETWORKING)
+        void broadcast_cache_invalidation(naming::gid_type const& gid);
+#endif
+    }    // namespace detail
 
     void addressing_service::launch_bootstrap(
         parcelset::endpoints_type const& endpoints,
@@ -269,6 +287,72 @@ namespace hpx::agas {
         }
     }
 
+    hpx::future<void> addressing_service::prefetch_gva_ranges(
+        std::vector<naming::gid_type> const& gids)
+    {
+        // the range table is consulted only if caching is enabled
+        if (!caching_)
+        {
+            return hpx::make_ready_future();
+        }
+
+        std::vector<hpx::future<void>> requests;
+        requests.reserve(gids.size());
+
+        std::uint32_t const here =
+            naming::get_locality_id_from_gid(locality_);
+
+        for (naming::gid_type const& id : gids)
+        {
+            naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+            // only remote, cacheable ids are stored in the range table
+            if (!gid || naming::get_locality_id_from_gid(gid) == here ||
+                !naming::detail::store_in_cache(id) ||
+                naming::is_locality(gid) || gva_range_table_.contains(gid))
+            {
+                continue;
+            }
+
+            // a reply arriving after the range was invalidated (e.g. because
+            // the object was migrated) may be stale and is dropped
+            std::uint64_t const generation = gva_range_table_.generation();
+
+            auto result = primary_ns_.resolve_full(gid);
+            if (result.has_value())
+            {
+                auto const& rep = result.get_value();
+                gva_range_table_.insert(
+                    hpx::get<0>(rep), hpx::get<1>(rep), generation);
+                continue;
+            }
+
+            requests.push_back(result.get_future().then(hpx::launch::sync,
+                [this, generation](
+                    hpx::future<primary_namespace::resolved_type>&& f) {
+                    auto const rep = f.get();
+                    if (hpx::get<0>(rep) != naming::invalid_gid)
+                    {
+                        gva_range_table_.insert(
+                            hpx::get<0>(rep), hpx::get<1>(rep), generation);
+                    }
+                }));
+        }
+
+        if (requests.empty())
+        {
+            return hpx::make_ready_future();
+        }
+        return hpx::when_all(HPX_MOVE(requests))
+            .then(hpx::launch::sync, [](auto&& f) {
+                // propagate exceptions
+                for (auto&& request : f.get())
+                {
+                    request.get();
+                }
+            });
+    }
+
     parcelset::endpoints_type const& addressing_service::resolve_locality(
         naming::gid_type const& gid, error_code& ec)
     {
@@ -1049,8 +1133,23 @@ namespace hpx::agas {
             }
         }
 
-        // first look up the requested item in the cache
+        // look up the requested item in the prefetched ranges first, this
+        // doesn't need to acquire the lock protecting the LRU cache
         gva g;
+        if (naming::gid_type idbase; gva_range_table_.size() != 0 &&
+            !hpx::is_starting() && gva_range_table_.find(id, g, idbase))
+        {
+            addr.locality_ = g.prefix;
+            addr.type_ = g.type;
+            addr.address_ = g.lva(id, idbase);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return true;
+        }
+
+        // then look up the requested item in the cache
         if (naming::gid_type idbase; get_cache_entry(id, g, idbase, ec))
         {
             addr.locality_ = g.prefix;
@@ -1392,9 +1491,18 @@ namespace hpx::agas {
         bool has_pending_incref = false;
         std::int64_t pending_decrefs = 0;
 
+        // collect the decrements for this id that are still held in the per
+        // worker thread buffers
+        std::int64_t const buffered_decrefs = refcnt_buffers_.extract(raw);
+
         {
             std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
 
+            if (buffered_decrefs != 0)
+            {
+                (*refcnt_requests_)[raw] += buffered_decrefs;
+            }
+
             if (auto const matches = refcnt_requests_->find(raw);
                 matches != refcnt_requests_->end())
             {
@@ -1490,8 +1598,33 @@ namespace hpx::agas {
 
         try
         {
+            // Decrements are buffered per worker thread, this avoids
+            // contention on refcnt_requests_mtx_ if many id_types are
+            // released concurrently.
+            if (enable_refcnt_caching_.load(std::memory_order_relaxed))
+            {
+                std::size_t const pending = refcnt_buffers_.add(raw, credit);
+
+                // caching might have been disabled concurrently (during
+                // shutdown), make sure the decrement is not left behind
+                if (pending >= max_buffered_refcnt_requests_ ||
+                    !enable_refcnt_caching_.load(std::memory_order_acquire))
+                {
+                    schedule_refcnt_flush();
+                }
+                return;
+            }
+
             std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
 
+            refcnt_decrefs_.fetch_add(1, std::memory_order_relaxed);
+
+            if (refcnt_requests_oldest_ == 0)
+            {
+                refcnt_requests_oldest_ =
+                    hpx::chrono::high_resolution_clock::now();
+            }
+
             // Match the decref request with entries in the incref table
             if (auto const matches = refcnt_requests_->find(raw);
                 matches != refcnt_requests_->end())
@@ -1846,6 +1979,8 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
+            gva_range_table_.clear();
+
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->clear();
@@ -1895,6 +2030,8 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
+            gva_range_table_.erase(gid);
+
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
@@ -1918,7 +2055,7 @@ namespace hpx::agas {
             return;
 
         std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-        enable_refcnt_caching_ = false;
+        enable_refcnt_caching_.store(false, std::memory_order_release);
         send_refcnt_requests_sync(l, ec);
     }
 
@@ -2010,6 +2147,50 @@ namespace hpx::agas {
         return gva_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t addressing_service::get_range_table_entries(
+        bool /* reset */) const
+    {
+        return gva_range_table_.size();
+    }
+
+    std::uint64_t addressing_service::get_range_table_hits(bool reset) const
+    {
+        return gva_range_table_.hits(reset);
+    }
+
+    std::uint64_t addressing_service::get_range_table_misses(bool reset) const
+    {
+        return gva_range_table_.misses(reset);
+    }
+
+    std::uint64_t addressing_service::get_range_table_invalidations(
+        bool reset) const
+    {
+        return gva_range_table_.invalidations(reset);
+    }
+
+    std::uint64_t addressing_service::get_decref_requests(bool reset)
+    {
+        return refcnt_buffers_.decrefs(reset) +
+            util::get_and_reset_value(refcnt_decrefs_, reset);
+    }
+
+    std::uint64_t addressing_service::get_decref_batches(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_batches_, reset);
+    }
+
+    std::uint64_t addressing_service::get_decref_batch_requests(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_batch_requests_, reset);
+    }
+
+    std::uint64_t addressing_service::get_decref_batch_latency(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_batch_latency_, reset);
+    }
+
     void addressing_service::register_server_instances()
     {
         // register root server
@@ -2050,14 +2231,91 @@ namespace hpx::agas {
             return;
         }
 
-        if (!enable_refcnt_caching_ ||
-            max_refcnt_requests_ == ++refcnt_requests_count_)
+        if (!enable_refcnt_caching_.load(std::memory_order_relaxed) ||
+            max_refcnt_requests_ <= refcnt_requests_->size())
             send_refcnt_requests_non_blocking(l, ec);
 
         else if (&ec != &throws)
             ec = make_success_code();
     }
 
+    std::shared_ptr<addressing_service::refcnt_requests_type>
+    addressing_service::extract_refcnt_requests(
+        [[maybe_unused]] std::unique_lock<addressing_service::mutex_type>& l,
+        std::uint64_t& oldest)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        oldest = refcnt_requests_oldest_;
+        if (std::uint64_t const buffered =
+                refcnt_buffers_.merge_into(*refcnt_requests_);
+            buffered != 0 && (oldest == 0 || buffered < oldest))
+        {
+            oldest = buffered;
+        }
+
+        if (refcnt_requests_->empty())
+        {
+            refcnt_requests_oldest_ = 0;
+            return nullptr;
+        }
+
+        auto p = std::make_shared<refcnt_requests_type>();
+        p.swap(refcnt_requests_);
+        refcnt_requests_oldest_ = 0;
+
+        return p;
+    }
+
+    void addressing_service::record_refcnt_batches(std::size_t batches,
+        std::size_t requests, std::uint64_t oldest) noexcept
+    {
+        refcnt_batches_.fetch_add(batches, std::memory_order_relaxed);
+        refcnt_batch_requests_.fetch_add(requests, std::memory_order_relaxed);
+
+        if (oldest != 0)
+        {
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+            if (now > oldest)
+            {
+                refcnt_batch_latency_.fetch_add(
+                    now - oldest, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void addressing_service::schedule_refcnt_flush(error_code& ec)
+    {
+        // at most one flush is pending at any point in time
+        if (refcnt_flush_scheduled_.load(std::memory_order_relaxed) ||
+            refcnt_flush_scheduled_.exchange(true, std::memory_order_acquire))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary(
+                [HPX_CXX20_CAPTURE_THIS(=)]() -> void {
+                    refcnt_flush_scheduled_.store(
+                        false, std::memory_order_release);
+
+                    std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+                    send_refcnt_requests_non_blocking(l, throws);
+                }),
+            "addressing_service::schedule_refcnt_flush",
+            threads::thread_priority::normal, threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+        threads::register_thread(data, ec);
+
+        if (ec)
+        {
+            refcnt_flush_scheduled_.store(false, std::memory_order_release);
+        }
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -2100,19 +2358,16 @@ namespace hpx::agas {
 
         try
         {
-            if (refcnt_requests_->empty())
+            std::uint64_t oldest = 0;
+            auto p = extract_refcnt_requests(l, oldest);
+
+            l.unlock();
+
+            if (!p)
             {
-                l.unlock();
                 return;
             }
 
-            auto p = std::make_shared<refcnt_requests_type>();
-
-            p.swap(refcnt_requests_);
-            refcnt_requests_count_ = 0;
-
-            l.unlock();
-
             LAGAS_(info).format("addressing_service::send_refcnt_requests_non_"
                                 "blocking, requests({1})",
                 p->size());
@@ -2143,6 +2398,8 @@ namespace hpx::agas {
             }
 
             // send requests to all locality
+            record_refcnt_batches(requests.size(), p->size(), oldest);
+
             auto const end = requests.end();
             for (auto it = requests.begin(); it != end; ++it)
             {
@@ -2171,19 +2428,16 @@ namespace hpx::agas {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT_OWNS_LOCK(l);
 
-        if (refcnt_requests_->empty())
+        std::uint64_t oldest = 0;
+        auto p = extract_refcnt_requests(l, oldest);
+
+        l.unlock();
+
+        if (!p)
         {
-            l.unlock();
             return std::vector<hpx::future<std::vector<std::int64_t>>>();
         }
 
-        auto p = std::make_shared<refcnt_requests_type>();
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
-
-        l.unlock();
-
         LAGAS_(info).format(
             "addressing_service::send_refcnt_requests_async, requests({1})",
             p->size());
@@ -2214,6 +2468,8 @@ namespace hpx::agas {
         }
 
         // send requests to all locality
+        record_refcnt_batches(requests.size(), p->size(), oldest);
+
         auto const end = requests.end();
         for (auto it = requests.begin(); it != end; ++it)
         {
@@ -2380,7 +2636,18 @@ namespace hpx::agas {
         naming::gid_type const gid(
             naming::detail::get_stripped_gid(id.get_gid()));
 
-        return primary_ns_.end_migration(gid);
+        if (!primary_ns_.end_migration(gid))
+        {
+            return false;
+        }
+
+        // The object now lives on a different locality, drop all (now stale)
+        // cached addresses for it, here and on all other localities.
+        remove_cache_entry(gid);
+#if defined(HPX_HAVE_NETWORKING)
+        detail::broadcast_cache_invalidation(gid);
+#endif
+        return true;
     }
 
     bool addressing_service::was_object_migrated_locked(
@@ -0,0 +1,311 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_range_table.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/datastructures/detail/small_vector.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+namespace hpx::agas::detail {
+
+    namespace {
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }    // namespace
+
+    gva_range_table::gva_range_table(std::size_t num_shards)
+      : mask_(next_power_of_two((std::max)(num_shards, std::size_t(1))) - 1)
+      , shards_(new hpx::util::cache_aligned_data<shard>[mask_ + 1])
+      , num_ranges_(0)
+      , generation_(0)
+      , hits_(0)
+      , misses_(0)
+      , insertions_(0)
+      , invalidations_(0)
+    {
+    }
+
+    gva_range_table::~gva_range_table() = default;
+
+    gva_range_table::granule_key gva_range_table::make_key(
+        naming::gid_type const& id) noexcept
+    {
+        return granule_key{
+            naming::detail::strip_internal_bits_from_gid(id.get_msb()),
+            id.get_lsb() >> granule_bits};
+    }
+
+    gva_range_table::shard& gva_range_table::get_shard(
+        granule_key const& k) const noexcept
+    {
+        return shards_[granule_hash()(k) & mask_].data_;
+    }
+
+    gva_range_table::entry const* gva_range_table::find_entry(
+        bucket_type const& bucket, naming::gid_type const& id) noexcept
+    {
+        for (entry const& e : bucket)
+        {
+            if (e.lower <= id && id <= e.upper)
+            {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+
+    bool gva_range_table::insert(naming::gid_type const& lower, gva const& g,
+        std::uint64_t generation)
+    {
+        // The entry in AGAS for a locality's RTS component has a count of 0
+        std::uint64_t const count = g.count ? g.count : 1;
+
+        naming::gid_type const upper = lower + (count - 1);
+
+        // ranges wrapping around the lsb are not supported
+        if (naming::detail::strip_internal_bits_from_gid(lower.get_msb()) !=
+            naming::detail::strip_internal_bits_from_gid(upper.get_msb()))
+        {
+            return false;
+        }
+
+        std::uint64_t const first = lower.get_lsb() >> granule_bits;
+        std::uint64_t const last = upper.get_lsb() >> granule_bits;
+        if (last - first >= max_granules_per_range)
+        {
+            return false;
+        }
+
+        entry const e{lower, upper, g};
+
+        // All shards holding granules of the range are locked (in a
+        // consistent order) while checking for overlaps and inserting.
+        // Otherwise concurrent insertions of the same range could both pass
+        // the check and store duplicate entries.
+        hpx::detail::small_vector<std::size_t, 4> shards;
+
+        granule_key k = make_key(lower);
+        for (std::uint64_t block = first; block <= last; ++block)
+        {
+            k.block = block;
+            shards.push_back(granule_hash()(k) & mask_);
+        }
+
+        std::sort(shards.begin(), shards.end());
+        shards.erase(
+            std::unique(shards.begin(), shards.end()), shards.end());
+
+        for (std::size_t idx : shards)
+        {
+            shards_[idx].data_.mtx_.lock();
+        }
+
+        [[maybe_unused]] auto on_exit = hpx::experimental::scope_exit([&] {
+            for (std::size_t idx : shards)
+            {
+                shards_[idx].data_.mtx_.unlock();
+            }
+        });
+
+        // An invalidation bumps the generation before it looks at any shard,
+        // so it either sees the inserted range or the insertion sees the new
+        // generation.
+        if (generation_.load(std::memory_order_acquire) != generation)
+        {
+            return false;
+        }
+
+        // the range is first checked for overlaps to avoid partially
+        // inserting a range
+        for (std::uint64_t block = first; block <= last; ++block)
+        {
+            k.block = block;
+            shard const& s = get_shard(k);
+
+            auto const it = s.index_.find(k);
+            if (it != s.index_.end())
+            {
+                for (entry const& existing : it->second)
+                {
+                    if (existing.lower <= upper && lower <= existing.upper)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        for (std::uint64_t block = first; block <= last; ++block)
+        {
+            k.block = block;
+            get_shard(k).index_[k].push_back(e);
+        }
+
+        ++num_ranges_;
+        ++insertions_;
+        return true;
+    }
+
+    bool gva_range_table::find(
+        naming::gid_type const& id, gva& g, naming::gid_type& idbase) const
+    {
+        granule_key const k = make_key(id);
+        shard const& s = get_shard(k);
+
+        {
+            std::shared_lock<hpx::shared_mutex> l(s.mtx_);
+            if (auto const it = s.index_.find(k); it != s.index_.end())
+            {
+                if (entry const* e = find_entry(it->second, id))
+                {
+                    g = e->g;
+                    idbase = e->lower;
+
+                    l.unlock();
+                    hits_.data_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        misses_.data_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool gva_range_table::contains(naming::gid_type const& id) const
+    {
+        granule_key const k = make_key(id);
+        shard const& s = get_shard(k);
+
+        std::shared_lock<hpx::shared_mutex> l(s.mtx_);
+        auto const it = s.index_.find(k);
+        return it != s.index_.end() && find_entry(it->second, id) != nullptr;
+    }
+
+    bool gva_range_table::erase(naming::gid_type const& id)
+    {
+        // invalidate concurrent insertions of ranges resolved earlier, even
+        // if the range is not (yet) known
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+
+        // find the bounds of the range containing the id first
+        naming::gid_type lower, upper;
+        {
+            granule_key const k = make_key(id);
+            shard const& s = get_shard(k);
+
+            std::shared_lock<hpx::shared_mutex> l(s.mtx_);
+            auto const it = s.index_.find(k);
+            if (it == s.index_.end())
+            {
+                return false;
+            }
+
+            entry const* e = find_entry(it->second, id);
+            if (e == nullptr)
+            {
+                return false;
+            }
+
+            lower = e->lower;
+            upper = e->upper;
+        }
+
+        // now remove the range from all granules it overlaps
+        bool removed = false;
+
+        granule_key k = make_key(lower);
+        std::uint64_t const last = upper.get_lsb() >> granule_bits;
+        for (std::uint64_t block = k.block; block <= last; ++block)
+        {
+            k.block = block;
+            shard& s = get_shard(k);
+
+            std::unique_lock<hpx::shared_mutex> l(s.mtx_);
+            auto const it = s.index_.find(k);
+            if (it == s.index_.end())
+            {
+                continue;
+            }
+
+            bucket_type& bucket = it->second;
+            auto const eit = std::find_if(bucket.begin(), bucket.end(),
+                [&](entry const& e) { return e.lower == lower; });
+            if (eit != bucket.end())
+            {
+                bucket.erase(eit);
+                removed = true;
+            }
+
+            if (bucket.empty())
+            {
+                s.index_.erase(it);
+            }
+        }
+
+        if (removed)
+        {
+            --num_ranges_;
+            ++invalidations_;
+        }
+        return removed;
+    }
+
+    void gva_range_table::clear()
+    {
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            shard& s = shards_[i].data_;
+
+            std::unique_lock<hpx::shared_mutex> l(s.mtx_);
+            s.index_.clear();
+        }
+        num_ranges_.store(0, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t gva_range_table::hits(bool reset) noexcept
+    {
+        return util::get_and_reset_value(hits_.data_, reset);
+    }
+
+    std::uint64_t gva_range_table::misses(bool reset) noexcept
+    {
+        return util::get_and_reset_value(misses_.data_, reset);
+    }
+
+    std::uint64_t gva_range_table::insertions(bool reset) noexcept
+    {
+        return util::get_and_reset_value(insertions_, reset);
+    }
+
+    std::uint64_t gva_range_table::invalidations(bool reset) noexcept
+    {
+        return util::get_and_reset_value(invalidations_, reset);
+    }
+}    // namespace hpx::agas::detail
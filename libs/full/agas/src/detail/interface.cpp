@@ -147,6 +147,17 @@ namespace hpx::agas::detail::impl {
             gid, addr, count, offset, ec);
     }
 
+    hpx::future<void> prefetch_gva_ranges(std::vector<hpx::id_type> const& ids)
+    {
+        std::vector<naming::gid_type> gids;
+        gids.reserve(ids.size());
+        for (hpx::id_type const& id : ids)
+        {
+            gids.push_back(id.get_gid());
+        }
+        return naming::get_agas_client().prefetch_gva_ranges(gids);
+    }
+
     bool is_local_lva_encoded_address(naming::gid_type const& gid)
     {
         return naming::get_agas_client().is_local_lva_encoded_address(
@@ -570,6 +581,7 @@ namespace hpx::agas {
             detail::is_local_address_cached_addr_pinned_ptr =
                 &detail::impl::is_local_address_cached_addr_pinned_ptr;
             detail::update_cache_entry = &detail::impl::update_cache_entry;
+            detail::prefetch_gva_ranges = &detail::impl::prefetch_gva_ranges;
 
             detail::is_local_lva_encoded_address =
                 &detail::impl::is_local_lva_encoded_address;
@@ -0,0 +1,166 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/refcnt_buffers.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace hpx::agas::detail {
+
+    refcnt_buffers::refcnt_buffers(std::size_t num_buffers)
+      : num_buffers_((std::max)(num_buffers, std::size_t(1)))
+      , buffers_(new hpx::util::cache_aligned_data<buffer>[num_buffers_])
+      , filter_(new std::atomic<std::uint32_t>[num_filter_slots])
+    {
+        for (std::size_t i = 0; i != num_filter_slots; ++i)
+        {
+            filter_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    refcnt_buffers::~refcnt_buffers() = default;
+
+    refcnt_buffers::buffer& refcnt_buffers::local_buffer() const noexcept
+    {
+        // threads that are not worker threads (and worker threads of
+        // additional thread pools) share buffers
+        std::size_t num_thread = hpx::get_worker_thread_num();
+        if (num_thread == static_cast<std::size_t>(-1))
+        {
+            num_thread = 0;
+        }
+        return buffers_[num_thread % num_buffers_].data_;
+    }
+
+    std::atomic<std::uint32_t>& refcnt_buffers::filter_slot(
+        naming::gid_type const& id) const noexcept
+    {
+        return filter_[std::hash<naming::gid_type>()(id) %
+            num_filter_slots];
+    }
+
+    std::size_t refcnt_buffers::add(
+        naming::gid_type const& id, std::int64_t credit)
+    {
+        HPX_ASSERT(credit > 0);
+
+        buffer& b = local_buffer();
+
+        std::lock_guard<hpx::spinlock> l(b.mtx_);
+        if (b.requests_.empty())
+        {
+            b.oldest_ = hpx::chrono::high_resolution_clock::now();
+        }
+        auto const [it, inserted] = b.requests_.try_emplace(id, 0);
+        if (inserted)
+        {
+            filter_slot(id).fetch_add(1, std::memory_order_relaxed);
+        }
+        it->second -= credit;
+
+        b.decrefs_.fetch_add(1, std::memory_order_relaxed);
+
+        std::size_t const count = b.count_.load(std::memory_order_relaxed) + 1;
+        b.count_.store(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    std::int64_t refcnt_buffers::extract(naming::gid_type const& id)
+    {
+        // no buffer holds a decrement for this id
+        std::atomic<std::uint32_t>& slot = filter_slot(id);
+        if (slot.load(std::memory_order_relaxed) == 0)
+        {
+            return 0;
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            buffer& b = buffers_[i].data_;
+            if (b.count_.load(std::memory_order_relaxed) == 0)
+            {
+                continue;
+            }
+
+            std::lock_guard<hpx::spinlock> l(b.mtx_);
+            if (auto const it = b.requests_.find(id); it != b.requests_.end())
+            {
+                result += it->second;
+                b.requests_.erase(it);
+
+                slot.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        HPX_ASSERT(result <= 0);
+        return result;
+    }
+
+    std::uint64_t refcnt_buffers::merge_into(requests_type& requests)
+    {
+        std::uint64_t oldest = 0;
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            buffer& b = buffers_[i].data_;
+            if (b.count_.load(std::memory_order_relaxed) == 0)
+            {
+                continue;
+            }
+
+            std::lock_guard<hpx::spinlock> l(b.mtx_);
+            for (auto const& e : b.requests_)
+            {
+                HPX_ASSERT(e.second < 0);
+                requests[e.first] += e.second;
+
+                filter_slot(e.first).fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            if (!b.requests_.empty() && (oldest == 0 || b.oldest_ < oldest))
+            {
+                oldest = b.oldest_;
+            }
+
+            b.requests_.clear();
+            b.count_.store(0, std::memory_order_relaxed);
+        }
+        return oldest;
+    }
+
+    std::size_t refcnt_buffers::pending() const noexcept
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            result += buffers_[i].data_.count_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::uint64_t refcnt_buffers::decrefs(bool reset) noexcept
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            result +=
+                util::get_and_reset_value(buffers_[i].data_.decrefs_, reset);
+        }
+        return result;
+    }
+}    // namespace hpx::agas::detail
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx::detail {
 
@@ -40,6 +41,50 @@ namespace hpx::detail {
 HPX_PLAIN_ACTION_ID(hpx::detail::update_agas_cache, update_agas_cache_action,
     hpx::actions::update_agas_cache_action_id)
 
+namespace hpx::detail {
+
+    void invalidate_agas_cache(hpx::naming::gid_type const& gid)
+    {
+        naming::get_agas_client().remove_cache_entry(gid);
+    }
+}    // namespace hpx::detail
+
+HPX_PLAIN_ACTION_ID(hpx::detail::invalidate_agas_cache,
+    invalidate_agas_cache_action,
+    hpx::actions::invalidate_agas_cache_action_id)
+
+namespace hpx::agas::detail {
+
+    // push the invalidation of the cached address of the given (migrated)
+    // object to all other localities
+    void broadcast_cache_invalidation(naming::gid_type const& gid)
+    {
+        runtime const& rt = get_runtime();
+        if (rt.get_state() >= hpx::state::pre_shutdown)
+        {
+            return;
+        }
+
+        std::vector<naming::gid_type> localities;
+        if (!naming::get_agas_client().get_localities(localities))
+        {
+            return;
+        }
+
+        std::uint32_t const here = agas::get_locality_id();
+        for (naming::gid_type const& locality : localities)
+        {
+            std::uint32_t const locality_id =
+                naming::get_locality_id_from_gid(locality);
+            if (locality_id != here)
+            {
+                hpx::post<invalidate_agas_cache_action>(
+                    naming::get_id_from_locality_id(locality_id), gid);
+            }
+        }
+    }
+}    // namespace hpx::agas::detail
+
 namespace hpx::agas::server {
 
     void route_impl(primary_namespace& server, parcelset::parcel&& p)
@@ -0,0 +1,189 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/agas/detail/gva_range_table.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_range_table;
+using hpx::naming::gid_type;
+
+constexpr std::uint64_t granule_size = std::uint64_t(1)
+    << gva_range_table::granule_bits;
+
+gva make_gva(std::uint64_t count, std::uint64_t lva)
+{
+    return gva(gid_type(std::uint64_t(1), std::uint64_t(0)), 42, count, lva, 8);
+}
+
+void test_insert_find()
+{
+    gva_range_table table(4);
+
+    // a range crossing a granule boundary
+    gid_type const lower(2, granule_size - 10);
+    HPX_TEST(table.insert(lower, make_gva(100, 0x1000)));
+    HPX_TEST_EQ(table.size(), std::size_t(1));
+
+    gva g;
+    gid_type idbase;
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(table.find(lower + i, g, idbase));
+        HPX_TEST_EQ(idbase, lower);
+        HPX_TEST_EQ(g.count, std::uint64_t(100));
+        HPX_TEST_EQ(g.lva(lower + i, idbase),
+            reinterpret_cast<gva::lva_type>(0x1000 + i * 8));
+    }
+
+    HPX_TEST(!table.find(lower - 1, g, idbase));
+    HPX_TEST(!table.find(lower + 100, g, idbase));
+    HPX_TEST_EQ(table.hits(false), std::uint64_t(100));
+    HPX_TEST_EQ(table.misses(false), std::uint64_t(2));
+
+    // overlapping ranges are rejected
+    HPX_TEST(!table.insert(lower + 50, make_gva(100, 0x2000)));
+    HPX_TEST_EQ(table.size(), std::size_t(1));
+
+    // adjacent ranges are fine
+    HPX_TEST(table.insert(lower + 100, make_gva(10, 0x2000)));
+    HPX_TEST_EQ(table.size(), std::size_t(2));
+    HPX_TEST(table.contains(lower + 105));
+}
+
+void test_erase()
+{
+    gva_range_table table(4);
+
+    gid_type const lower(3, 3 * granule_size - 1);
+    HPX_TEST(table.insert(lower, make_gva(2 * granule_size, 0x1000)));
+
+    // erasing any id in the range removes the whole range
+    HPX_TEST(table.erase(lower + granule_size));
+    HPX_TEST_EQ(table.size(), std::size_t(0));
+    HPX_TEST_EQ(table.invalidations(true), std::uint64_t(1));
+    HPX_TEST_EQ(table.invalidations(false), std::uint64_t(0));
+
+    HPX_TEST(!table.contains(lower));
+    HPX_TEST(!table.contains(lower + 2 * granule_size - 1));
+    HPX_TEST(!table.erase(lower));
+
+    // the range can be inserted again
+    HPX_TEST(table.insert(lower, make_gva(1, 0x1000)));
+    table.clear();
+    HPX_TEST_EQ(table.size(), std::size_t(0));
+    HPX_TEST(!table.contains(lower));
+}
+
+void test_large_range()
+{
+    gva_range_table table(4);
+
+    // ranges spanning too many granules are not stored
+    std::uint64_t const count =
+        (gva_range_table::max_granules_per_range + 1) * granule_size;
+    gid_type const lower(std::uint64_t(4), std::uint64_t(0));
+    HPX_TEST(!table.insert(lower, make_gva(count, 0x1000)));
+    HPX_TEST_EQ(table.size(), std::size_t(0));
+}
+
+void test_concurrent_insert()
+{
+    gva_range_table table(4);
+
+    // concurrently insert the same and overlapping ranges crossing several
+    // granules, only one of them may be stored
+    gid_type const lower(5, granule_size - 10);
+
+    std::atomic<std::size_t> inserted(0);
+    std::vector<hpx::future<void>> futures;
+    for (std::uint64_t i = 0; i != 16; ++i)
+    {
+        futures.push_back(hpx::async([&, i]() {
+            if (table.insert(
+                    lower + (i % 4), make_gva(3 * granule_size, 0x1000)))
+            {
+                ++inserted;
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(inserted.load(), std::size_t(1));
+    HPX_TEST_EQ(table.size(), std::size_t(1));
+
+    // a single erase invalidates the whole range
+    HPX_TEST(table.erase(lower + 3));
+    HPX_TEST_EQ(table.size(), std::size_t(0));
+    for (std::uint64_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST(!table.contains(lower + i));
+        HPX_TEST(!table.contains(lower + i + 2 * granule_size));
+    }
+}
+
+// a range resolved before an invalidation must not be inserted after it
+void test_stale_insert()
+{
+    gva_range_table table(4);
+
+    gid_type const lower(6, granule_size - 10);
+    gva const g = make_gva(3 * granule_size, 0x1000);
+
+    // the reply arrives after the (pushed) invalidation of an id in the
+    // range, even though the range was not known when it was invalidated
+    hpx::promise<void> reply;
+    std::uint64_t const generation = table.generation();
+    hpx::future<bool> inserted =
+        reply.get_future().then(hpx::launch::sync, [&](hpx::future<void>&&) {
+            return table.insert(lower, g, generation);
+        });
+
+    HPX_TEST(!table.erase(lower + granule_size));
+    reply.set_value();
+
+    HPX_TEST(!inserted.get());
+    HPX_TEST_EQ(table.size(), std::size_t(0));
+    HPX_TEST(!table.contains(lower + granule_size));
+
+    // clearing the table invalidates pending replies as well
+    std::uint64_t const before_clear = table.generation();
+    table.clear();
+    HPX_TEST(!table.insert(lower, g, before_clear));
+
+    // a reply arriving without an invalidation in between is inserted
+    HPX_TEST(table.insert(lower, g, table.generation()));
+    HPX_TEST(table.contains(lower + granule_size));
+}
+
+int hpx_main()
+{
+    test_insert_find();
+    test_erase();
+    test_large_range();
+    test_concurrent_insert();
+    test_stale_insert();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
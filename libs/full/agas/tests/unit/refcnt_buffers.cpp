@@ -0,0 +1,173 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/agas/detail/refcnt_buffers.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::detail::refcnt_buffers;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+struct refcnt_component : hpx::components::component_base<refcnt_component>
+{
+    refcnt_component()
+    {
+        ++alive;
+    }
+
+    ~refcnt_component()
+    {
+        --alive;
+    }
+
+    static std::atomic<int> alive;
+};
+
+std::atomic<int> refcnt_component::alive(0);
+
+using refcnt_component_type = hpx::components::component<refcnt_component>;
+HPX_REGISTER_COMPONENT(refcnt_component_type, refcnt_component)
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_ids = 10;
+constexpr std::size_t num_tasks = 16;
+
+// decrements added concurrently are merged into a single batch
+void test_batching()
+{
+    refcnt_buffers buffers(4);
+    HPX_TEST_EQ(buffers.size(), std::size_t(4));
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::uint64_t i = 0; i != num_ids; ++i)
+            {
+                buffers.add(gid_type(1, i + 1), 8);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(buffers.pending(), num_tasks * num_ids);
+    HPX_TEST_EQ(buffers.decrefs(false), std::uint64_t(num_tasks * num_ids));
+
+    refcnt_buffers::requests_type requests;
+    HPX_TEST_NEQ(buffers.merge_into(requests), std::uint64_t(0));
+
+    HPX_TEST_EQ(requests.size(), num_ids);
+    for (auto const& e : requests)
+    {
+        HPX_TEST_EQ(e.second, -std::int64_t(8 * num_tasks));
+    }
+
+    // the buffers are empty after merging
+    HPX_TEST_EQ(buffers.pending(), std::size_t(0));
+
+    refcnt_buffers::requests_type empty;
+    HPX_TEST_EQ(buffers.merge_into(empty), std::uint64_t(0));
+    HPX_TEST(empty.empty());
+
+    HPX_TEST_EQ(buffers.decrefs(true), std::uint64_t(num_tasks * num_ids));
+    HPX_TEST_EQ(buffers.decrefs(false), std::uint64_t(0));
+}
+
+// an incref extracts the pending decrements of its id from all buffers
+void test_extract()
+{
+    refcnt_buffers buffers(4);
+
+    gid_type const id(2, 42);
+    gid_type const other(2, 43);
+
+    HPX_TEST_EQ(buffers.extract(id), std::int64_t(0));
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        futures.push_back(hpx::async([&]() {
+            buffers.add(id, 10);
+            buffers.add(other, 1);
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(buffers.extract(id), -std::int64_t(10 * num_tasks));
+    HPX_TEST_EQ(buffers.extract(id), std::int64_t(0));
+
+    refcnt_buffers::requests_type requests;
+    buffers.merge_into(requests);
+
+    HPX_TEST_EQ(requests.size(), std::size_t(1));
+    HPX_TEST(requests.find(id) == requests.end());
+    HPX_TEST_EQ(requests[other], -std::int64_t(num_tasks));
+
+    // ids are found again after being merged or extracted
+    buffers.add(id, 5);
+    buffers.add(other, 5);
+    HPX_TEST_EQ(buffers.extract(id), std::int64_t(-5));
+    HPX_TEST_EQ(buffers.extract(other), std::int64_t(-5));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// released ids are buffered and sent on garbage collection or shutdown
+void test_flush(std::vector<hpx::id_type>& ids)
+{
+    for (std::size_t i = 0; i != 2 * num_ids; ++i)
+    {
+        ids.push_back(hpx::new_<refcnt_component>(hpx::find_here()).get());
+    }
+    HPX_TEST_EQ(refcnt_component::alive.load(), int(2 * num_ids));
+
+    // release half of the components explicitly
+    ids.resize(num_ids);
+    for (int i = 0; i != 10 && refcnt_component::alive.load() != int(num_ids);
+        ++i)
+    {
+        hpx::agas::garbage_collect();
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(refcnt_component::alive.load(), int(num_ids));
+
+    // the remaining ones are released right before shutdown
+    ids.clear();
+}
+
+int hpx_main()
+{
+    test_batching();
+    test_extract();
+
+    {
+        std::vector<hpx::id_type> ids;
+        test_flush(ids);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+
+    // the pending decrements have been sent while shutting down
+    HPX_TEST_EQ(refcnt_component::alive.load(), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -417,6 +417,22 @@ namespace hpx::util {
                   "each locality prints only its own local counters")
                 ("hpx:print-counter-types",
                   "append counter type description to generated output")
+                ("hpx:export-counter",
+                    value<std::vector<std::string> >()->composing(),
+                  "periodically publish the values of the specified local "
+                  "performance counter(s) to a shared memory segment (see "
+                  "also options --hpx:export-counter-interval and "
+                  "--hpx:export-counter-destination)")
+                ("hpx:export-counter-interval", value<std::size_t>(),
+                  "publish the performance counter(s) specified with "
+                  "--hpx:export-counter repeatedly after the time interval "
+                  "(specified in milliseconds, default: 1000)")
+                ("hpx:export-counter-destination", value<std::string>(),
+                  "publish the performance counter(s) specified with "
+                  "--hpx:export-counter to the shared memory segment with the "
+                  "given name, '{pid}' and '{locality}' are replaced by the "
+                  "process id and the locality id (default: "
+                  "'/hpx_counters.{pid}')")
             ;
 #endif
             // clang-format on
@@ -156,6 +156,11 @@ namespace hpx::agas {
         naming::address const& addr, std::uint64_t count = 0,
         std::uint64_t offset = 0, error_code& ec = throws);
 
+    /// \brief Resolve the given ids and keep the address ranges they belong
+    ///        to in the (non-evictable) local range table.
+    HPX_EXPORT hpx::future<void> prefetch_gva_ranges(
+        std::vector<hpx::id_type> const& ids);
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_EXPORT bool is_local_lva_encoded_address(naming::gid_type const& gid);
 
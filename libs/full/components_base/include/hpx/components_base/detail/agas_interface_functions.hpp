@@ -110,6 +110,9 @@ namespace hpx::agas::detail {
         naming::address const& addr, std::uint64_t count, std::uint64_t offset,
         error_code& ec);
 
+    extern HPX_EXPORT hpx::future<void> (*prefetch_gva_ranges)(
+        std::vector<hpx::id_type> const& ids);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT bool (*is_local_lva_encoded_address)(
         naming::gid_type const& gid);
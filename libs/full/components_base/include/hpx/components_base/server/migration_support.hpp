@@ -19,7 +19,9 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <type_traits>
@@ -27,6 +29,17 @@
 
 namespace hpx::components {
 
+    /// Statistics about the actions executed on a migratable component
+    struct migration_load_statistics
+    {
+        // accumulated (wall clock) time spent executing actions [ns]
+        std::uint64_t busy_time = 0;
+
+        // number of actions executed
+        std::uint64_t invocations = 0;
+    };
+
+    /// \cond NOINTERNAL
     namespace detail {
 
         template <typename Mutex>
@@ -54,6 +67,12 @@ namespace hpx::components {
             mutable Mutex mtx_;
             std::uint32_t pin_count_ = 0;
 
+            // load statistics, sampled by the load balancer, these are
+            // collected only while the object is registered with it
+            std::atomic<bool> collect_load_ = false;
+            std::atomic<std::uint64_t> busy_time_ = 0;
+            std::atomic<std::uint64_t> invocations_ = 0;
+
         private:
             friend void intrusive_ptr_add_ref(
                 migration_support_data* p) noexcept
@@ -221,6 +240,37 @@ namespace hpx::components {
 
             return data->pin_count_;
         }
+
+        // Enable or disable collecting statistics about the actions executed
+        // on this object. Collecting is disabled by default and is enabled
+        // while the object is registered with the load balancer.
+        void enable_load_statistics(bool enable) noexcept
+        {
+            auto& d = *data_;
+            if (enable)
+            {
+                d.busy_time_.store(0, std::memory_order_relaxed);
+                d.invocations_.store(0, std::memory_order_relaxed);
+            }
+            d.collect_load_.store(enable, std::memory_order_relaxed);
+        }
+
+        // Return the statistics about the actions executed on this object
+        // since collecting was enabled (or since the statistics were last
+        // reset).
+        [[nodiscard]] migration_load_statistics load_statistics(
+            bool reset = false) noexcept
+        {
+            if (reset)
+            {
+                auto& d = *data_;
+                return {d.busy_time_.exchange(0, std::memory_order_relaxed),
+                    d.invocations_.exchange(0, std::memory_order_relaxed)};
+            }
+            return {data_->busy_time_.load(std::memory_order_relaxed),
+                data_->invocations_.load(std::memory_order_relaxed)};
+        }
+
         void mark_as_migrated()
         {
             auto const data = data_;    // keep alive
@@ -332,6 +382,23 @@ namespace hpx::components {
             threads::thread_function_type&& f, components::pinned_ptr,
             threads::thread_restart_state state)
         {
+            if (!data_->collect_load_.load(std::memory_order_relaxed))
+            {
+                return f(state);
+            }
+
+            // account for the time spent executing the action, this is used
+            // by the load balancer to decide what objects to migrate
+            auto const data = data_;    // keep alive
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            auto on_exit = hpx::experimental::scope_exit([&] {
+                data->busy_time_.fetch_add(
+                    hpx::chrono::high_resolution_clock::now() - start,
+                    std::memory_order_relaxed);
+                data->invocations_.fetch_add(1, std::memory_order_relaxed);
+            });
+
             return f(state);
         }
 
@@ -145,6 +145,11 @@ namespace hpx::agas {
         return detail::update_cache_entry(gid, addr, count, offset, ec);
     }
 
+    hpx::future<void> prefetch_gva_ranges(std::vector<hpx::id_type> const& ids)
+    {
+        return detail::prefetch_gva_ranges(ids);
+    }
+
     bool is_local_lva_encoded_address(naming::gid_type const& gid)
     {
         return detail::is_local_lva_encoded_address(gid);
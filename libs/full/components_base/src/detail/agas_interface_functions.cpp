@@ -106,6 +106,9 @@ namespace hpx::agas::detail {
         naming::address const& addr, std::uint64_t count, std::uint64_t offset,
         error_code& ec) = nullptr;
 
+    hpx::future<void> (*prefetch_gva_ranges)(
+        std::vector<hpx::id_type> const& ids) = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     bool (*is_local_lva_encoded_address)(naming::gid_type const& gid) = nullptr;
 
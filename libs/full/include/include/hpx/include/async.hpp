@@ -14,3 +14,4 @@
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/async_callback.hpp>
 #include <hpx/async_distributed/async_continue_callback.hpp>
+#include <hpx/runtime_distributed/distributed_work_stealing.hpp>
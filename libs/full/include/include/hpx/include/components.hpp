@@ -39,6 +39,7 @@
 #include <hpx/components_base/server/migration_support.hpp>
 
 #include <hpx/runtime_distributed/copy_component.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
 #include <hpx/runtime_distributed/migrate_component.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #include <hpx/runtime_distributed/stubs/runtime_support.hpp>
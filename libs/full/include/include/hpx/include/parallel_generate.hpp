@@ -9,6 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/parallel/algorithms/generate.hpp>
+#include <hpx/parallel/algorithms/generate_random.hpp>
 #include <hpx/parallel/container_algorithms/generate.hpp>
 
 #include <hpx/parallel/segmented_algorithms/generate.hpp>
@@ -72,6 +72,7 @@
 #include <hpx/parcelset_base/locality_interface.hpp>
 #endif
 #include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/export_counters.hpp>
 #include <hpx/performance_counters/query_counters.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
@@ -80,6 +81,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <functional>
@@ -395,6 +397,22 @@ namespace hpx::detail {
             hpx::terminate();
         }
     }
+
+    void start_exporting_counters(
+        std::shared_ptr<util::export_counters> const& ec)
+    {
+        try
+        {
+            HPX_ASSERT(ec);
+            ec->start();
+        }
+        catch (...)
+        {
+            std::cerr << hpx::diagnostic_information(std::current_exception())
+                      << std::flush;
+            hpx::terminate();
+        }
+    }
 #endif
 }    // namespace hpx::detail
 
@@ -655,6 +673,62 @@ namespace hpx {
                     "--hpx:print-counter only");
             }
         }
+
+        void handle_export_options(
+            hpx::runtime& rt, hpx::program_options::variables_map& vm)
+        {
+            if (vm.count("hpx:export-counter"))
+            {
+                std::size_t interval = 1000;
+                if (vm.count("hpx:export-counter-interval"))
+                {
+                    interval =
+                        vm["hpx:export-counter-interval"].as<std::size_t>();
+                    if (interval == 0)
+                    {
+                        throw detail::command_line_error(
+                            "Invalid command line option "
+                            "--hpx:export-counter-interval, the interval "
+                            "must be positive");
+                    }
+                }
+
+                std::vector<std::string> const counters =
+                    vm["hpx:export-counter"].as<std::vector<std::string>>();
+
+                std::string destination("/hpx_counters.{pid}");
+                if (vm.count("hpx:export-counter-destination"))
+                {
+                    destination =
+                        vm["hpx:export-counter-destination"].as<std::string>();
+                }
+
+                std::shared_ptr<util::export_counters> ec =
+                    std::make_shared<util::export_counters>(counters,
+                        static_cast<std::int64_t>(interval), destination);
+
+                // the shutdown function keeps the exporter alive until the
+                // runtime is stopped
+                rt.add_startup_function(
+                    hpx::bind_front(&start_exporting_counters, ec));
+                rt.add_pre_shutdown_function(
+                    hpx::bind_front(&util::export_counters::stop, ec));
+            }
+            else if (vm.count("hpx:export-counter-interval"))
+            {
+                throw detail::command_line_error(
+                    "Invalid command line option "
+                    "--hpx:export-counter-interval, valid in conjunction "
+                    "with --hpx:export-counter only");
+            }
+            else if (vm.count("hpx:export-counter-destination"))
+            {
+                throw detail::command_line_error(
+                    "Invalid command line option "
+                    "--hpx:export-counter-destination, valid in conjunction "
+                    "with --hpx:export-counter only");
+            }
+        }
 #endif
 
         void add_startup_functions(hpx::runtime& rt,
@@ -681,6 +755,9 @@ namespace hpx {
                 vm.count("hpx:print-counters-locally") != 0;
             if (mode == runtime_mode::console || print_counters_locally)
                 handle_list_and_print_options(rt, vm, print_counters_locally);
+
+            // Every locality exports its own counters, if requested.
+            handle_export_options(rt, vm);
 #else
             HPX_UNUSED(mode);
 #endif
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -320,6 +321,15 @@ namespace hpx::parcelset::policies::mpi {
                 // decode and handle received data
                 HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                     !pp_.allow_zero_copy_receive_optimizations());
+
+                // hand over the received zero-copy chunks, this allows for
+                // the de-serialized data to reference them in place
+                if (!chunk_buffers_.empty())
+                {
+                    buffer_.chunks_owner_ =
+                        std::make_shared<std::vector<std::vector<char>>>(
+                            HPX_MOVE(chunk_buffers_));
+                }
                 handle_received_parcels(
                     decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
                     num_thread);
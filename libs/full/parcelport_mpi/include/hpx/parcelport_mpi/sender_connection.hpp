@@ -277,7 +277,8 @@ namespace hpx::parcelset::policies::mpi {
                 buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 #endif
-            buffer_.clear();
+            // keep the allocated memory for encoding the next message
+            buffer_.clear(pp_->get_max_retained_buffer_size());
 
             state_ = initialized;
 
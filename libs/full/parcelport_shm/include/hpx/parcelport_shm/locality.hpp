@@ -0,0 +1,81 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace hpx::parcelset::policies::shm {
+
+    // A locality reachable through shared memory is identified by the name of
+    // the host it runs on and by its process id. The process id determines the
+    // name of the shared memory segment holding the locality's inbox.
+    class locality
+    {
+    public:
+        locality() noexcept
+          : pid_(0)
+        {
+        }
+
+        locality(std::string host, std::uint32_t pid)
+          : host_(HPX_MOVE(host))
+          , pid_(pid)
+        {
+        }
+
+        [[nodiscard]] std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        [[nodiscard]] std::uint32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shm";
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return pid_ != 0;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.pid_ == rhs.pid_ && lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_ < rhs.host_ ||
+                (lhs.host_ == rhs.host_ && lhs.pid_ < rhs.pid_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::uint32_t pid_;
+    };
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
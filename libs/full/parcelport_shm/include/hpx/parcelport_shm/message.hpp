@@ -0,0 +1,59 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::parcelset::policies::shm {
+
+    using parcel_buffer_type = parcel_buffer<std::vector<char>>;
+    using transmission_chunk_type = parcel_buffer_type::transmission_chunk_type;
+
+    // kinds of the records in the inbox of a locality
+    enum class message_kind : std::uint32_t
+    {
+        // the payload of the message follows the header in the inbox
+        inline_message = 1,
+
+        // the payload of the message was placed in a separate segment, the
+        // (NUL-terminated) name of the segment follows the header
+        segment_message = 2
+    };
+
+    // Each message starts with this header. The payload of the message holds
+    // the transmission chunk descriptions, the non-zero-copy data, and the
+    // zero-copy chunks (in this order), each starting at a multiple of
+    // message_alignment relative to the beginning of the payload.
+    struct message_header
+    {
+        std::uint64_t size;         // parcel_buffer::size_
+        std::uint64_t data_size;    // parcel_buffer::data_size_
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint64_t payload_size;
+    };
+
+    inline constexpr std::size_t message_alignment = 64;
+
+    constexpr std::size_t align_message(std::size_t size) noexcept
+    {
+        return (size + message_alignment - 1) & ~(message_alignment - 1);
+    }
+
+    // offset of the payload in inline messages
+    inline constexpr std::size_t message_payload_offset =
+        align_message(sizeof(message_header));
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
@@ -0,0 +1,209 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shm/message.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shm {
+
+    template <typename Parcelport>
+    class receiver
+    {
+    public:
+        receiver(Parcelport& pp, ring_buffer& inbox) noexcept
+          : pp_(pp)
+          , inbox_(inbox)
+        {
+        }
+
+        // Receive and handle (at most) one message, returns whether a message
+        // was received.
+        bool background_work(std::size_t num_thread = -1) noexcept
+        {
+            parcel_buffer_type buffer;
+            {
+                // only one thread may consume messages from the inbox
+                std::unique_lock l(mtx_, std::try_to_lock);
+                if (!l.owns_lock() || !receive_message(buffer))
+                {
+                    return false;
+                }
+            }
+
+            // decode and handle received data
+            handle_received_parcels(
+                decode_parcels(pp_, HPX_MOVE(buffer), num_thread), num_thread);
+            return true;
+        }
+
+    private:
+        bool receive_message(parcel_buffer_type& buffer)
+        {
+            std::uint32_t kind = 0;
+            std::size_t size = 0;
+            char const* record = inbox_.try_begin_read(kind, size);
+            if (record == nullptr)
+            {
+                return false;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            std::int64_t const start = timer_.elapsed_nanoseconds();
+#endif
+            message_header header;
+            std::memcpy(&header, record, sizeof(header));
+
+            buffer.size_ = header.size;
+            buffer.data_size_ = header.data_size;
+            buffer.num_chunks_.first = header.num_zero_copy_chunks;
+            buffer.num_chunks_.second = header.num_non_zero_copy_chunks;
+
+            if (kind ==
+                static_cast<std::uint32_t>(message_kind::inline_message))
+            {
+                // the inbox space is reused, thus everything is copied
+                read_payload(buffer, record + message_payload_offset, true);
+                inbox_.end_read();
+            }
+            else
+            {
+                HPX_ASSERT(kind ==
+                    static_cast<std::uint32_t>(message_kind::segment_message));
+
+                std::string name(record + message_payload_offset);
+                inbox_.end_read();
+
+                error_code ec(throwmode::lightweight);
+                shared_memory_segment segment =
+                    shared_memory_segment::open(HPX_MOVE(name), ec);
+                if (ec)
+                {
+                    LPT_(error).format(
+                        "shm::receiver::receive_message: dropping message: {}",
+                        ec.get_message());
+                    buffer = parcel_buffer_type();
+                    return false;
+                }
+
+                // the segment is not needed by anybody else anymore
+                segment.unlink();
+
+                // the zero-copy chunks are referenced in place, the mapping
+                // is released once the last chunk isn't used anymore
+                read_payload(
+                    buffer, static_cast<char const*>(segment.data()), false);
+                buffer.chunks_owner_ = segment.release_shared();
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.bytes_ = static_cast<std::size_t>(header.size);
+            buffer.data_point_.time_ = timer_.elapsed_nanoseconds() - start;
+#endif
+            return true;
+        }
+
+        // Extract the message data from the payload. The zero-copy chunks
+        // are copied only if requested.
+        static void read_payload(parcel_buffer_type& buffer,
+            char const* payload, bool copy_chunks)
+        {
+            auto const num_zero_copy_chunks =
+                static_cast<std::size_t>(buffer.num_chunks_.first);
+            auto const num_chunks = num_zero_copy_chunks +
+                static_cast<std::size_t>(buffer.num_chunks_.second);
+
+            std::vector<transmission_chunk_type>& tchunks =
+                buffer.transmission_chunks_;
+            if (num_zero_copy_chunks != 0)
+            {
+                tchunks.resize(num_chunks);
+                std::memcpy(static_cast<void*>(tchunks.data()), payload,
+                    num_chunks * sizeof(transmission_chunk_type));
+                payload +=
+                    align_message(num_chunks * sizeof(transmission_chunk_type));
+            }
+
+            auto const data_size = static_cast<std::size_t>(buffer.size_);
+            buffer.data_.resize(data_size);
+            std::memcpy(buffer.data_.data(), payload, data_size);
+            payload += align_message(data_size);
+
+            if (num_zero_copy_chunks == 0)
+            {
+                return;
+            }
+
+            buffer.chunks_.resize(num_zero_copy_chunks);
+
+            std::shared_ptr<std::vector<std::vector<char>>> chunk_buffers;
+            if (copy_chunks)
+            {
+                chunk_buffers =
+                    std::make_shared<std::vector<std::vector<char>>>(
+                        num_zero_copy_chunks);
+            }
+
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                auto const chunk_size =
+                    static_cast<std::size_t>(tchunks[i].second);
+
+                char const* data = payload;
+                if (copy_chunks)
+                {
+                    std::vector<char>& c = (*chunk_buffers)[i];
+                    c.assign(payload, payload + chunk_size);
+                    data = c.data();
+                }
+
+                buffer.chunks_[i] =
+                    serialization::create_pointer_chunk(data, chunk_size);
+                payload += align_message(chunk_size);
+            }
+
+            // hand over the received zero-copy chunks, this allows for the
+            // de-serialized data to reference them in place
+            if (copy_chunks)
+            {
+                buffer.chunks_owner_ = HPX_MOVE(chunk_buffers);
+            }
+        }
+
+        Parcelport& pp_;
+        ring_buffer& inbox_;
+        hpx::spinlock mtx_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
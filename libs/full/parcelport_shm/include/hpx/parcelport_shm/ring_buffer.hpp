@@ -0,0 +1,144 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset::policies::shm {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A queue of variable sized records placed in a shared memory segment.
+    //
+    // Any number of producers (in any process mapping the segment) append
+    // records while holding a spinlock stored in the segment, the single
+    // consumer (the process owning the segment) removes records without
+    // taking any locks. The spinlock holds the process id of its owner such
+    // that a lock left behind by a process which has died can be broken.
+    // Records are contiguous in memory, a record which does not fit in front
+    // of the end of the ring is preceded by a padding record and starts at
+    // the beginning of the ring.
+    //
+    // A consumer running out of records may block on a futex in the segment,
+    // producers wake it up after publishing a record.
+    class HPX_EXPORT ring_buffer
+    {
+    public:
+        // record kind reserved for padding records
+        static constexpr std::uint32_t padding_record = 0;
+
+        // number of bytes a segment holding a ring of the given capacity
+        // (rounded up to the next power of two) requires
+        static std::size_t segment_size(std::size_t capacity) noexcept;
+
+        ring_buffer() = default;
+
+        // Attach to the given segment, initialize the control data if this
+        // is the consumer creating the segment.
+        ring_buffer(shared_memory_segment segment, bool initialize) noexcept;
+
+        // Return whether the segment holds a properly initialized ring
+        [[nodiscard]] bool valid() const noexcept;
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        // largest payload of a record that can be stored in the ring
+        [[nodiscard]] std::size_t max_record_size() const noexcept;
+
+        // Producer side: reserve space for a record of the given kind and
+        // payload size. Returns a pointer to the payload or nullptr if the
+        // producer lock is held by somebody else or if the ring is full. On
+        // success, the producer lock is held until end_write() is called.
+        char* try_begin_write(std::uint32_t kind, std::size_t size) noexcept;
+
+        // Publish the record and wake up the consumer if it is sleeping.
+        void end_write() noexcept;
+
+        // Release the producer lock if it is held by a process which does not
+        // exist anymore. A record being written by that process is discarded.
+        // Returns whether the lock was released. Note that the lock is not
+        // released if the process id of the owner was reused in the meantime.
+        bool break_stale_lock() noexcept;
+
+        // Consumer side: return a pointer to the payload of the oldest
+        // record or nullptr if the ring is empty. Only one thread may consume
+        // from the ring at any point in time.
+        char const* try_begin_read(
+            std::uint32_t& kind, std::size_t& size) noexcept;
+
+        // Release the space occupied by the record returned by
+        // try_begin_read().
+        void end_read() noexcept;
+
+        [[nodiscard]] bool empty() const noexcept;
+
+        // Block the consumer until a new record was published, notify() was
+        // called, or the timeout expired.
+        void wait(std::chrono::microseconds timeout) noexcept;
+
+        // Wake up the consumer
+        void notify() noexcept;
+
+        // Announce that a peer (a producer in a different process) has mapped
+        // the segment.
+        void attach() noexcept;
+
+        // Return the number of peers which have announced mapping the segment
+        [[nodiscard]] std::uint32_t num_peers() const noexcept;
+
+        // Remove the name of the underlying segment
+        void unlink() noexcept
+        {
+            segment_.unlink();
+        }
+
+    private:
+        struct control_block;
+        struct record_header
+        {
+            std::uint32_t size;    // size of the payload
+            std::uint32_t kind;
+        };
+
+        static constexpr std::size_t record_alignment = 16;
+
+        static constexpr std::size_t record_size(std::size_t size) noexcept
+        {
+            return (sizeof(record_header) + size + record_alignment - 1) &
+                ~(record_alignment - 1);
+        }
+
+        [[nodiscard]] char* at(std::uint64_t pos) const noexcept
+        {
+            return data_ + (pos & (capacity_ - 1));
+        }
+
+        shared_memory_segment segment_;
+        control_block* control_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t capacity_ = 0;
+
+        // size of the record currently being read
+        std::size_t read_size_ = 0;
+
+        // the value stored in the producer lock while it is held by this
+        // process
+        std::uint32_t pid_ = 0;
+    };
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parcelport_shm/locality.hpp>
+#include <hpx/parcelport_shm/message.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shm {
+
+    // Receive (at most) one message from the inbox of the given parcelport,
+    // used by senders waiting for space in the inbox of the destination.
+    bool background_receive(parcelset::parcelport* pp) noexcept;
+
+    // A connection to a locality on the same host. Messages are copied into
+    // the inbox of the destination right away, large messages are copied
+    // into a separate shared memory segment which is mapped by the receiver
+    // such that the zero-copy chunks don't have to be copied again.
+    class HPX_EXPORT sender
+      : public parcelset::parcelport_connection<sender, std::vector<char>>
+    {
+    public:
+        sender(std::shared_ptr<ring_buffer> inbox,
+            parcelset::locality const& locality_id, parcelset::parcelport* pp,
+            std::size_t segment_threshold,
+            std::chrono::milliseconds send_timeout) noexcept
+          : inbox_(HPX_MOVE(inbox))
+          , there_(locality_id)
+          , pp_(pp)
+          , segment_threshold_(segment_threshold)
+          , send_timeout_(send_timeout)
+        {
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            HPX_ASSERT(state_ == state_send_pending);
+            state_ = state_async_write;
+#endif
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // the message is completely written once this returns
+            std::error_code const e = write_message();
+
+            // call initial handler, this releases the sent parcels
+            handler(e);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (!e)
+            {
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+#endif
+            // keep the allocated memory for encoding the next message
+            buffer_.clear(pp_->get_max_retained_buffer_size());
+
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent.
+            parcel_postprocess(e, there_, shared_from_this());
+        }
+
+    private:
+        std::error_code write_message();
+
+        // log and report a message which could not be sent in time
+        std::error_code send_timed_out() const;
+
+        // copy the payload of the message to the given location
+        void write_payload(char* dest) const noexcept;
+
+        // Wait for space in the inbox of the destination, returns nullptr if
+        // no space was made available before the send timeout expired.
+        char* begin_write(message_kind kind, std::size_t size) noexcept;
+
+        std::shared_ptr<ring_buffer> inbox_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        parcelset::parcelport* pp_;
+
+        // messages holding more zero-copy data than this are sent using a
+        // separate segment
+        std::size_t segment_threshold_;
+
+        // time to wait for space in the inbox of the destination
+        std::chrono::milliseconds send_timeout_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
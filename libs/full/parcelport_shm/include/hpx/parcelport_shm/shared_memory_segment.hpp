@@ -0,0 +1,102 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace hpx::parcelset::policies::shm {
+
+    // A named POSIX shared memory segment mapped into the address space of
+    // this process. The mapping is released on destruction, the name of the
+    // segment is removed only if requested explicitly (see unlink()).
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() = default;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        ~shared_memory_segment();
+
+        // Create a new segment of the given size, a stale segment with the
+        // same name (left behind by a crashed process) is replaced.
+        static shared_memory_segment create(
+            std::string name, std::size_t size, error_code& ec = throws);
+
+        // Map an existing segment in its full size.
+        static shared_memory_segment open(
+            std::string name, error_code& ec = throws);
+
+        [[nodiscard]] void* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        // Remove the name of the segment. Existing mappings stay valid, the
+        // memory is released by the system once the last mapping is gone.
+        void unlink() noexcept;
+
+        // Hand over the mapping to a shared_ptr, which unmaps the memory once
+        // the last reference is released.
+        std::shared_ptr<void> release_shared();
+
+    private:
+        shared_memory_segment(
+            std::string name, void* data, std::size_t size) noexcept;
+
+        void reset() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Blocking notification on a 32bit word in shared memory. This uses a
+    // (non-private) futex on Linux and falls back to sleeping for a short
+    // amount of time on other systems.
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+        "the shared memory parcelport requires lock-free 32bit atomics");
+
+    // Block while the word has the expected value (or until the timeout
+    // expires or the thread is woken up spuriously).
+    HPX_EXPORT void wait_on_address(std::atomic<std::uint32_t>& word,
+        std::uint32_t expected, std::chrono::microseconds timeout) noexcept;
+
+    // Wake up all threads (of any process) waiting on the given word.
+    HPX_EXPORT void wake_by_address(std::atomic<std::uint32_t>& word) noexcept;
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
@@ -0,0 +1,499 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelport_shm/locality.hpp>
+#include <hpx/parcelport_shm/receiver.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/sender.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <unistd.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shm {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shm
+
+    template <>
+    struct connection_handler_traits<policies::shm::parcelport>
+    {
+        using connection_type = policies::shm::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shm";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shm";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shm";
+        }
+    };
+
+    namespace policies::shm {
+
+        // The shared memory parcelport connects localities running on the
+        // same host. Each locality owns an inbox (a ring buffer in a shared
+        // memory segment named after its process id) which all other
+        // localities on the host write their messages to. The inbox is
+        // drained by the background work of the worker threads and by a
+        // thread of the parcel pool, which sleeps on a futex if there are no
+        // messages.
+        //
+        // Once the runtime is up, each locality maps the inboxes of all other
+        // localities on the same host. The name of an inbox is removed as soon
+        // as all of these have mapped it, such that it is not left behind if
+        // the locality is killed.
+        //
+        // This parcelport can't be used for bootstrapping the runtime. It is
+        // used for all destinations on the same host once the runtime is up,
+        // as long as its priority is larger than the priority of the
+        // bootstrap parcelport.
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static std::string host_name()
+            {
+                char name[256] = {};
+                if (::gethostname(name, sizeof(name) - 1) != 0)
+                {
+                    return "localhost";
+                }
+                return name;
+            }
+
+            static std::uint32_t process_id() noexcept
+            {
+                return static_cast<std::uint32_t>(::getpid());
+            }
+
+            static std::string inbox_name(std::uint32_t pid)
+            {
+                return "/hpx.shm." + std::to_string(pid);
+            }
+
+            static parcelset::locality here()
+            {
+                return parcelset::locality(locality(host_name(), process_id()));
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shm.ring_size", 4 * 1024 * 1024);
+            }
+
+            static std::size_t segment_threshold(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shm.segment_threshold", 64 * 1024);
+            }
+
+            static std::chrono::microseconds spin_time(
+                util::runtime_configuration const& ini)
+            {
+                return std::chrono::microseconds(
+                    hpx::util::get_entry_as<std::int64_t>(
+                        ini, "hpx.parcel.shm.spin_time", 100));
+            }
+
+            static std::chrono::milliseconds send_timeout(
+                util::runtime_configuration const& ini)
+            {
+                return std::chrono::milliseconds(
+                    hpx::util::get_entry_as<std::int64_t>(
+                        ini, "hpx.parcel.shm.send_timeout", 10000));
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , host_(host_name())
+              , inbox_(shared_memory_segment::create(inbox_name(process_id()),
+                           ring_buffer::segment_size(ring_size(ini))),
+                    true)
+              , receiver_(*this, inbox_)
+              , segment_threshold_(segment_threshold(ini))
+              , spin_time_(spin_time(ini))
+              , send_timeout_(send_timeout(ini))
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override
+            {
+                if (!inbox_unlinked_.load(std::memory_order_relaxed))
+                {
+                    inbox_.unlink();
+                }
+            }
+
+            // The runtime is about to start, all localities have created
+            // their inboxes.
+            void initialized() override
+            {
+                hpx::register_startup_function(
+                    [this]() { connect_local_peers(); });
+            }
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                io_service_pool_.get_io_service(0).post(
+                    hpx::bind(&parcelport::io_service_work, this));
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                // handle all messages which have arrived so far
+                while (receiver_.background_work())
+                {
+                }
+
+                stopped_.store(true, std::memory_order_release);
+                inbox_.notify();
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return host_;
+            }
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                std::shared_ptr<ring_buffer> inbox =
+                    get_inbox(l.get<locality>());
+                if (!inbox)
+                {
+                    HPX_THROWS_IF(ec, hpx::error::network_error,
+                        "shm::parcelport::create_connection",
+                        "could not connect to the inbox of locality {}", l);
+                    return {};
+                }
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+
+                return std::make_shared<sender>(HPX_MOVE(inbox), l, this,
+                    segment_threshold_, send_timeout_);
+            }
+
+            // This parcelport is never used for bootstrapping
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            // Localities on the same host are reachable if their inbox can be
+            // mapped (they might live in a different container, for instance).
+            bool can_connect(
+                parcelset::locality const& dest, bool) override
+            {
+                locality const& l = dest.get<locality>();
+                return l.host() == host_ && l.pid() != process_id() &&
+                    get_inbox(l) != nullptr;
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire) ||
+                    !(mode & parcelport_background_mode::receive))
+                {
+                    return false;
+                }
+                return receiver_.background_work(num_thread);
+            }
+
+            bool background_receive() noexcept
+            {
+                return receiver_.background_work();
+            }
+
+        private:
+            // Connect to the inbox of the given locality. Failed attempts are
+            // not cached permanently as the other locality might not have
+            // created its inbox yet, those are retried after a short delay.
+            std::shared_ptr<ring_buffer> get_inbox(locality const& l)
+            {
+                auto const now = std::chrono::steady_clock::now();
+                {
+                    std::lock_guard<hpx::spinlock> lk(inboxes_mtx_);
+
+                    if (auto const it = inboxes_.find(l.pid());
+                        it != inboxes_.end())
+                    {
+                        return it->second;
+                    }
+
+                    if (auto const it = failed_inboxes_.find(l.pid());
+                        it != failed_inboxes_.end() && now < it->second)
+                    {
+                        return nullptr;
+                    }
+                }
+
+                // map the segment without holding the lock
+                error_code ec(throwmode::lightweight);
+                auto inbox = std::make_shared<ring_buffer>(
+                    shared_memory_segment::open(inbox_name(l.pid()), ec),
+                    false);
+
+                std::lock_guard<hpx::spinlock> lk(inboxes_mtx_);
+                if (ec || !inbox->valid())
+                {
+                    failed_inboxes_[l.pid()] = now + inbox_retry_delay;
+                    return nullptr;
+                }
+
+                failed_inboxes_.erase(l.pid());
+                auto const [it, inserted] =
+                    inboxes_.emplace(l.pid(), HPX_MOVE(inbox));
+                if (inserted)
+                {
+                    it->second->attach();
+                }
+                return it->second;
+            }
+
+            // Map the inboxes of all other localities on this host and count
+            // the localities expected to map the inbox of this locality.
+            void connect_local_peers()
+            {
+                error_code ec(throwmode::lightweight);
+                std::vector<std::uint32_t> const ids =
+                    agas::get_all_locality_ids(ec);
+                if (ec)
+                {
+                    return;
+                }
+
+                std::int64_t peers = 0;
+                for (std::uint32_t const id : ids)
+                {
+                    parcelset::endpoints_type const& endpoints =
+                        agas::resolve_locality(
+                            naming::get_gid_from_locality_id(id), ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+
+                    auto const it = endpoints.find(connection_handler_type());
+                    if (it == endpoints.end())
+                    {
+                        continue;
+                    }
+
+                    locality const& l = it->second.get<locality>();
+                    if (l.host() == host_ && l.pid() != process_id())
+                    {
+                        ++peers;
+                        get_inbox(l);
+                    }
+                }
+
+                expected_peers_.store(peers, std::memory_order_release);
+            }
+
+            // Remove the name of the inbox once all localities on this host
+            // have mapped it. Localities which can't map it (e.g. as they run
+            // in a different container) leave the name in place until this
+            // parcelport is destroyed.
+            void unlink_mapped_inbox() noexcept
+            {
+                if (inbox_unlinked_.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                std::int64_t const expected =
+                    expected_peers_.load(std::memory_order_acquire);
+                if (expected >= 0 &&
+                    static_cast<std::int64_t>(inbox_.num_peers()) >= expected)
+                {
+                    inbox_.unlink();
+                    inbox_unlinked_.store(true, std::memory_order_relaxed);
+                }
+            }
+
+            // Drain the inbox while the runtime is running, the thread goes
+            // to sleep if no messages have arrived for a while.
+            void io_service_work()
+            {
+                using clock = std::chrono::steady_clock;
+
+                auto last_message = clock::now();
+                std::size_t k = 0;
+                while (!stopped_.load(std::memory_order_acquire))
+                {
+                    unlink_mapped_inbox();
+
+                    if (receiver_.background_work())
+                    {
+                        last_message = clock::now();
+                        k = 0;
+                    }
+                    else if (clock::now() - last_message < spin_time_)
+                    {
+                        hpx::util::detail::yield_k(k++ % 16,
+                            "hpx::parcelset::policies::shm::parcelport::"
+                            "io_service_work");
+                    }
+                    else
+                    {
+                        inbox_.wait(std::chrono::milliseconds(10));
+                    }
+                }
+            }
+
+            std::atomic<bool> stopped_;
+            std::string host_;
+
+            ring_buffer inbox_;
+            receiver<parcelport> receiver_;
+
+            static constexpr std::chrono::milliseconds inbox_retry_delay{100};
+
+            hpx::spinlock inboxes_mtx_;
+            std::map<std::uint32_t, std::shared_ptr<ring_buffer>> inboxes_;
+            std::map<std::uint32_t, std::chrono::steady_clock::time_point>
+                failed_inboxes_;
+
+            // number of localities on this host which map the inbox of this
+            // locality (-1 while unknown)
+            std::atomic<std::int64_t> expected_peers_{-1};
+            std::atomic<bool> inbox_unlinked_{false};
+
+            std::size_t segment_threshold_;
+            std::chrono::microseconds spin_time_;
+            std::chrono::milliseconds send_timeout_;
+        };
+
+        bool background_receive(parcelset::parcelport* pp) noexcept
+        {
+            return static_cast<parcelport*>(pp)->background_receive();
+        }
+    }    // namespace policies::shm
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shm]
+//      ...
+//      priority = 2000
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shm::parcelport>
+{
+    // the priority is larger than the one of any other parcelport (even when
+    // selected by hpxrun.py) to prefer this parcelport for all localities
+    // running on the same host
+    static constexpr char const* priority() noexcept
+    {
+        return "2000";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return
+            // size of the inbox of each locality (in bytes)
+            "ring_size = ${HPX_PARCELPORT_SHM_RING_SIZE:4194304}\n"
+
+            // messages with more zero-copy data are sent through a separate
+            // shared memory segment (in bytes)
+            "segment_threshold = "
+            "${HPX_PARCELPORT_SHM_SEGMENT_THRESHOLD:65536}\n"
+
+            // time to poll for new messages before going to sleep (in
+            // microseconds)
+            "spin_time = ${HPX_PARCELPORT_SHM_SPIN_TIME:100}\n"
+
+            // time to wait for space in the inbox of a destination before
+            // the send operation fails (in milliseconds)
+            "send_timeout = ${HPX_PARCELPORT_SHM_SEND_TIMEOUT:10000}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shm::parcelport, shm)
+
+#endif
@@ -0,0 +1,292 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/assert.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include <signal.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shm {
+
+    // The control data is placed at the beginning of the segment, the
+    // records follow. The members written by the producers, the consumer, and
+    // the notification words live on separate cache lines.
+    struct ring_buffer::control_block
+    {
+        // "hpx-shm2"
+        static constexpr std::uint64_t magic_value = 0x6870782d73686d32;
+
+        std::atomic<std::uint64_t> magic;
+        std::uint64_t capacity;
+
+        // number of peers which have mapped the segment
+        std::atomic<std::uint32_t> peers;
+
+        // producer side, the producer lock holds the process id of its owner
+        // (or zero), reserved_head is protected by the producer lock
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint32_t> producer_lock;
+        std::uint64_t reserved_head;
+
+        // end of the published records
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> head;
+
+        // end of the consumed records
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> tail;
+
+        // notification of a sleeping consumer
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint32_t> doorbell;
+        std::atomic<std::uint32_t> sleeping;
+    };
+
+    namespace {
+
+        constexpr std::size_t min_capacity = 64 * 1024;
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }    // namespace
+
+    std::size_t ring_buffer::segment_size(std::size_t capacity) noexcept
+    {
+        return sizeof(control_block) +
+            next_power_of_two((std::max)(capacity, min_capacity));
+    }
+
+    ring_buffer::ring_buffer(
+        shared_memory_segment segment, bool initialize) noexcept
+      : segment_(HPX_MOVE(segment))
+      , pid_(static_cast<std::uint32_t>(::getpid()))
+    {
+        if (!segment_ || segment_.size() < segment_size(0))
+        {
+            return;
+        }
+
+        auto* base = static_cast<char*>(segment_.data());
+        if (initialize)
+        {
+            std::size_t const capacity =
+                segment_.size() - sizeof(control_block);
+            HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+            control_ = new (base) control_block;
+            control_->capacity = capacity;
+            control_->peers.store(0, std::memory_order_relaxed);
+            control_->producer_lock.store(0, std::memory_order_relaxed);
+            control_->reserved_head = 0;
+            control_->head.store(0, std::memory_order_relaxed);
+            control_->tail.store(0, std::memory_order_relaxed);
+            control_->doorbell.store(0, std::memory_order_relaxed);
+            control_->sleeping.store(0, std::memory_order_relaxed);
+
+            // the segment is ready for use as soon as the magic is visible
+            control_->magic.store(
+                control_block::magic_value, std::memory_order_release);
+        }
+        else
+        {
+            control_ = reinterpret_cast<control_block*>(base);
+            if (control_->magic.load(std::memory_order_acquire) !=
+                    control_block::magic_value ||
+                sizeof(control_block) + control_->capacity > segment_.size())
+            {
+                control_ = nullptr;
+                return;
+            }
+        }
+
+        data_ = base + sizeof(control_block);
+        capacity_ = static_cast<std::size_t>(control_->capacity);
+    }
+
+    bool ring_buffer::valid() const noexcept
+    {
+        return control_ != nullptr && capacity_ != 0;
+    }
+
+    std::size_t ring_buffer::max_record_size() const noexcept
+    {
+        // limiting the size of the records guarantees progress for all
+        // producers, even if padding is required
+        return capacity_ / 4 - sizeof(record_header);
+    }
+
+    char* ring_buffer::try_begin_write(
+        std::uint32_t kind, std::size_t size) noexcept
+    {
+        HPX_ASSERT(kind != padding_record);
+        HPX_ASSERT(size <= max_record_size());
+
+        std::uint32_t expected = 0;
+        if (control_->producer_lock.load(std::memory_order_relaxed) != 0 ||
+            !control_->producer_lock.compare_exchange_strong(
+                expected, pid_, std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        std::size_t const total = record_size(size);
+
+        std::uint64_t head = control_->head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            control_->tail.load(std::memory_order_acquire);
+
+        // records are never split, the remainder of the ring is skipped if
+        // necessary
+        std::size_t const contiguous = capacity_ - (head & (capacity_ - 1));
+        std::size_t const padding = contiguous < total ? contiguous : 0;
+
+        if (capacity_ - (head - tail) < padding + total)
+        {
+            control_->producer_lock.store(0, std::memory_order_release);
+            return nullptr;
+        }
+
+        if (padding != 0)
+        {
+            auto* pad = reinterpret_cast<record_header*>(at(head));
+            pad->size =
+                static_cast<std::uint32_t>(padding - sizeof(record_header));
+            pad->kind = padding_record;
+            head += padding;
+        }
+
+        auto* hdr = reinterpret_cast<record_header*>(at(head));
+        hdr->size = static_cast<std::uint32_t>(size);
+        hdr->kind = kind;
+
+        control_->reserved_head = head + total;
+        return reinterpret_cast<char*>(hdr + 1);
+    }
+
+    void ring_buffer::end_write() noexcept
+    {
+        // The store to head and the load of sleeping (and the corresponding
+        // operations in wait()) have to be sequentially consistent to not
+        // miss waking up the consumer.
+        control_->head.store(control_->reserved_head);
+        control_->producer_lock.store(0, std::memory_order_release);
+
+        if (control_->sleeping.load() != 0)
+        {
+            notify();
+        }
+    }
+
+    bool ring_buffer::break_stale_lock() noexcept
+    {
+        std::uint32_t owner =
+            control_->producer_lock.load(std::memory_order_relaxed);
+        if (owner == 0 || owner == pid_)
+        {
+            return false;
+        }
+
+        if (::kill(static_cast<pid_t>(owner), 0) == 0 || errno != ESRCH)
+        {
+            return false;
+        }
+
+        // The owner has died while writing a record. The head was either not
+        // published yet (the record is discarded) or it was published
+        // completely, the next producer starts from the published head.
+        return control_->producer_lock.compare_exchange_strong(
+            owner, 0, std::memory_order_acquire);
+    }
+
+    char const* ring_buffer::try_begin_read(
+        std::uint32_t& kind, std::size_t& size) noexcept
+    {
+        std::uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+        std::uint64_t const head =
+            control_->head.load(std::memory_order_acquire);
+
+        while (tail != head)
+        {
+            auto const* hdr = reinterpret_cast<record_header const*>(at(tail));
+            if (hdr->kind == padding_record)
+            {
+                tail += sizeof(record_header) + hdr->size;
+                control_->tail.store(tail, std::memory_order_release);
+                continue;
+            }
+
+            kind = hdr->kind;
+            size = hdr->size;
+            read_size_ = record_size(hdr->size);
+            return reinterpret_cast<char const*>(hdr + 1);
+        }
+        return nullptr;
+    }
+
+    void ring_buffer::end_read() noexcept
+    {
+        HPX_ASSERT(read_size_ != 0);
+        control_->tail.store(
+            control_->tail.load(std::memory_order_relaxed) + read_size_,
+            std::memory_order_release);
+        read_size_ = 0;
+    }
+
+    bool ring_buffer::empty() const noexcept
+    {
+        return control_->tail.load(std::memory_order_relaxed) ==
+            control_->head.load();
+    }
+
+    void ring_buffer::wait(std::chrono::microseconds timeout) noexcept
+    {
+        std::uint32_t const current =
+            control_->doorbell.load(std::memory_order_acquire);
+
+        control_->sleeping.store(1);
+        if (empty())
+        {
+            wait_on_address(control_->doorbell, current, timeout);
+        }
+        control_->sleeping.store(0, std::memory_order_relaxed);
+    }
+
+    void ring_buffer::attach() noexcept
+    {
+        control_->peers.fetch_add(1, std::memory_order_release);
+    }
+
+    std::uint32_t ring_buffer::num_peers() const noexcept
+    {
+        return control_->peers.load(std::memory_order_acquire);
+    }
+
+    void ring_buffer::notify() noexcept
+    {
+        control_->doorbell.fetch_add(1, std::memory_order_release);
+        wake_by_address(control_->doorbell);
+    }
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
@@ -0,0 +1,201 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/parcelport_shm/message.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/sender.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shm {
+
+    namespace {
+
+        std::atomic<std::uint64_t> segment_sequence(0);
+
+        std::string make_segment_name()
+        {
+            return "/hpx.shm." + std::to_string(::getpid()) + "." +
+                std::to_string(segment_sequence.fetch_add(
+                    1, std::memory_order_relaxed));
+        }
+
+        // interval of checking whether the producer lock of the destination
+        // is held by a process which has died
+        constexpr std::chrono::milliseconds stale_lock_check_interval{10};
+    }    // namespace
+
+    void sender::write_payload(char* dest) const noexcept
+    {
+        auto const& tchunks = buffer_.transmission_chunks_;
+
+        std::size_t const tchunks_size =
+            tchunks.size() * sizeof(transmission_chunk_type);
+        if (tchunks_size != 0)
+        {
+            std::memcpy(dest, tchunks.data(), tchunks_size);
+        }
+        dest += align_message(tchunks_size);
+
+        std::memcpy(dest, buffer_.data_.data(), buffer_.data_.size());
+        dest += align_message(buffer_.data_.size());
+
+        // now add the chunks themselves, those hold zero-copy serialized data
+        for (serialization::serialization_chunk const& c : buffer_.chunks_)
+        {
+            if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+            {
+                std::memcpy(dest, c.data_.cpos_, c.size_);
+                dest += align_message(c.size_);
+            }
+        }
+    }
+
+    char* sender::begin_write(message_kind kind, std::size_t size) noexcept
+    {
+        using clock = std::chrono::steady_clock;
+
+        auto const start = clock::now();
+        auto next_check = start + stale_lock_check_interval;
+
+        char* dest = nullptr;
+        hpx::util::yield_while(
+            [&]() {
+                dest = inbox_->try_begin_write(
+                    static_cast<std::uint32_t>(kind), size);
+                if (dest != nullptr)
+                {
+                    return false;
+                }
+
+                // Receive messages while waiting for the destination to make
+                // space, otherwise two localities sending to each other
+                // could block forever.
+                background_receive(pp_);
+
+                auto const now = clock::now();
+                if (now >= next_check)
+                {
+                    // The process holding the producer lock might have died,
+                    // the destination might not drain its inbox anymore.
+                    if (!inbox_->break_stale_lock() &&
+                        now - start >= send_timeout_)
+                    {
+                        return false;
+                    }
+                    next_check = now + stale_lock_check_interval;
+                }
+                return true;
+            },
+            "shm::sender::begin_write", false);
+        return dest;
+    }
+
+    std::error_code sender::send_timed_out() const
+    {
+        LPT_(error).format("shm::sender::write_message: timed out waiting for "
+                           "space in the inbox of locality {}",
+            there_);
+        return hpx::make_error_code(
+            hpx::error::network_error, throwmode::lightweight);
+    }
+
+    std::error_code sender::write_message()
+    {
+        auto const& tchunks = buffer_.transmission_chunks_;
+
+        std::size_t payload_size =
+            align_message(tchunks.size() * sizeof(transmission_chunk_type)) +
+            align_message(buffer_.data_.size());
+
+        std::size_t zero_copy_size = 0;
+        auto const num_zero_copy_chunks =
+            static_cast<std::size_t>(buffer_.num_chunks_.first);
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            zero_copy_size +=
+                align_message(static_cast<std::size_t>(tchunks[i].second));
+        }
+        payload_size += zero_copy_size;
+
+        message_header header{};
+        header.size = buffer_.size_;
+        header.data_size = buffer_.data_size_;
+        header.num_zero_copy_chunks = buffer_.num_chunks_.first;
+        header.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+        header.payload_size = payload_size;
+
+        std::size_t const inline_size = message_payload_offset + payload_size;
+        if (zero_copy_size <= segment_threshold_ &&
+            inline_size <= inbox_->max_record_size())
+        {
+            // copy the whole message into the inbox of the destination
+            char* dest = begin_write(message_kind::inline_message, inline_size);
+            if (dest == nullptr)
+            {
+                return send_timed_out();
+            }
+
+            std::memcpy(dest, &header, sizeof(header));
+            write_payload(dest + message_payload_offset);
+
+            inbox_->end_write();
+            return {};
+        }
+
+        // Place the payload into a new segment, the destination maps it and
+        // removes its name. The zero-copy chunks are referenced in place by
+        // the receiving end.
+        error_code ec(throwmode::lightweight);
+        shared_memory_segment segment = shared_memory_segment::create(
+            make_segment_name(), payload_size, ec);
+        if (ec)
+        {
+            LPT_(error).format(
+                "shm::sender::write_message: {}", ec.get_message());
+            return std::make_error_code(std::errc::not_enough_memory);
+        }
+
+        write_payload(static_cast<char*>(segment.data()));
+
+        std::string const& name = segment.name();
+        std::size_t const record_size =
+            message_payload_offset + name.size() + 1;
+
+        char* dest = begin_write(message_kind::segment_message, record_size);
+        if (dest == nullptr)
+        {
+            segment.unlink();
+            return send_timed_out();
+        }
+
+        std::memcpy(dest, &header, sizeof(header));
+        std::memcpy(
+            dest + message_payload_offset, name.c_str(), name.size() + 1);
+
+        inbox_->end_write();
+        return {};
+    }
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
@@ -0,0 +1,241 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace hpx::parcelset::policies::shm {
+
+    shared_memory_segment::shared_memory_segment(
+        std::string name, void* data, std::size_t size) noexcept
+      : name_(HPX_MOVE(name))
+      , data_(data)
+      , size_(size)
+    {
+    }
+
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(rhs.data_)
+      , size_(rhs.size_)
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        reset();
+    }
+
+    void shared_memory_segment::reset() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    shared_memory_segment shared_memory_segment::create(
+        std::string name, std::size_t size, error_code& ec)
+    {
+        // remove stale segments left behind by crashed processes
+        ::shm_unlink(name.c_str());
+
+        int const fd = ::shm_open(
+            name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not create shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return {};
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not resize shared memory segment {} to {} bytes: {}",
+                name, size, std::strerror(err));
+            return {};
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return {};
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return {HPX_MOVE(name), data, size};
+    }
+
+    shared_memory_segment shared_memory_segment::open(
+        std::string name, error_code& ec)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not open shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return {};
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1 || st.st_size == 0)
+        {
+            ::close(fd);
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not determine the size of shared memory segment {}",
+                name);
+            return {};
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return {};
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return {HPX_MOVE(name), data, size};
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    std::shared_ptr<void> shared_memory_segment::release_shared()
+    {
+        if (data_ == nullptr)
+        {
+            return {};
+        }
+
+        std::size_t const size = size_;
+        std::shared_ptr<void> result(
+            data_, [size](void* p) { ::munmap(p, size); });
+
+        data_ = nullptr;
+        size_ = 0;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void wait_on_address(std::atomic<std::uint32_t>& word,
+        std::uint32_t expected, std::chrono::microseconds timeout) noexcept
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+
+        // the word may be shared between processes, thus no FUTEX_PRIVATE_FLAG
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAIT, expected, &ts, nullptr, 0);
+#else
+        if (word.load(std::memory_order_acquire) == expected)
+        {
+            std::this_thread::sleep_for(
+                (std::min)(timeout, std::chrono::microseconds(100)));
+        }
+#endif
+    }
+
+    void wake_by_address(std::atomic<std::uint32_t>& word) noexcept
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+        HPX_UNUSED(word);
+#endif
+    }
+}    // namespace hpx::parcelset::policies::shm
+
+#endif
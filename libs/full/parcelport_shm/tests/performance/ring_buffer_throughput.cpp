@@ -0,0 +1,134 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the ring buffer used by the shared memory
+// parcelport for a given number of producer threads and record size.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using hpx::parcelset::policies::shm::ring_buffer;
+using hpx::parcelset::policies::shm::shared_memory_segment;
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    po::options_description desc("Usage: ring_buffer_throughput [options]");
+    // clang-format off
+    desc.add_options()
+        ("help", "print this help message")
+        ("producers", po::value<std::size_t>()->default_value(1),
+            "number of producer threads")
+        ("records", po::value<std::size_t>()->default_value(1000000),
+            "number of records sent by each producer")
+        ("record-size", po::value<std::size_t>()->default_value(256),
+            "payload size of each record (bytes)")
+        ("ring-size", po::value<std::size_t>()->default_value(4194304),
+            "capacity of the ring (bytes)");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    std::size_t const producers = vm["producers"].as<std::size_t>();
+    std::size_t const records = vm["records"].as<std::size_t>();
+
+    std::string const name =
+        "/hpx.shm.ring_buffer_throughput." + std::to_string(::getpid());
+
+    ring_buffer consumer(
+        shared_memory_segment::create(name,
+            ring_buffer::segment_size(vm["ring-size"].as<std::size_t>())),
+        true);
+    ring_buffer producer(shared_memory_segment::open(name), false);
+    consumer.unlink();
+
+    std::size_t const size = (std::max)(sizeof(std::uint64_t),
+        (std::min)(vm["record-size"].as<std::size_t>(),
+            producer.max_record_size()));
+
+    hpx::chrono::high_resolution_timer const timer;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != producers; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (std::uint64_t i = 0; i != records; ++i)
+            {
+                char* p = nullptr;
+                while ((p = producer.try_begin_write(1, size)) == nullptr)
+                {
+                    std::this_thread::yield();
+                }
+                std::memcpy(p, &i, sizeof(i));
+                producer.end_write();
+            }
+        });
+    }
+
+    std::uint64_t checksum = 0;
+    for (std::size_t received = 0; received != producers * records;)
+    {
+        std::uint32_t kind = 0;
+        std::size_t record_size = 0;
+        char const* p = consumer.try_begin_read(kind, record_size);
+        if (p == nullptr)
+        {
+            consumer.wait(std::chrono::microseconds(100));
+            continue;
+        }
+
+        std::uint64_t value = 0;
+        std::memcpy(&value, p, sizeof(value));
+        checksum += value;
+
+        consumer.end_read();
+        ++received;
+    }
+
+    double const elapsed = timer.elapsed();
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    double const total = static_cast<double>(producers * records);
+    std::cout << "producers: " << producers << ", record size: " << size
+              << " [bytes], elapsed: " << elapsed
+              << " [s], rate: " << total / elapsed * 1e-6
+              << " [Mrecords/s], bandwidth: "
+              << total * static_cast<double>(size) / elapsed * 1e-9
+              << " [GB/s] (checksum: " << checksum << ")" << std::endl;
+
+    return 0;
+}
+#endif
@@ -0,0 +1,328 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using hpx::parcelset::policies::shm::ring_buffer;
+using hpx::parcelset::policies::shm::shared_memory_segment;
+
+std::string const segment_name =
+    "/hpx.shm.test_ring_buffer." + std::to_string(::getpid());
+
+// The consumer creates the segment, the producer maps it separately (as a
+// different process would).
+struct test_ring
+{
+    test_ring()
+      : consumer(shared_memory_segment::create(
+                     segment_name, ring_buffer::segment_size(0)),
+            true)
+      , producer(shared_memory_segment::open(segment_name), false)
+    {
+        consumer.unlink();
+    }
+
+    ring_buffer consumer;
+    ring_buffer producer;
+};
+
+void write_record(ring_buffer& ring, std::uint32_t kind, std::size_t size,
+    std::uint64_t value)
+{
+    char* p = ring.try_begin_write(kind, size);
+    HPX_TEST(p != nullptr);
+    if (p != nullptr)
+    {
+        std::memset(p, static_cast<int>(value & 0xff), size);
+        std::memcpy(p, &value, sizeof(value));
+        ring.end_write();
+    }
+}
+
+void read_record(ring_buffer& ring, std::uint32_t expected_kind,
+    std::size_t expected_size, std::uint64_t expected_value)
+{
+    std::uint32_t kind = 0;
+    std::size_t size = 0;
+    char const* p = ring.try_begin_read(kind, size);
+    HPX_TEST(p != nullptr);
+    if (p != nullptr)
+    {
+        HPX_TEST_EQ(kind, expected_kind);
+        HPX_TEST_EQ(size, expected_size);
+
+        std::uint64_t value = 0;
+        std::memcpy(&value, p, sizeof(value));
+        HPX_TEST_EQ(value, expected_value);
+        HPX_TEST_EQ(static_cast<unsigned char>(p[size - 1]),
+            static_cast<unsigned char>(expected_value & 0xff));
+
+        ring.end_read();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_attach()
+{
+    test_ring r;
+    HPX_TEST(r.consumer.valid());
+    HPX_TEST(r.producer.valid());
+    HPX_TEST_EQ(r.consumer.capacity(), r.producer.capacity());
+    HPX_TEST_EQ(r.consumer.capacity() & (r.consumer.capacity() - 1),
+        std::size_t(0));
+    HPX_TEST(r.consumer.empty());
+
+    std::uint32_t kind = 0;
+    std::size_t size = 0;
+    HPX_TEST(r.consumer.try_begin_read(kind, size) == nullptr);
+}
+
+// records not fitting in front of the end of the ring are preceded by a
+// padding record and are placed at the start of the ring
+void test_wraparound()
+{
+    test_ring r;
+
+    // a record size which does not evenly divide the capacity
+    std::size_t const size = 1000;
+    std::size_t const count = 10 * r.consumer.capacity() / size;
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        write_record(r.producer, 1, size, i);
+        read_record(r.consumer, 1, size, i);
+    }
+    HPX_TEST(r.consumer.empty());
+
+    // the same with several records being in flight
+    for (std::uint64_t i = 0; i < count; i += 3)
+    {
+        write_record(r.producer, 2, size + 8, i);
+        write_record(r.producer, 2, size + 8, i + 1);
+        write_record(r.producer, 2, size + 8, i + 2);
+
+        read_record(r.consumer, 2, size + 8, i);
+        read_record(r.consumer, 2, size + 8, i + 1);
+        read_record(r.consumer, 2, size + 8, i + 2);
+    }
+    HPX_TEST(r.consumer.empty());
+}
+
+// producers are rejected while the ring is full and can continue once the
+// consumer has released space
+void test_back_pressure()
+{
+    test_ring r;
+
+    std::size_t const size = r.producer.max_record_size();
+
+    std::uint64_t written = 0;
+    while (char* p = r.producer.try_begin_write(1, size))
+    {
+        std::memset(p, static_cast<int>(written & 0xff), size);
+        std::memcpy(p, &written, sizeof(written));
+        r.producer.end_write();
+        ++written;
+    }
+
+    // four records of the maximal size fit into the ring
+    HPX_TEST_EQ(written, std::uint64_t(4));
+    HPX_TEST(r.producer.try_begin_write(1, 16) == nullptr);
+
+    // releasing one record makes room for exactly one more
+    read_record(r.consumer, 1, size, 0);
+    write_record(r.producer, 1, size, 0x100);
+    HPX_TEST(r.producer.try_begin_write(1, size) == nullptr);
+
+    for (std::uint64_t i = 1; i != written; ++i)
+    {
+        read_record(r.consumer, 1, size, i);
+    }
+    read_record(r.consumer, 1, size, 0x100);
+    HPX_TEST(r.consumer.empty());
+}
+
+// only one producer may write at any point in time
+void test_producer_lock()
+{
+    test_ring r;
+
+    char* p = r.producer.try_begin_write(1, 64);
+    HPX_TEST(p != nullptr);
+    HPX_TEST(r.consumer.try_begin_write(1, 64) == nullptr);
+
+    // the record is not visible before it was published
+    HPX_TEST(r.consumer.empty());
+
+    r.producer.end_write();
+    HPX_TEST(!r.consumer.empty());
+
+    write_record(r.consumer, 1, 64, 1);
+}
+
+// a producer lock left behind by a process which has died can be broken, a
+// lock held by a live process can't
+void test_stale_producer_lock()
+{
+    std::string const name = segment_name + ".stale";
+    ring_buffer consumer(
+        shared_memory_segment::create(name, ring_buffer::segment_size(0)),
+        true);
+
+    HPX_TEST(!consumer.break_stale_lock());
+
+    pid_t const child = ::fork();
+    if (child == 0)
+    {
+        // take the lock and die while holding it
+        ring_buffer producer(shared_memory_segment::open(name), false);
+        ::_exit(producer.try_begin_write(1, 64) != nullptr ? 0 : 1);
+    }
+
+    HPX_TEST(child > 0);
+    int status = 0;
+    HPX_TEST_EQ(::waitpid(child, &status, 0), child);
+    HPX_TEST(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    consumer.unlink();
+
+    // the record being written by the child was never published
+    HPX_TEST(consumer.try_begin_write(1, 64) == nullptr);
+    HPX_TEST(consumer.empty());
+
+    HPX_TEST(consumer.break_stale_lock());
+    HPX_TEST(!consumer.break_stale_lock());
+
+    write_record(consumer, 1, 64, 1);
+    read_record(consumer, 1, 64, 1);
+    HPX_TEST(consumer.empty());
+
+    // the lock held by this process is not broken
+    char* p = consumer.try_begin_write(1, 64);
+    HPX_TEST(p != nullptr);
+    HPX_TEST(!consumer.break_stale_lock());
+    consumer.end_write();
+}
+
+// peers announce having mapped the segment
+void test_peers()
+{
+    test_ring r;
+    HPX_TEST_EQ(r.consumer.num_peers(), std::uint32_t(0));
+
+    r.producer.attach();
+    HPX_TEST_EQ(r.consumer.num_peers(), std::uint32_t(1));
+    HPX_TEST_EQ(r.producer.num_peers(), std::uint32_t(1));
+}
+
+// concurrent producers, each producer's records are received in order
+void test_concurrent_producers()
+{
+    test_ring r;
+
+    constexpr std::uint32_t num_producers = 4;
+    constexpr std::uint64_t num_records = 10000;
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t t = 0; t != num_producers; ++t)
+    {
+        producers.emplace_back([&r, t]() {
+            for (std::uint64_t i = 0; i != num_records; ++i)
+            {
+                std::size_t const size = 8 + (i % 200);
+
+                char* p = nullptr;
+                while ((p = r.producer.try_begin_write(t + 1, size)) == nullptr)
+                {
+                    std::this_thread::yield();
+                }
+                std::memcpy(p, &i, sizeof(i));
+                r.producer.end_write();
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> expected(num_producers, 0);
+    std::uint64_t received = 0;
+    while (received != num_producers * num_records)
+    {
+        std::uint32_t kind = 0;
+        std::size_t size = 0;
+        char const* p = r.consumer.try_begin_read(kind, size);
+        if (p == nullptr)
+        {
+            r.consumer.wait(std::chrono::microseconds(1000));
+            continue;
+        }
+
+        HPX_TEST(kind >= 1 && kind <= num_producers);
+        if (kind >= 1 && kind <= num_producers)
+        {
+            std::uint64_t value = 0;
+            std::memcpy(&value, p, sizeof(value));
+            HPX_TEST_EQ(value, expected[kind - 1]);
+            HPX_TEST_EQ(size, std::size_t(8 + (value % 200)));
+            ++expected[kind - 1];
+        }
+
+        r.consumer.end_read();
+        ++received;
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+    HPX_TEST(r.consumer.empty());
+}
+
+// waiting on an empty ring times out
+void test_wait_timeout()
+{
+    test_ring r;
+
+    auto const start = std::chrono::steady_clock::now();
+    r.consumer.wait(std::chrono::microseconds(10000));
+    HPX_TEST(std::chrono::steady_clock::now() - start <
+        std::chrono::seconds(5));
+
+    // waiting on a non-empty ring returns right away
+    write_record(r.producer, 1, 16, 1);
+    r.consumer.wait(std::chrono::seconds(5));
+    read_record(r.consumer, 1, 16, 1);
+}
+
+int main()
+{
+    test_attach();
+    test_wraparound();
+    test_back_pressure();
+    test_producer_lock();
+    test_stale_producer_lock();
+    test_peers();
+    test_concurrent_producers();
+    test_wait_timeout();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,134 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shm/ring_buffer.hpp>
+#include <hpx/parcelport_shm/shared_memory_segment.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <unistd.h>
+
+using hpx::parcelset::policies::shm::ring_buffer;
+using hpx::parcelset::policies::shm::shared_memory_segment;
+
+std::string const segment_name =
+    "/hpx.shm.test_segment." + std::to_string(::getpid());
+
+///////////////////////////////////////////////////////////////////////////////
+void test_create_open()
+{
+    hpx::error_code ec(hpx::throwmode::lightweight);
+
+    shared_memory_segment created =
+        shared_memory_segment::create(segment_name, 4096, ec);
+    HPX_TEST(!ec);
+    HPX_TEST(created);
+    HPX_TEST_EQ(created.size(), std::size_t(4096));
+    HPX_TEST_EQ(created.name(), segment_name);
+
+    std::strcpy(static_cast<char*>(created.data()), "hello");
+
+    // a second mapping of the same segment sees the same memory
+    shared_memory_segment opened =
+        shared_memory_segment::open(segment_name, ec);
+    HPX_TEST(!ec);
+    HPX_TEST(opened);
+    HPX_TEST_EQ(opened.size(), std::size_t(4096));
+    HPX_TEST_EQ(std::string(static_cast<char const*>(opened.data())),
+        std::string("hello"));
+
+    // once the name is removed the segment can't be opened anymore, existing
+    // mappings stay valid
+    created.unlink();
+
+    shared_memory_segment missing =
+        shared_memory_segment::open(segment_name, ec);
+    HPX_TEST(ec);
+    HPX_TEST(!missing);
+
+    static_cast<char*>(created.data())[0] = 'j';
+    HPX_TEST_EQ(std::string(static_cast<char const*>(opened.data())),
+        std::string("jello"));
+}
+
+// a stale segment with the same name is replaced
+void test_create_stale()
+{
+    hpx::error_code ec(hpx::throwmode::lightweight);
+
+    shared_memory_segment stale =
+        shared_memory_segment::create(segment_name, 4096, ec);
+    HPX_TEST(!ec);
+
+    shared_memory_segment created =
+        shared_memory_segment::create(segment_name, 8192, ec);
+    HPX_TEST(!ec);
+    HPX_TEST(created);
+
+    shared_memory_segment opened =
+        shared_memory_segment::open(segment_name, ec);
+    HPX_TEST(!ec);
+    HPX_TEST_EQ(opened.size(), std::size_t(8192));
+
+    created.unlink();
+}
+
+void test_move_release()
+{
+    hpx::error_code ec(hpx::throwmode::lightweight);
+
+    shared_memory_segment created =
+        shared_memory_segment::create(segment_name, 4096, ec);
+    HPX_TEST(!ec);
+    created.unlink();
+
+    void* data = created.data();
+
+    shared_memory_segment moved(std::move(created));
+    HPX_TEST(!created);    //-V1001
+    HPX_TEST(moved);
+    HPX_TEST_EQ(moved.data(), data);
+
+    std::shared_ptr<void> p = moved.release_shared();
+    HPX_TEST(!moved);
+    HPX_TEST_EQ(p.get(), data);
+}
+
+// a ring can't be attached to a segment which was not initialized
+void test_uninitialized_ring()
+{
+    hpx::error_code ec(hpx::throwmode::lightweight);
+
+    shared_memory_segment created = shared_memory_segment::create(
+        segment_name, ring_buffer::segment_size(0), ec);
+    HPX_TEST(!ec);
+    created.unlink();
+
+    ring_buffer ring(std::move(created), false);
+    HPX_TEST(!ring.valid());
+
+    ring_buffer empty(shared_memory_segment(), true);
+    HPX_TEST(!empty.valid());
+}
+
+int main()
+{
+    test_create_open();
+    test_create_stale();
+    test_move_release();
+    test_uninitialized_ring();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -406,6 +406,16 @@ namespace hpx::parcelset::policies::tcp {
                     // decode and handle received data
                     HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                         !parcelport_.allow_zero_copy_receive_optimizations());
+
+                    // hand over the received zero-copy chunks, this allows for
+                    // the de-serialized data to reference them in place
+                    if (!chunk_buffers_.empty())
+                    {
+                        buffer_.chunks_owner_ =
+                            std::make_shared<std::vector<std::vector<char>>>(
+                                HPX_MOVE(chunk_buffers_));
+                        chunk_buffers_.clear();
+                    }
                     handle_received_parcels(
                         decode_parcels(parcelport_, HPX_MOVE(buffer_)));
                 }
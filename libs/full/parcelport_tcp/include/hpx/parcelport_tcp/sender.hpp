@@ -59,14 +59,11 @@ namespace hpx::parcelset::policies::tcp {
     public:
         // Construct a sending parcelport_connection with the given io_context.
         sender(asio::io_context& io_service,
-            parcelset::locality const& locality_id,
-            [[maybe_unused]] parcelset::parcelport* pp)
+            parcelset::locality const& locality_id, parcelset::parcelport* pp)
           : socket_(io_service)
           , ack_(false)
           , there_(locality_id)
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
-#endif
         {
         }
 
@@ -259,7 +256,8 @@ namespace hpx::parcelset::policies::tcp {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
-            buffer_.clear();
+            // keep the allocated memory for encoding the next message
+            buffer_.clear(pp_->get_max_retained_buffer_size());
 
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
@@ -279,10 +277,11 @@ namespace hpx::parcelset::policies::tcp {
         // the other (receiving) end of this connection
         parcelset::locality there_;
 
+        parcelset::parcelport* pp_;
+
         // Counters and their data containers.
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         hpx::chrono::high_resolution_timer timer_;
-        parcelset::parcelport* pp_;
 #endif
 
         postprocess_handler_type handler_;
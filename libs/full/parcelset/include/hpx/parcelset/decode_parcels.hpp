@@ -16,6 +16,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
+#include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
@@ -315,6 +316,18 @@ namespace hpx::parcelset {
                     bool const migrated =
                         p.load_schedule(archive, num_thread, deferred_schedule);
 
+                    if (threads::tracing::enabled())
+                    {
+                        hpx::id_type const source = p.source_id();
+                        threads::tracing::record(
+                            threads::tracing::event_type::parcel_receive,
+                            reinterpret_cast<void const*>(
+                                p.parcel_id().get_lsb()),
+                            p.get_action_name(),
+                            source ? naming::get_locality_id_from_id(source) :
+                                     naming::invalid_locality_id);
+                    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                     std::int64_t const add_parcel_time =
                         timer.elapsed_nanoseconds();
@@ -426,6 +439,15 @@ namespace hpx::parcelset {
         serialization::input_archive archive(
             buffer.data_, inbound_data_size, &chunks);
 
+        // allow for the de-serialized data to adopt the zero-copy chunks if
+        // the parcelport has handed over their ownership
+        if (buffer.chunks_owner_)
+        {
+            archive
+                .get_extra_data<serialization::detail::zero_copy_chunks_owner>()
+                .owner_ = buffer.chunks_owner_;
+        }
+
         return decode_message_with_chunks(
             archive, pp, buffer, parcel_count, num_thread);
     }
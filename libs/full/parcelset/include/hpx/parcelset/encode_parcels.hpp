@@ -146,6 +146,21 @@ namespace hpx::parcelset {
                 }
             }
         }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // number of bytes allocated if the capacity of the container changed
+        template <typename Container>
+        std::int64_t allocated_bytes(
+            Container const& c, std::size_t capacity) noexcept
+        {
+            if (c.capacity() == capacity)
+            {
+                return 0;
+            }
+            return static_cast<std::int64_t>(
+                c.capacity() * sizeof(typename Container::value_type));
+        }
+#endif
     }    // namespace detail
 
     template <typename Buffer>
@@ -155,6 +170,17 @@ namespace hpx::parcelset {
     {
         HPX_ASSERT(buffer.data_.empty());
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // the buffers may be reused, only count actual (re-)allocations
+        hpx::chrono::high_resolution_timer const encode_timer;
+        std::size_t const data_capacity = buffer.data_.capacity();
+        std::size_t const chunks_capacity = buffer.chunks_.capacity();
+        std::size_t const transmission_chunks_capacity =
+            buffer.transmission_chunks_.capacity();
+#endif
+
+        detail::encode_size_cache& size_cache = pp.get_encode_size_cache();
+
         // collect argument sizes from parcels
         std::size_t arg_size = 0;
         std::size_t parcels_sent = 0;
@@ -182,18 +208,30 @@ namespace hpx::parcelset {
                             serialization::archive_flags::enable_compression);
                 }
 
-                // preallocate data
+                // preallocate data, prefer the sizes observed while encoding
+                // earlier parcels for the same action over the estimate
+                // calculated while preprocessing the parcel
                 std::size_t num_chunks = 0;
                 for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                 {
                     if (arg_size >= max_outbound_size)
                         break;
-                    arg_size += ps[parcels_sent].size();
-                    num_chunks += ps[parcels_sent].num_chunks();
+
+                    parcel const& p = ps[parcels_sent];
+                    arg_size +=
+                        size_cache.estimate(p.get_action_name(), p.size());
+                    num_chunks += p.num_chunks();
                 }
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                hpx::chrono::high_resolution_timer const allocate_timer;
+#endif
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                buffer.data_point_.buffer_allocate_time_ =
+                    allocate_timer.elapsed_nanoseconds();
+#endif
 
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
@@ -215,9 +253,9 @@ namespace hpx::parcelset {
 
                     for (std::size_t i = 0; i != parcels_sent; ++i)
                     {
+                        std::size_t const archive_pos = archive.current_pos();
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        std::size_t const archive_pos = archive.current_pos();
                         std::int64_t const serialize_time =
                             timer.elapsed_nanoseconds();
 #endif
@@ -233,11 +271,15 @@ namespace hpx::parcelset {
 
                         archive << ps[i];
 
+                        std::size_t const parcel_size =
+                            archive.current_pos() - archive_pos;
+                        size_cache.update(
+                            ps[i].get_action_name(), parcel_size);
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         parcelset::data_point action_data;
-                        action_data.bytes_ =
-                            archive.current_pos() - archive_pos;
+                        action_data.bytes_ = parcel_size;
                         action_data.serialization_time_ =
                             timer.elapsed_nanoseconds() - serialize_time;
                         action_data.num_parcels_ = 1;
@@ -297,6 +339,16 @@ namespace hpx::parcelset {
 #endif
         detail::encode_finalize(buffer, arg_size);
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        parcelset::data_point& data = buffer.data_point_;
+        data.encode_time_ = encode_timer.elapsed_nanoseconds();
+        data.buffer_bytes_allocated_ =
+            detail::allocated_bytes(buffer.data_, data_capacity) +
+            detail::allocated_bytes(buffer.chunks_, chunks_capacity) +
+            detail::allocated_bytes(
+                buffer.transmission_chunks_, transmission_chunks_capacity);
+#endif
+
         return parcels_sent;
     }
 }    // namespace hpx::parcelset
@@ -15,6 +15,7 @@
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -66,6 +67,7 @@ namespace hpx::parcelset {
             data_.clear();
             chunks_.clear();
             transmission_chunks_.clear();
+            chunks_owner_.reset();
             num_chunks_ = count_chunks_type(0, 0);
             size_ = 0;
             data_size_ = 0;
@@ -75,11 +77,30 @@ namespace hpx::parcelset {
 #endif
         }
 
+        // Reset the buffer for reuse. The allocated memory is retained for
+        // encoding subsequent messages unless it exceeds the given capacity.
+        void clear(std::size_t max_retained_capacity)
+        {
+            clear();
+            if (data_.capacity() > max_retained_capacity)
+            {
+                BufferType(data_.get_allocator()).swap(data_);
+            }
+            if (chunks_.capacity() * sizeof(ChunkType) > max_retained_capacity)
+            {
+                std::vector<ChunkType>().swap(chunks_);
+            }
+        }
+
         BufferType data_;
 
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
+        // optional owner of the memory the (received) zero-copy chunks refer
+        // to, allows for the de-serialized data to adopt those chunks
+        std::shared_ptr<void> chunks_owner_;
+
         // pair of (zero-copy, non-zero-copy) chunks
         count_chunks_type num_chunks_;
 
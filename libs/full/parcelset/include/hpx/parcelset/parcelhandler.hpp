@@ -316,6 +316,16 @@ namespace hpx::parcelset {
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // the total time it took for encoding parcels into message buffers
+        // (nanoseconds)
+        std::int64_t get_encode_time_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // total number of bytes allocated for message buffers while encoding
+        // parcels (bytes)
+        std::int64_t get_buffer_bytes_allocated_sent(
+            std::string const& pp_type, bool reset) const;
+
         // total zero-copy chunks sent
         std::int64_t get_zchunks_send_count(
             std::string const& pp_type, bool reset) const;
@@ -347,6 +357,18 @@ namespace hpx::parcelset {
         // the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(
             std::string const& pp_type, bool reset) const;
+
+        // number of parcels held back for aggregation
+        std::int64_t get_aggregated_parcels_count(
+            std::string const& pp_type, bool reset) const;
+
+        // number of batches of aggregated parcels released for sending
+        std::int64_t get_aggregation_batches_count(
+            std::string const& pp_type, bool reset) const;
+
+        // the maximum number of parcels in one batch of aggregated parcels
+        std::int64_t get_aggregation_batch_size_max(
+            std::string const& pp_type, bool reset) const;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -13,6 +13,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/actions_base/actions_base_fwd.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -22,6 +23,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/util/from_string.hpp>
@@ -216,6 +218,9 @@ namespace hpx::parcelset {
 
         void flush_parcels() override
         {
+            // don't hold back any parcels anymore
+            expire_aggregation();
+
             // We suspend our thread, which will make progress on the network
             hpx::execution_base::this_thread::yield(
                 "parcelport_impl::flush_parcels");
@@ -262,8 +267,19 @@ namespace hpx::parcelset {
             // of the 'this' pointer.
             detail::parcel_await_apply(HPX_MOVE(p), HPX_MOVE(f), archive_flags_,
                 [this, dest](parcel&& p, write_handler_type&& f) {
-                    if (connection_handler_traits<
-                            ConnectionHandler>::send_immediate_parcels::value &&
+                    if (can_aggregate(p))
+                    {
+                        // hold back the parcel to send it together with
+                        // other parcels to the same destination
+                        if (enqueue_parcel(
+                                dest, HPX_MOVE(p), HPX_MOVE(f), true))
+                        {
+                            get_connection_and_send_parcels(dest);
+                        }
+                    }
+                    else if (connection_handler_traits<
+                                 ConnectionHandler>::send_immediate_parcels::
+                                 value &&
                         can_send_immediate_impl())
                     {
                         send_immediate_impl(dest, &f, &p, 1);
@@ -304,8 +320,17 @@ namespace hpx::parcelset {
                 archive_flags_,
                 [this, dest](std::vector<parcel>&& parcels,
                     std::vector<write_handler_type>&& handlers) {
-                    if (connection_handler_traits<
-                            ConnectionHandler>::send_immediate_parcels::value &&
+                    if (can_aggregate(parcels))
+                    {
+                        if (enqueue_parcels(dest, HPX_MOVE(parcels),
+                                HPX_MOVE(handlers), true))
+                        {
+                            get_connection_and_send_parcels(dest);
+                        }
+                    }
+                    else if (connection_handler_traits<
+                                 ConnectionHandler>::send_immediate_parcels::
+                                 value &&
                         can_send_immediate_impl())
                     {
                         send_immediate_impl(dest, handlers.data(),
@@ -506,6 +531,41 @@ namespace hpx::parcelset {
             }
         }
 
+        // Parcels may be held back for aggregation only if this is enabled
+        // and if they neither carry a direct action nor an action with
+        // elevated priority, as the sender is likely to wait for those.
+        bool can_aggregate(parcel const& p) const noexcept
+        {
+            if (aggregation_latency_ == 0 ||
+                p.get_action_type() ==
+                    static_cast<int>(actions::action_flavor::direct_action))
+            {
+                return false;
+            }
+
+            threads::thread_priority const priority = p.get_thread_priority();
+            return priority == threads::thread_priority::default_ ||
+                priority == threads::thread_priority::normal ||
+                priority == threads::thread_priority::low;
+        }
+
+        bool can_aggregate(std::vector<parcel> const& parcels) const noexcept
+        {
+            if (aggregation_latency_ == 0)
+            {
+                return false;
+            }
+
+            for (parcel const& p : parcels)
+            {
+                if (!can_aggregate(p))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
     protected:
         void send_immediate_impl_connectionless(locality const& dest_,
             write_handler_type* fs, parcel* ps, std::size_t num_parcels)
@@ -704,8 +764,10 @@ namespace hpx::parcelset {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(
-            locality const& locality_id, parcel&& p, write_handler_type&& f)
+        // Returns whether the parcels queued for the destination should be
+        // sent right away (false if they are held back for aggregation).
+        bool enqueue_parcel(locality const& locality_id, parcel&& p,
+            write_handler_type&& f, bool aggregate = false)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
@@ -722,11 +784,16 @@ namespace hpx::parcelset {
             {
                 --num_parcel_destinations_;
             }
+
+            return update_aggregation(
+                locality_id, hpx::get<0>(e).size(), 1, aggregate);
         }
 
-        void enqueue_parcels(locality const& locality_id,
+        // Returns whether the parcels queued for the destination should be
+        // sent right away (false if they are held back for aggregation).
+        bool enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
+            std::vector<write_handler_type>&& handlers, bool aggregate = false)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
@@ -735,6 +802,7 @@ namespace hpx::parcelset {
             [[maybe_unused]] util::ignore_while_checking il(&l);
 
             HPX_ASSERT(parcels.size() == handlers.size());
+            std::size_t const num_added = parcels.size();
 
             mapped_type& e = pending_parcels_[locality_id];
             if (hpx::get<0>(e).empty())
@@ -762,6 +830,9 @@ namespace hpx::parcelset {
             {
                 --num_parcel_destinations_;
             }
+
+            return update_aggregation(
+                locality_id, hpx::get<0>(e).size(), num_added, aggregate);
         }
 
         bool dequeue_parcels(locality const& locality_id,
@@ -796,6 +867,7 @@ namespace hpx::parcelset {
             }
 
             parcel_destinations_.erase(locality_id);
+            release_aggregation(locality_id, parcels.size());
 
             HPX_ASSERT(
                 0 != num_parcel_destinations_.load(std::memory_order_relaxed));
@@ -804,6 +876,17 @@ namespace hpx::parcelset {
             return true;
         }
 
+        // Assumes that mtx_ is locked.
+        bool is_aggregation_expired(
+            locality const& locality_id, std::uint64_t now) const noexcept
+        {
+            auto const it = pending_parcels_.find(locality_id);
+            std::size_t const num_queued = it != pending_parcels_.end() ?
+                hpx::get<0>(it->second).size() :
+                0;
+            return aggregation_expired(locality_id, num_queued, now);
+        }
+
     protected:
         bool dequeue_parcel(
             locality& dest, parcel& p, write_handler_type& handler)
@@ -827,6 +910,7 @@ namespace hpx::parcelset {
                     if (parcels.empty())
                     {
                         pending_parcels_.erase(dest);
+                        release_aggregation(dest, 1);
                     }
                     return true;
                 }
@@ -849,9 +933,21 @@ namespace hpx::parcelset {
                 if (parcel_destinations_.empty())
                     return true;
 
+                // parcels held back for aggregation are sent once their
+                // latency budget has expired
+                std::uint64_t now = 0;
+                if (!aggregation_deadlines_.empty())
+                {
+                    now = hpx::chrono::high_resolution_clock::now();
+                }
+
                 destinations.reserve(parcel_destinations_.size());
                 for (locality const& loc : parcel_destinations_)
                 {
+                    if (now != 0 && !is_aggregation_expired(loc, now))
+                    {
+                        continue;
+                    }
                     destinations.push_back(loc);
                 }
             }
@@ -945,6 +1041,15 @@ namespace hpx::parcelset {
                 {
                     return;
                 }
+
+                // leave parcels held back for aggregation to the background
+                // work
+                if (!aggregation_deadlines_.empty() &&
+                    !is_aggregation_expired(locality_id,
+                        hpx::chrono::high_resolution_clock::now()))
+                {
+                    return;
+                }
             }
 
             // Create a new HPX thread which sends parcels that are still
@@ -635,6 +635,13 @@ namespace hpx::parcelset {
         // properly initialize parcel
         init_parcel(p);
 
+        if (threads::tracing::enabled())
+        {
+            threads::tracing::record(threads::tracing::event_type::parcel_send,
+                reinterpret_cast<void const*>(p.parcel_id().get_lsb()),
+                p.get_action_name(), p.destination_locality_id());
+        }
+
         bool resolved_locally = true;
 
         if (!addr)
@@ -1191,6 +1198,26 @@ namespace hpx::parcelset {
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    // the total time it took for encoding parcels into message buffers
+    // (nanoseconds)
+    std::int64_t parcelhandler::get_encode_time_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_encode_time_sent(reset) : 0;
+    }
+
+    // total number of bytes allocated for message buffers while encoding
+    // parcels (bytes)
+    std::int64_t parcelhandler::get_buffer_bytes_allocated_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_bytes_allocated_sent(reset) : 0;
+    }
+
     // total zero-copy chunks sent
     std::int64_t parcelhandler::get_zchunks_send_count(
         std::string const& pp_type, bool reset) const
@@ -1263,6 +1290,33 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // number of parcels held back for aggregation
+    std::int64_t parcelhandler::get_aggregated_parcels_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_aggregated_parcels_count(reset) : 0;
+    }
+
+    // number of batches of aggregated parcels released for sending
+    std::int64_t parcelhandler::get_aggregation_batches_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_aggregation_batches_count(reset) : 0;
+    }
+
+    // the maximum number of parcels in one batch of aggregated parcels
+    std::int64_t parcelhandler::get_aggregation_batch_size_max(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_aggregation_batch_size_max(reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -1397,6 +1451,13 @@ namespace hpx::parcelset {
             "max_outbound_message_size = "
             "${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE) "}");
+        ini_defs.emplace_back("max_retained_buffer_size = "
+                              "${HPX_PARCEL_MAX_RETAINED_BUFFER_SIZE:"
+                              "$[hpx.parcel.max_outbound_message_size]}");
+        ini_defs.emplace_back(
+            "aggregation_latency = ${HPX_PARCEL_AGGREGATION_LATENCY:0}");
+        ini_defs.emplace_back("aggregation_max_parcels = "
+                              "${HPX_PARCEL_AGGREGATION_MAX_PARCELS:64}");
         ini_defs.emplace_back(endian::native == endian::big ?
                 "endian_out = ${HPX_PARCEL_ENDIAN_OUT:big}" :
                 "endian_out = ${HPX_PARCEL_ENDIAN_OUT:little}");
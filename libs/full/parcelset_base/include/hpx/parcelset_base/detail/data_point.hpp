@@ -35,6 +35,12 @@ namespace hpx::parcelset {
         /// The time spent for allocating buffers
         std::int64_t buffer_allocate_time_ = 0;
 
+        /// The time spent for encoding the parcels into the message buffers
+        std::int64_t encode_time_ = 0;
+
+        /// The number of bytes (re-)allocated for the message buffers
+        std::int64_t buffer_bytes_allocated_ = 0;
+
         //// number of zero-copy chunks in total
         std::int64_t num_zchunks_ = 0;
 
@@ -0,0 +1,66 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::parcelset::detail {
+
+    // Per-action sizes of encoded parcels as observed by the parcelport.
+    //
+    // The size of a parcel is estimated before it is encoded (see
+    // parcel::size()). This estimate does not know about the settings of the
+    // parcelport (zero-copy threshold, array optimizations), so encode_parcels
+    // records the number of bytes each action actually occupied in the
+    // message buffer and uses those for preallocating the buffers instead.
+    //
+    // For each action a decaying high-water mark is kept, i.e. the estimate
+    // follows growing sizes immediately and shrinks slowly, which avoids
+    // re-growing the buffers for streams of similarly sized parcels.
+    //
+    // The sizes are kept in a fixed size, lock-free hash table (using linear
+    // probing) as this is accessed for every encoded parcel. Actions that
+    // can't be placed into the table fall back to the default estimate.
+    // Concurrent updates for the same action may overwrite each other, which
+    // is fine for a heuristic.
+    class HPX_EXPORT encode_size_cache
+    {
+    public:
+        static constexpr std::size_t num_slots = 256;
+        static constexpr std::size_t max_probes = 8;
+
+        // Return the learned size for the given action, or the given default
+        // if no parcel for this action was encoded yet.
+        std::size_t estimate(
+            char const* action, std::size_t default_size) const noexcept;
+
+        // Record the number of bytes a parcel of the given action occupied in
+        // the message buffer.
+        void update(char const* action, std::size_t size) noexcept;
+
+        // The number of actions with a learned size.
+        std::size_t size() const noexcept;
+
+    private:
+        // action names are static strings, the address is used as the key
+        struct slot
+        {
+            std::atomic<char const*> action_{nullptr};
+            std::atomic<std::size_t> size_{0};
+        };
+
+        static std::size_t hash(char const* action) noexcept;
+
+        slot slots_[num_slots];
+    };
+}    // namespace hpx::parcelset::detail
+
+#endif
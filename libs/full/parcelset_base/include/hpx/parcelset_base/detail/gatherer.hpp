@@ -36,6 +36,8 @@ namespace hpx::parcelset {
             inline std::int64_t total_time(bool reset);
             inline std::int64_t total_serialization_time(bool reset);
             inline std::int64_t total_buffer_allocate_time(bool reset);
+            inline std::int64_t total_encode_time(bool reset);
+            inline std::int64_t total_buffer_bytes_allocated(bool reset);
             inline std::int64_t num_zchunks(bool reset);
             inline std::int64_t num_zchunks_per_msg_max(bool reset);
             inline std::int64_t size_zchunks_total(bool reset);
@@ -49,6 +51,8 @@ namespace hpx::parcelset {
             std::int64_t num_messages_ = 0;
             std::int64_t overall_raw_bytes_ = 0;
             std::int64_t buffer_allocate_time_ = 0;
+            std::int64_t encode_time_ = 0;
+            std::int64_t buffer_bytes_allocated_ = 0;
             std::int64_t num_zchunks_ = 0;
             std::int64_t num_zchunks_per_msg_max_ = 0;
             std::int64_t size_zchunks_total_ = 0;
@@ -70,6 +74,8 @@ namespace hpx::parcelset {
             overall_raw_bytes_ += x.raw_bytes_;
             ++num_messages_;
             buffer_allocate_time_ += x.buffer_allocate_time_;
+            encode_time_ += x.encode_time_;
+            buffer_bytes_allocated_ += x.buffer_bytes_allocated_;
             num_zchunks_ += x.num_zchunks_;
             num_zchunks_per_msg_max_ = (std::max)(
                 num_zchunks_per_msg_max_, x.num_zchunks_per_msg_max_);
@@ -127,6 +133,20 @@ namespace hpx::parcelset {
             return util::get_and_reset_value(buffer_allocate_time_, reset);
         }
 
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::total_encode_time(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(encode_time_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::total_buffer_bytes_allocated(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(buffer_bytes_allocated_, reset);
+        }
+
         template <typename Mutex>
         std::int64_t gatherer<Mutex>::num_zchunks(bool reset)
         {
@@ -20,6 +20,7 @@
 #include <hpx/modules/synchronization.hpp>
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/detail/encode_size_cache.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
 #include <hpx/parcelset_base/locality.hpp>
@@ -235,6 +236,14 @@ namespace hpx::parcelset {
         std::int64_t get_buffer_allocate_time_sent(bool reset);
         std::int64_t get_buffer_allocate_time_received(bool reset);
 
+        /// the total time it took for encoding parcels into message buffers
+        /// (nanoseconds)
+        std::int64_t get_encode_time_sent(bool reset);
+
+        /// total number of bytes allocated for message buffers while encoding
+        /// parcels (bytes)
+        std::int64_t get_buffer_bytes_allocated_sent(bool reset);
+
         //// total zero-copy chunks sent
         std::int64_t get_zchunks_send_count(bool reset);
 
@@ -258,6 +267,15 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        // number of parcels held back for aggregation
+        std::int64_t get_aggregated_parcels_count(bool reset);
+
+        // number of batches of aggregated parcels released for sending
+        std::int64_t get_aggregation_batches_count(bool reset);
+
+        // the maximum number of parcels in one batch of aggregated parcels
+        std::int64_t get_aggregation_batch_size_max(bool reset);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -312,6 +330,25 @@ namespace hpx::parcelset {
         /// size
         std::int64_t get_max_outbound_message_size() const noexcept;
 
+        /// Return the maximal capacity of the message buffers kept alive by a
+        /// connection for encoding subsequent messages
+        std::size_t get_max_retained_buffer_size() const noexcept;
+
+        /// Return the time (nanoseconds) outgoing parcels may be held back
+        /// for being sent together with other parcels to the same
+        /// destination, zero if aggregation is disabled
+        std::uint64_t get_aggregation_latency() const noexcept;
+
+        /// Return the number of held back parcels for one destination that
+        /// causes those to be sent before their latency budget has expired
+        std::size_t get_aggregation_max_parcels() const noexcept;
+
+        /// Return the learned sizes of the encoded parcels per action
+        detail::encode_size_cache& get_encode_size_cache() noexcept
+        {
+            return encode_size_cache_;
+        }
+
         /// Return whether it is allowed to apply array optimizations
         bool allow_array_optimizations() const noexcept;
 
@@ -328,6 +365,26 @@ namespace hpx::parcelset {
         static void early_pending_parcel_handler(
             std::error_code const& ec, parcel const& p);
 
+    protected:
+        // Update the aggregation state of a destination after num_added
+        // parcels were added to its queue of pending parcels (now holding
+        // num_queued parcels). Returns whether the queued parcels should be
+        // sent right away. Assumes that mtx_ is locked.
+        bool update_aggregation(locality const& loc, std::size_t num_queued,
+            std::size_t num_added, bool aggregate);
+
+        // Return whether the parcels queued for the given destination should
+        // be sent (at the given point in time). Assumes that mtx_ is locked.
+        bool aggregation_expired(locality const& loc, std::size_t num_queued,
+            std::uint64_t now) const noexcept;
+
+        // Notify the aggregation that the parcels queued for the given
+        // destination were taken for sending. Assumes that mtx_ is locked.
+        void release_aggregation(locality const& loc, std::size_t num_parcels);
+
+        // Make all parcels held back for aggregation due for sending.
+        void expire_aggregation();
+
     protected:
         // mutex for all the member data
         mutable hpx::spinlock mtx_;
@@ -349,6 +406,22 @@ namespace hpx::parcelset {
         std::int64_t const max_inbound_message_size_;
         std::int64_t const max_outbound_message_size_;
 
+        // The maximal capacity of message buffers retained by connections
+        std::size_t max_retained_buffer_size_;
+
+        // The latency budget (nanoseconds) and the maximal batch size for
+        // aggregating outgoing parcels
+        std::uint64_t aggregation_latency_;
+        std::size_t aggregation_max_parcels_;
+
+        // The points in time (see hpx::chrono::high_resolution_clock) at
+        // which the parcels held back for a destination are due, protected
+        // by mtx_
+        std::map<locality, std::uint64_t> aggregation_deadlines_;
+
+        // The sizes of the encoded parcels per action
+        detail::encode_size_cache encode_size_cache_;
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         // Overall parcel statistics
         parcelset::gatherer parcels_sent_;
@@ -360,6 +433,12 @@ namespace hpx::parcelset {
         detail::per_action_data_counter action_parcels_sent_;
         detail::per_action_data_counter action_parcels_received_;
 #endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // Aggregation statistics, protected by mtx_
+        std::int64_t aggregated_parcels_ = 0;
+        std::int64_t aggregation_batches_ = 0;
+        std::int64_t aggregation_batch_size_max_ = 0;
+#endif
 
         /// serialization is allowed to use array optimization
         bool allow_array_optimizations_;
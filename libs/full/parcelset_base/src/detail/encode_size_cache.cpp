@@ -0,0 +1,121 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset_base/detail/encode_size_cache.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset::detail {
+
+    std::size_t encode_size_cache::hash(char const* action) noexcept
+    {
+        // Fibonacci hashing of the address, the lowest bits are dropped as
+        // those are mostly zero because of the alignment of the strings
+        std::uint64_t const h =
+            (static_cast<std::uint64_t>(
+                 reinterpret_cast<std::uintptr_t>(action)) >>
+                3) *
+            0x9e3779b97f4a7c15ull;
+        return static_cast<std::size_t>(h >> 56) % num_slots;
+    }
+
+    std::size_t encode_size_cache::estimate(
+        char const* action, std::size_t default_size) const noexcept
+    {
+        if (action == nullptr)
+        {
+            return default_size;
+        }
+
+        std::size_t idx = hash(action);
+        for (std::size_t i = 0; i != max_probes; ++i)
+        {
+            slot const& s = slots_[idx];
+
+            char const* const key = s.action_.load(std::memory_order_acquire);
+            if (key == action)
+            {
+                std::size_t const size =
+                    s.size_.load(std::memory_order_relaxed);
+                return size != 0 ? size : default_size;
+            }
+            if (key == nullptr)
+            {
+                break;
+            }
+            idx = (idx + 1) % num_slots;
+        }
+        return default_size;
+    }
+
+    void encode_size_cache::update(
+        char const* action, std::size_t size) noexcept
+    {
+        if (action == nullptr || size == 0)
+        {
+            return;
+        }
+
+        std::size_t idx = hash(action);
+        for (std::size_t i = 0; i != max_probes; ++i)
+        {
+            slot& s = slots_[idx];
+
+            char const* key = s.action_.load(std::memory_order_acquire);
+            if (key == nullptr &&
+                s.action_.compare_exchange_strong(
+                    key, action, std::memory_order_acq_rel))
+            {
+                s.size_.store(size, std::memory_order_relaxed);
+                return;
+            }
+
+            if (key == action)
+            {
+                // grow immediately, shrink by 1/8th of the difference, avoid
+                // writing to the slot if nothing changes
+                std::size_t const current =
+                    s.size_.load(std::memory_order_relaxed);
+
+                std::size_t next = size;
+                if (size < current)
+                {
+                    next = current - (current - size) / 8;
+                }
+
+                if (next != current)
+                {
+                    s.size_.store(next, std::memory_order_relaxed);
+                }
+                return;
+            }
+            idx = (idx + 1) % num_slots;
+        }
+
+        // no free slot available, the default estimate is used for this
+        // action
+    }
+
+    std::size_t encode_size_cache::size() const noexcept
+    {
+        std::size_t result = 0;
+        for (slot const& s : slots_)
+        {
+            if (s.action_.load(std::memory_order_relaxed) != nullptr)
+            {
+                ++result;
+            }
+        }
+        return result;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
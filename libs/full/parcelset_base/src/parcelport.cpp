@@ -15,6 +15,7 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/util.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/modules/threading_base.hpp>
@@ -22,9 +23,11 @@
 
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -41,6 +44,10 @@ namespace hpx::parcelset {
             static_cast<std::int64_t>(ini.get_max_inbound_message_size()))
       , max_outbound_message_size_(
             static_cast<std::int64_t>(ini.get_max_outbound_message_size()))
+      , max_retained_buffer_size_(static_cast<std::size_t>(
+            max_outbound_message_size_ > 0 ? max_outbound_message_size_ : 0))
+      , aggregation_latency_(0)
+      , aggregation_max_parcels_(0)
       , allow_array_optimizations_(true)
       , allow_zero_copy_optimizations_(true)
       , allow_zero_copy_receive_optimizations_(true)
@@ -77,6 +84,17 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        max_retained_buffer_size_ = hpx::util::get_entry_as<std::size_t>(
+            ini, key + ".max_retained_buffer_size", max_retained_buffer_size_);
+
+        // the latency budget is configured in microseconds
+        aggregation_latency_ = hpx::util::get_entry_as<std::uint64_t>(
+                                   ini, key + ".aggregation_latency", 0) *
+            1000;
+        aggregation_max_parcels_ = (std::max)(std::size_t(1),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, key + ".aggregation_max_parcels", 64));
     }
 
     int parcelport::priority() const noexcept
@@ -224,6 +242,20 @@ namespace hpx::parcelset {
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    // the total time it took for encoding parcels into message buffers
+    // (nanoseconds)
+    std::int64_t parcelport::get_encode_time_sent(bool reset)
+    {
+        return parcels_sent_.total_encode_time(reset);
+    }
+
+    // total number of bytes allocated for message buffers while encoding
+    // parcels (bytes)
+    std::int64_t parcelport::get_buffer_bytes_allocated_sent(bool reset)
+    {
+        return parcels_sent_.total_buffer_bytes_allocated(reset);
+    }
+
     //// total zero-copy chunks sent
     std::int64_t parcelport::get_zchunks_send_count(bool reset)
     {
@@ -271,6 +303,27 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    // number of parcels held back for aggregation
+    std::int64_t parcelport::get_aggregated_parcels_count(bool reset)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        return util::get_and_reset_value(aggregated_parcels_, reset);
+    }
+
+    // number of batches of aggregated parcels released for sending
+    std::int64_t parcelport::get_aggregation_batches_count(bool reset)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        return util::get_and_reset_value(aggregation_batches_, reset);
+    }
+
+    // the maximum number of parcels in one batch of aggregated parcels
+    std::int64_t parcelport::get_aggregation_batch_size_max(bool reset)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        return util::get_and_reset_value(aggregation_batch_size_max_, reset);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -361,6 +414,93 @@ namespace hpx::parcelset {
         return max_outbound_message_size_;
     }
 
+    std::size_t parcelport::get_max_retained_buffer_size() const noexcept
+    {
+        return max_retained_buffer_size_;
+    }
+
+    std::uint64_t parcelport::get_aggregation_latency() const noexcept
+    {
+        return aggregation_latency_;
+    }
+
+    std::size_t parcelport::get_aggregation_max_parcels() const noexcept
+    {
+        return aggregation_max_parcels_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool parcelport::update_aggregation(locality const& loc,
+        std::size_t num_queued, std::size_t num_added, bool aggregate)
+    {
+        auto it = aggregation_deadlines_.find(loc);
+        if (!aggregate)
+        {
+            // parcels which may not be delayed release the whole batch
+            if (it != aggregation_deadlines_.end())
+            {
+                it->second = 0;
+            }
+            return true;
+        }
+
+        if (it == aggregation_deadlines_.end())
+        {
+            // other parcels are already waiting to be sent (e.g. for a
+            // connection to become available), don't hold back the new ones
+            if (num_queued != num_added)
+            {
+                return true;
+            }
+
+            it = aggregation_deadlines_
+                     .emplace(loc,
+                         hpx::chrono::high_resolution_clock::now() +
+                             aggregation_latency_)
+                     .first;
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        aggregated_parcels_ += static_cast<std::int64_t>(num_added);
+#endif
+        return it->second == 0 || num_queued >= aggregation_max_parcels_;
+    }
+
+    bool parcelport::aggregation_expired(locality const& loc,
+        std::size_t num_queued, std::uint64_t now) const noexcept
+    {
+        auto const it = aggregation_deadlines_.find(loc);
+        return it == aggregation_deadlines_.end() || it->second <= now ||
+            num_queued >= aggregation_max_parcels_;
+    }
+
+    void parcelport::release_aggregation(
+        locality const& loc, [[maybe_unused]] std::size_t num_parcels)
+    {
+        auto const it = aggregation_deadlines_.find(loc);
+        if (it == aggregation_deadlines_.end())
+        {
+            return;
+        }
+
+        aggregation_deadlines_.erase(it);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        ++aggregation_batches_;
+        aggregation_batch_size_max_ = (std::max)(aggregation_batch_size_max_,
+            static_cast<std::int64_t>(num_parcels));
+#endif
+    }
+
+    void parcelport::expire_aggregation()
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        for (auto& deadline : aggregation_deadlines_)
+        {
+            deadline.second = 0;
+        }
+    }
+
     bool parcelport::allow_array_optimizations() const noexcept
     {
         return allow_array_optimizations_;
@@ -0,0 +1,188 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file counter_export_layout.hpp
+/// \page hpx::performance_counters::counter_export
+/// \headerfile hpx/performance_counters/counter_export_layout.hpp
+
+#pragma once
+
+// This file intentionally depends on the C++ standard library only. It
+// describes the layout of the shared memory segment the performance counters
+// are published into (see --hpx:export-counter) and is used by external
+// readers (e.g. tools/counter_export_reader) as well.
+//
+// The segment consists of three consecutive parts:
+//
+//   segment_header                           (fixed size)
+//   name_entry[num_counters]                 (at names_offset)
+//   value_entry[num_counters]                (at values_offset)
+//
+// The header and the name table are written once before the magic number is
+// published, they never change afterwards. Each value entry is protected by
+// a sequence lock: the writer makes the sequence number odd before updating
+// the entry and even again afterwards. A reader retries if it observed an odd
+// sequence number or if the sequence number has changed while it was copying
+// the values. Readers never write to the segment and never block the writer.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::performance_counters::counter_export {
+
+    /// 'HPXC' in little endian byte order
+    inline constexpr std::uint32_t magic = 0x43585048;
+
+    /// Version of the layout described in this file
+    inline constexpr std::uint32_t version = 1;
+
+    inline constexpr std::size_t max_name_length = 256;
+    inline constexpr std::size_t max_unit_length = 32;
+
+    /// The state of the exporting process
+    enum class segment_state : std::uint32_t
+    {
+        initializing = 0,    ///< the segment is being set up
+        running = 1,         ///< the values are periodically updated
+        stopped = 2          ///< the values will not be updated anymore
+    };
+
+    /// The fixed size header at the beginning of the segment
+    struct segment_header
+    {
+        std::atomic<std::uint32_t> magic;    // published last
+        std::uint32_t version;
+        std::uint32_t num_counters;
+        std::uint32_t name_entry_size;     // sizeof(name_entry)
+        std::uint32_t value_entry_size;    // sizeof(value_entry)
+        std::uint32_t locality_id;
+        std::uint64_t pid;
+        std::uint64_t names_offset;
+        std::uint64_t values_offset;
+        std::uint64_t interval;    // update interval [ms]
+        std::atomic<std::uint32_t> state;
+        std::uint32_t reserved;
+        std::atomic<std::uint64_t> generation;    // number of update rounds
+    };
+
+    /// Static information about one exported counter
+    struct name_entry
+    {
+        char name[max_name_length];    // full counter name, '\0' terminated
+        char unit_of_measure[max_unit_length];
+        std::uint32_t type;    // hpx::performance_counters::counter_type
+        std::uint32_t reserved;
+    };
+
+    /// The sequence lock protected value of one exported counter, occupies
+    /// a cache line to avoid false sharing between readers of neighboring
+    /// entries
+    struct alignas(64) value_entry
+    {
+        std::atomic<std::uint64_t> sequence;
+        std::atomic<std::uint64_t> time;     // time of sampling [ns]
+        std::atomic<std::uint64_t> count;    // invocation count
+        std::atomic<std::int64_t> value;
+        std::atomic<std::int64_t> scaling;
+        std::atomic<std::uint32_t> status;    // counter_status
+        std::atomic<std::uint32_t> scale_inverse;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+            std::atomic<std::uint32_t>::is_always_lock_free,
+        "the shared memory layout requires address free (lock free) "
+        "atomics");
+
+    /// A consistent copy of a value_entry
+    struct value_sample
+    {
+        std::uint64_t time = 0;
+        std::uint64_t count = 0;
+        std::int64_t value = 0;
+        std::int64_t scaling = 1;
+        std::uint32_t status = 0;
+        bool scale_inverse = false;
+    };
+
+    /// Return the scaled value of a sample (see counter_value::get_value)
+    [[nodiscard]] inline double get_value(value_sample const& s) noexcept
+    {
+        auto const val = static_cast<double>(s.value);
+        if (s.scaling == 1 || s.scaling == 0)
+            return val;
+        return s.scale_inverse ? val / static_cast<double>(s.scaling) :
+                                 val * static_cast<double>(s.scaling);
+    }
+
+    /// Offsets of the name table and the values, both are cache line aligned
+    [[nodiscard]] constexpr std::size_t names_offset() noexcept
+    {
+        return (sizeof(segment_header) + 63) & ~std::size_t(63);
+    }
+
+    [[nodiscard]] constexpr std::size_t values_offset(
+        std::size_t num_counters) noexcept
+    {
+        return (names_offset() + num_counters * sizeof(name_entry) + 63) &
+            ~std::size_t(63);
+    }
+
+    /// Compute the overall size of a segment holding num_counters counters
+    [[nodiscard]] constexpr std::size_t segment_size(
+        std::size_t num_counters) noexcept
+    {
+        return values_offset(num_counters) +
+            num_counters * sizeof(value_entry);
+    }
+
+    /// Publish a new sample (writer side, there must be only one writer)
+    inline void write(value_entry& e, value_sample const& s) noexcept
+    {
+        std::uint64_t const seq = e.sequence.load(std::memory_order_relaxed);
+        e.sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        e.time.store(s.time, std::memory_order_relaxed);
+        e.count.store(s.count, std::memory_order_relaxed);
+        e.value.store(s.value, std::memory_order_relaxed);
+        e.scaling.store(s.scaling, std::memory_order_relaxed);
+        e.status.store(s.status, std::memory_order_relaxed);
+        e.scale_inverse.store(s.scale_inverse, std::memory_order_relaxed);
+
+        e.sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /// Attempt to take a consistent copy of the given entry, returns false if
+    /// the entry was concurrently modified
+    [[nodiscard]] inline bool try_read(
+        value_entry const& e, value_sample& s) noexcept
+    {
+        std::uint64_t const seq = e.sequence.load(std::memory_order_acquire);
+        if (seq & 1)
+            return false;
+
+        s.time = e.time.load(std::memory_order_relaxed);
+        s.count = e.count.load(std::memory_order_relaxed);
+        s.value = e.value.load(std::memory_order_relaxed);
+        s.scaling = e.scaling.load(std::memory_order_relaxed);
+        s.status = e.status.load(std::memory_order_relaxed);
+        s.scale_inverse = e.scale_inverse.load(std::memory_order_relaxed) != 0;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return e.sequence.load(std::memory_order_relaxed) == seq;
+    }
+
+    /// Take a consistent copy of the given entry, retries until successful
+    [[nodiscard]] inline value_sample read(value_entry const& e) noexcept
+    {
+        value_sample s;
+        while (!try_read(e, s))
+        {
+        }
+        return s;
+    }
+}    // namespace hpx::performance_counters::counter_export
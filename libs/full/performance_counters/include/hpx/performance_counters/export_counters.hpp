@@ -0,0 +1,93 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_export_layout.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/performance_counters/performance_counter_set.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Periodically publishes the values of the local performance counters
+    // into a named shared memory segment (see counter_export_layout.hpp for
+    // its layout). External agents can map the segment and read the values
+    // at any time without involving the HPX runtime.
+    //
+    // Only counters with a single value are exported, histogram and
+    // raw_values counters are ignored.
+    class HPX_EXPORT export_counters
+    {
+        // avoid warning about using this in member initializer list
+        export_counters* this_()
+        {
+            return this;
+        }
+
+    public:
+        // The name of the segment may contain the placeholders '{pid}' and
+        // '{locality}'.
+        export_counters(std::vector<std::string> const& names,
+            std::int64_t interval, std::string const& segment_name);
+        ~export_counters();
+
+        export_counters(export_counters const&) = delete;
+        export_counters(export_counters&&) = delete;
+        export_counters& operator=(export_counters const&) = delete;
+        export_counters& operator=(export_counters&&) = delete;
+
+        void start();
+        void stop();
+
+        // Sample all counters and publish their values, returns whether the
+        // timer should continue invoking this function
+        bool evaluate();
+
+        void terminate();
+
+        // Return the (expanded) name of the shared memory segment
+        std::string const& get_segment_name() const noexcept
+        {
+            return segment_name_;
+        }
+
+        // Return the number of exported counters
+        std::size_t size() const noexcept
+        {
+            return num_counters_;
+        }
+
+    private:
+        void create_segment(
+            std::vector<performance_counters::counter_info> const& infos);
+        void release_segment() noexcept;
+
+        std::vector<std::string> names_;
+        performance_counters::performance_counter_set counters_;
+
+        std::string segment_name_;
+        std::int64_t interval_;
+
+        void* segment_;
+        std::size_t segment_size_;
+        std::size_t num_counters_;
+
+        interval_timer timer_;
+    };
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
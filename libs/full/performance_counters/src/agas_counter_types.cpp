@@ -65,6 +65,28 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> range_table_entries(hpx::bind_front(
+            &agas::addressing_service::get_range_table_entries, &client));
+        hpx::function<std::int64_t(bool)> range_table_hits(hpx::bind_front(
+            &agas::addressing_service::get_range_table_hits, &client));
+        hpx::function<std::int64_t(bool)> range_table_misses(hpx::bind_front(
+            &agas::addressing_service::get_range_table_misses, &client));
+        hpx::function<std::int64_t(bool)> range_table_invalidations(
+            hpx::bind_front(
+                &agas::addressing_service::get_range_table_invalidations,
+                &client));
+
+        hpx::function<std::int64_t(bool)> decref_requests(hpx::bind_front(
+            &agas::addressing_service::get_decref_requests, &client));
+        hpx::function<std::int64_t(bool)> decref_batches(hpx::bind_front(
+            &agas::addressing_service::get_decref_batches, &client));
+        hpx::function<std::int64_t(bool)> decref_batch_requests(
+            hpx::bind_front(
+                &agas::addressing_service::get_decref_batch_requests,
+                &client));
+        hpx::function<std::int64_t(bool)> decref_batch_latency(hpx::bind_front(
+            &agas::addressing_service::get_decref_batch_latency, &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +218,86 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/range_table/entries",
+                    performance_counters::counter_type::raw,
+                    "returns the number of prefetched address ranges in the "
+                    "AGAS range table",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        range_table_entries, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/range_table/hits",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of address resolutions satisfied by "
+                    "the AGAS range table (i.e. the number of avoided remote "
+                    "resolutions)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        range_table_hits, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/range_table/misses",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of address resolutions not satisfied "
+                    "by the AGAS range table",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        range_table_misses, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/range_table/invalidations",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of address ranges removed from the "
+                    "AGAS range table",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        range_table_invalidations, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/decref/requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of credit decrements issued by this "
+                    "locality",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_requests, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/decref/batches",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of messages sent to AGAS carrying "
+                    "batched credit decrements",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_batches, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/decref/batch_entries",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of (combined) credit decrements sent "
+                    "to AGAS",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_batch_requests, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/time/decref/batch_latency",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the overall time the oldest credit decrement of "
+                    "each flush was held back before being sent to AGAS",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_batch_latency, _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
             };
 
         performance_counters::install_counter_types(
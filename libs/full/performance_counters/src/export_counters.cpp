@@ -0,0 +1,301 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_export_layout.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/export_counters.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::util {
+
+    namespace {
+
+        void replace_all(std::string& str, std::string const& placeholder,
+            std::string const& value)
+        {
+            for (std::string::size_type p = str.find(placeholder);
+                p != std::string::npos;
+                p = str.find(placeholder, p + value.size()))
+            {
+                str.replace(p, placeholder.size(), value);
+            }
+        }
+
+        template <std::size_t N>
+        void copy_string(char (&dest)[N], std::string const& src) noexcept
+        {
+            std::size_t const len = (std::min)(src.size(), N - 1);
+            std::memcpy(dest, src.data(), len);
+            dest[len] = '\0';
+        }
+
+        bool is_exported(performance_counters::counter_info const& info)
+        {
+            return info.type_ !=
+                performance_counters::counter_type::histogram &&
+                info.type_ != performance_counters::counter_type::raw_values;
+        }
+
+        namespace layout = performance_counters::counter_export;
+    }    // namespace
+
+    export_counters::export_counters(std::vector<std::string> const& names,
+        std::int64_t interval, std::string const& segment_name)
+      : names_(names)
+      , counters_(true)    // export local counters only
+      , segment_name_(segment_name)
+      , interval_(interval)
+      , segment_(nullptr)
+      , segment_size_(0)
+      , num_counters_(0)
+      , timer_(hpx::bind_front(&export_counters::evaluate, this_()),
+            hpx::bind_front(&export_counters::terminate, this_()),
+            interval * 1000, "export_counters", true)
+    {
+        // add counter prefix, if necessary
+        for (std::string& name : names_)
+        {
+            performance_counters::ensure_counter_prefix(name);
+        }
+
+        if (interval_ <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "export_counters::export_counters",
+                "the interval for exporting performance counters must be "
+                "positive (given: {})",
+                interval_);
+        }
+    }
+
+    export_counters::~export_counters()
+    {
+        release_segment();
+        counters_.release();
+    }
+
+    void export_counters::start()
+    {
+        counters_.add_counters(names_);
+
+        std::vector<performance_counters::counter_info> infos =
+            counters_.get_counter_infos();
+        infos.erase(
+            std::remove_if(infos.begin(), infos.end(),
+                [](auto const& info) { return !is_exported(info); }),
+            infos.end());
+
+        create_segment(infos);
+
+        counters_.start(launch::sync);
+
+        // this will invoke the evaluate function for the first time
+        timer_.start();
+    }
+
+    void export_counters::stop()
+    {
+        timer_.stop(true);
+
+        error_code ec(throwmode::lightweight);    // do not throw
+        counters_.stop(launch::sync, ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void export_counters::create_segment(
+        std::vector<performance_counters::counter_info> const& infos)
+    {
+#if defined(HPX_WINDOWS)
+        HPX_UNUSED(infos);
+        HPX_THROW_EXCEPTION(hpx::error::not_implemented,
+            "export_counters::create_segment",
+            "exporting performance counters to shared memory is not "
+            "supported on this platform");
+#else
+        std::uint32_t const locality_id = hpx::get_locality_id();
+
+        replace_all(segment_name_, "{pid}", std::to_string(::getpid()));
+        replace_all(segment_name_, "{locality}", std::to_string(locality_id));
+        if (segment_name_.empty() || segment_name_[0] != '/')
+            segment_name_.insert(0, 1, '/');
+
+        num_counters_ = infos.size();
+        segment_size_ = layout::segment_size(num_counters_);
+
+        // remove stale segments left behind by crashed processes
+        ::shm_unlink(segment_name_.c_str());
+
+        int const fd = ::shm_open(segment_name_.c_str(),
+            O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "export_counters::create_segment",
+                "could not create shared memory segment {}: {}", segment_name_,
+                std::strerror(errno));
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(segment_size_)) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(segment_name_.c_str());
+
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "export_counters::create_segment",
+                "could not resize shared memory segment {} to {} bytes: {}",
+                segment_name_, segment_size_, std::strerror(err));
+        }
+
+        void* data = ::mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(segment_name_.c_str());
+
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "export_counters::create_segment",
+                "could not map shared memory segment {}: {}", segment_name_,
+                std::strerror(err));
+        }
+
+        segment_ = data;
+
+        // the segment is zero initialized, construct the header, the name
+        // table, and the value entries in place
+        auto* base = static_cast<char*>(segment_);
+        auto* header = new (base) layout::segment_header();
+
+        header->version = layout::version;
+        header->num_counters = static_cast<std::uint32_t>(num_counters_);
+        header->name_entry_size = sizeof(layout::name_entry);
+        header->value_entry_size = sizeof(layout::value_entry);
+        header->locality_id = locality_id;
+        header->pid = static_cast<std::uint64_t>(::getpid());
+        header->names_offset = layout::names_offset();
+        header->values_offset = layout::values_offset(num_counters_);
+        header->interval = static_cast<std::uint64_t>(interval_);
+        header->state.store(
+            static_cast<std::uint32_t>(layout::segment_state::initializing),
+            std::memory_order_relaxed);
+        header->generation.store(0, std::memory_order_relaxed);
+
+        auto* names = reinterpret_cast<layout::name_entry*>(
+            base + layout::names_offset());
+        auto* values = reinterpret_cast<layout::value_entry*>(
+            base + layout::values_offset(num_counters_));
+
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            auto* name = new (&names[i]) layout::name_entry();
+            copy_string(name->name, infos[i].fullname_);
+            copy_string(name->unit_of_measure, infos[i].unit_of_measure_);
+            name->type = static_cast<std::uint32_t>(infos[i].type_);
+
+            new (&values[i]) layout::value_entry();
+        }
+
+        // readers may access the segment only after the magic number has been
+        // published
+        header->magic.store(layout::magic, std::memory_order_release);
+#endif
+    }
+
+    void export_counters::release_segment() noexcept
+    {
+#if !defined(HPX_WINDOWS)
+        if (segment_ != nullptr)
+        {
+            ::munmap(segment_, segment_size_);
+            segment_ = nullptr;
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool export_counters::evaluate()
+    {
+        if (segment_ == nullptr)
+            return false;
+
+        error_code ec(throwmode::lightweight);    // do not throw
+        std::vector<performance_counters::counter_value> const values =
+            counters_.get_counter_values(launch::sync, false, ec);
+
+        // try again later if the counters could not be queried
+        if (ec || values.size() != num_counters_)
+            return true;
+
+        auto* base = static_cast<char*>(segment_);
+        auto* header = reinterpret_cast<layout::segment_header*>(base);
+        auto* entries = reinterpret_cast<layout::value_entry*>(
+            base + layout::values_offset(num_counters_));
+
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            performance_counters::counter_value const& value = values[i];
+
+            layout::value_sample sample;
+            sample.time = value.time_;
+            sample.count = value.count_;
+            sample.value = value.value_;
+            sample.scaling = value.scaling_;
+            sample.status = static_cast<std::uint32_t>(value.status_);
+            sample.scale_inverse = value.scale_inverse_;
+
+            layout::write(entries[i], sample);
+        }
+
+        header->generation.fetch_add(1, std::memory_order_release);
+        header->state.store(
+            static_cast<std::uint32_t>(layout::segment_state::running),
+            std::memory_order_release);
+
+        return true;
+    }
+
+    void export_counters::terminate()
+    {
+        if (segment_ == nullptr)
+            return;
+
+        auto* header = static_cast<layout::segment_header*>(segment_);
+        header->state.store(
+            static_cast<std::uint32_t>(layout::segment_state::stopped),
+            std::memory_order_release);
+
+#if !defined(HPX_WINDOWS)
+        // readers that have mapped the segment can still access the last
+        // values, new readers will not find it anymore
+        ::shm_unlink(segment_name_.c_str());
+#endif
+    }
+}    // namespace hpx::util
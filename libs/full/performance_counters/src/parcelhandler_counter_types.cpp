@@ -105,6 +105,12 @@ namespace hpx::performance_counters {
             hpx::bind_front(&parcelhandler::get_buffer_allocate_time_received,
                 &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> encode_time_sent(hpx::bind_front(
+            &parcelhandler::get_encode_time_sent, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> buffer_bytes_allocated_sent(
+            hpx::bind_front(
+                &parcelhandler::get_buffer_bytes_allocated_sent, &ph, pp_type));
+
         hpx::function<std::int64_t(bool)> num_zchunks_send(hpx::bind_front(
             &parcelhandler::get_zchunks_send_count, &ph, pp_type));
         hpx::function<std::int64_t(bool)> num_zchunks_recv(hpx::bind_front(
@@ -129,6 +135,16 @@ namespace hpx::performance_counters {
             hpx::bind_front(
                 &parcelhandler::get_zchunks_recv_size_max, &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> num_aggregated_parcels(
+            hpx::bind_front(
+                &parcelhandler::get_aggregated_parcels_count, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> num_aggregation_batches(
+            hpx::bind_front(
+                &parcelhandler::get_aggregation_batches_count, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> aggregation_batch_size_max(
+            hpx::bind_front(
+                &parcelhandler::get_aggregation_batch_size_max, &ph, pp_type));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {
                 {hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -363,6 +379,32 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(buffer_allocate_time_sent), _2),
                     &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format("/parcels/time/{}/encode/sent", pp_type),
+                    performance_counters::counter_type::elapsed_time,
+                    hpx::util::format(
+                        "returns the time needed to encode the parcels into "
+                        "the message buffers using the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(encode_time_sent), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcels/count/{}/buffer_allocate/sent", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of bytes allocated for the "
+                        "message buffers while encoding parcels using the {} "
+                        "connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(buffer_bytes_allocated_sent), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
                 {hpx::util::format(
                      "/parcelport/count/{}/zero_copy_chunks/sent", pp_type),
                     performance_counters::counter_type::
@@ -476,6 +518,45 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(size_zchunks_recv_per_msg_max), _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format("/parcels/count/{}/aggregated", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of parcels held back for being "
+                        "sent together with other parcels to the same "
+                        "destination using the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(num_aggregated_parcels), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcels/count/{}/aggregation/batches", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of batches of aggregated parcels "
+                        "released for sending using the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(num_aggregation_batches), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcels/count-max/{}/aggregation/batch_size", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the maximum number of parcels in one batch "
+                        "of aggregated parcels released for sending using "
+                        "the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(aggregation_batch_size_max), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
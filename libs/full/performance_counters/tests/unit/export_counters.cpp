@@ -0,0 +1,134 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/counter_export_layout.hpp>
+#include <hpx/performance_counters/export_counters.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace layout = hpx::performance_counters::counter_export;
+
+#if !defined(HPX_WINDOWS)
+///////////////////////////////////////////////////////////////////////////////
+// map the segment read-only, the same way an external reader would
+char const* map_segment(std::string const& name, std::size_t& size)
+{
+    int const fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat st = {};
+    void* p = MAP_FAILED;
+    if (::fstat(fd, &st) == 0)
+    {
+        size = static_cast<std::size_t>(st.st_size);
+        p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    return p == MAP_FAILED ? nullptr : static_cast<char const*>(p);
+}
+
+int hpx_main()
+{
+    std::vector<std::string> const names = {
+        "/threads{locality#0/total}/count/cumulative",
+        "/runtime{locality#0/total}/uptime"};
+
+    hpx::util::export_counters exporter(
+        names, 10, "hpx_export_counters_test.{pid}.{locality}");
+    exporter.start();
+
+    std::string const segment_name = exporter.get_segment_name();
+    HPX_TEST_EQ(segment_name,
+        "/hpx_export_counters_test." + std::to_string(::getpid()) + ".0");
+    HPX_TEST_EQ(exporter.size(), names.size());
+
+    std::size_t size = 0;
+    char const* data = map_segment(segment_name, size);
+    HPX_TEST(data != nullptr);
+    if (data == nullptr)
+        return hpx::finalize();
+
+    auto const& header = *reinterpret_cast<layout::segment_header const*>(data);
+    HPX_TEST_EQ(header.magic.load(), layout::magic);
+    HPX_TEST_EQ(header.version, layout::version);
+    HPX_TEST_EQ(header.num_counters, static_cast<std::uint32_t>(names.size()));
+    HPX_TEST_EQ(header.interval, static_cast<std::uint64_t>(10));
+    HPX_TEST_EQ(header.pid, static_cast<std::uint64_t>(::getpid()));
+    HPX_TEST(layout::segment_size(header.num_counters) <= size);
+
+    auto const* name_table =
+        reinterpret_cast<layout::name_entry const*>(data + header.names_offset);
+    auto const* values = reinterpret_cast<layout::value_entry const*>(
+        data + header.values_offset);
+
+    HPX_TEST_EQ(std::string(name_table[0].name), names[0]);
+    HPX_TEST_EQ(std::string(name_table[1].name), names[1]);
+    HPX_TEST_EQ(std::string(name_table[1].unit_of_measure), "s");
+
+    // wait for a couple of update rounds
+    std::uint64_t const generation = header.generation.load();
+    while (header.generation.load() < generation + 3)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    HPX_TEST_EQ(header.state.load(),
+        static_cast<std::uint32_t>(layout::segment_state::running));
+
+    layout::value_sample const threads = layout::read(values[0]);
+    HPX_TEST(threads.count != 0);
+    HPX_TEST(threads.value > 0);
+
+    layout::value_sample const uptime1 = layout::read(values[1]);
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+    layout::value_sample const uptime2 = layout::read(values[1]);
+    HPX_TEST(uptime2.count > uptime1.count);
+    HPX_TEST(layout::get_value(uptime2) > layout::get_value(uptime1));
+
+    exporter.stop();
+
+    // the last values remain accessible, but the segment was removed
+    HPX_TEST_EQ(header.state.load(),
+        static_cast<std::uint32_t>(layout::segment_state::stopped));
+    HPX_TEST_EQ(::shm_open(segment_name.c_str(), O_RDONLY, 0), -1);
+
+    ::munmap(const_cast<char*>(data), size);
+
+    return hpx::finalize();
+}
+#else
+// exporting counters to shared memory is not supported on Windows
+int hpx_main()
+{
+    return hpx::finalize();
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
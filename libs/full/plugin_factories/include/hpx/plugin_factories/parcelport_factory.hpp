@@ -97,6 +97,16 @@ namespace hpx::plugins {
             fillini.emplace_back("max_outbound_message_size =  ${HPX_PARCEL_" +
                 name_uc + "_MAX_OUTBOUND_MESSAGE_SIZE" +
                 ":$[hpx.parcel.max_outbound_message_size]}");
+            fillini.emplace_back("max_retained_buffer_size = ${HPX_PARCEL_" +
+                name_uc + "_MAX_RETAINED_BUFFER_SIZE" +
+                ":$[hpx.parcel.max_retained_buffer_size]}");
+            fillini.emplace_back("aggregation_latency = ${HPX_PARCEL_" +
+                name_uc +
+                "_AGGREGATION_LATENCY:$[hpx.parcel.aggregation_latency]}");
+            fillini.emplace_back("aggregation_max_parcels = ${HPX_PARCEL_" +
+                name_uc +
+                "_AGGREGATION_MAX_PARCELS:"
+                "$[hpx.parcel.aggregation_max_parcels]}");
             fillini.emplace_back("array_optimization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ARRAY_OPTIMIZATION:$[hpx.parcel.array_optimization]}");
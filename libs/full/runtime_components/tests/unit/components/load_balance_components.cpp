@@ -0,0 +1,253 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t N = 8;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+    using base_type = hpx::components::migration_support<
+        hpx::components::component_base<test_server>>;
+
+    explicit test_server(int data = 0)
+      : data_(data)
+    {
+    }
+
+    [[nodiscard]] hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    void busy_work() const
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    [[nodiscard]] int get_data() const
+    {
+        return data_;
+    }
+
+    // Components that should be migrated using hpx::migrate<> need to be
+    // Serializable and CopyConstructable.
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+      , data_(rhs.data_)
+    {
+    }
+
+    test_server& operator=(test_server const& rhs)
+    {
+        data_ = rhs.data_;
+        return *this;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, busy_work, busy_work_action)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_data, get_data_action)
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & data_;
+        // clang-format on
+    }
+
+private:
+    int data_;
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+using busy_work_action = test_server::busy_work_action;
+HPX_REGISTER_ACTION_DECLARATION(busy_work_action)
+HPX_REGISTER_ACTION(busy_work_action)
+
+using get_data_action = test_server::get_data_action;
+HPX_REGISTER_ACTION_DECLARATION(get_data_action)
+HPX_REGISTER_ACTION(get_data_action)
+
+struct test_client : hpx::components::client_base<test_client, test_server>
+{
+    using base_type = hpx::components::client_base<test_client, test_server>;
+
+    test_client() = default;
+    test_client(hpx::future<hpx::id_type>&& id)
+      : base_type(std::move(id))
+    {
+    }
+    explicit test_client(hpx::id_type&& id)
+      : base_type(std::move(id))
+    {
+    }
+
+    [[nodiscard]] hpx::id_type call() const
+    {
+        return call_action()(this->get_id());
+    }
+
+    [[nodiscard]] hpx::future<void> busy_work() const
+    {
+        return hpx::async<busy_work_action>(this->get_id());
+    }
+
+    [[nodiscard]] int get_data() const
+    {
+        return get_data_action()(this->get_id());
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::components::component_load make_load(
+    std::uint64_t id, std::uint64_t load, std::uint32_t pending = 0)
+{
+    hpx::components::component_load result;
+    result.id = hpx::naming::gid_type(0, id);
+    result.load = load;
+    result.pending = pending;
+    return result;
+}
+
+void test_migration_plan()
+{
+    using hpx::components::locality_load;
+
+    std::vector<locality_load> loads(2);
+    loads[0].locality_id = 0;
+    loads[1].locality_id = 1;
+
+    // balanced loads don't require any migrations
+    loads[0].components = {make_load(1, 100), make_load(2, 100)};
+    loads[1].components = {make_load(3, 100), make_load(4, 100)};
+    HPX_TEST_EQ(hpx::components::compute_imbalance(loads), 1.0);
+    HPX_TEST(hpx::components::compute_migration_plan(loads).empty());
+
+    // all load on locality 0
+    loads[0].components = {make_load(1, 100), make_load(2, 100),
+        make_load(3, 100), make_load(4, 100)};
+    loads[1].components.clear();
+    HPX_TEST_EQ(hpx::components::compute_imbalance(loads), 2.0);
+
+    auto plan = hpx::components::compute_migration_plan(loads);
+    HPX_TEST_EQ(plan.size(), std::size_t(2));
+    for (auto const& step : plan)
+    {
+        HPX_TEST_EQ(step.source, std::uint32_t(0));
+        HPX_TEST_EQ(step.target, std::uint32_t(1));
+    }
+
+    // the component best evening out the loads is moved
+    loads[0].components = {
+        make_load(1, 500), make_load(2, 150), make_load(3, 50)};
+    loads[1].components = {make_load(4, 100)};
+    plan = hpx::components::compute_migration_plan(loads);
+    HPX_TEST(!plan.empty());
+    HPX_TEST_EQ(plan[0].id, hpx::naming::gid_type(0, 2));
+
+    // busy components are not migrated
+    loads[0].components = {make_load(1, 100, 5), make_load(2, 100, 5)};
+    HPX_TEST(hpx::components::compute_migration_plan(loads).empty());
+
+    // the number of migrations is limited
+    loads[0].components.clear();
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        loads[0].components.push_back(make_load(i + 1, 10));
+    }
+
+    hpx::components::load_balancer_parameters params;
+    params.max_migrations = 10;
+    plan = hpx::components::compute_migration_plan(loads, params);
+    HPX_TEST_EQ(plan.size(), std::size_t(10));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_load_balancer()
+{
+    // create all components on this locality
+    std::vector<test_client> clients;
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        clients.push_back(
+            hpx::new_<test_client>(hpx::find_here(), static_cast<int>(i)));
+        hpx::components::register_for_load_balancing(clients.back()).get();
+    }
+
+    // generate some load
+    std::vector<hpx::future<void>> work;
+    for (test_client const& c : clients)
+    {
+        work.push_back(c.busy_work());
+    }
+    hpx::wait_all(work);
+
+    hpx::components::load_balancer balancer;
+    std::size_t const migrated = balancer.balance().get();
+
+    HPX_TEST_LT(std::size_t(0), migrated);
+    HPX_TEST_EQ(balancer.migrations(), migrated);
+    HPX_TEST_LT(1.0, balancer.imbalance());
+
+    // no load was generated since the last step, nothing will be migrated
+    HPX_TEST_EQ(balancer.balance().get(), std::size_t(0));
+
+    // the components have been distributed across the localities
+    std::size_t remote = 0;
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        HPX_TEST_EQ(clients[i].get_data(), static_cast<int>(i));
+        if (clients[i].call() != hpx::find_here())
+        {
+            ++remote;
+        }
+    }
+    HPX_TEST_EQ(remote, migrated);
+
+    for (test_client const& c : clients)
+    {
+        HPX_TEST(
+            hpx::components::unregister_from_load_balancing(c.get_id()).get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_migration_plan();
+
+    if (hpx::find_all_localities().size() > 1)
+    {
+        test_load_balancer();
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file distributed_work_stealing.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions_base/traits/action_is_stealable.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/async_distributed/packaged_action.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::distributed::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // A stealable task is invoked with the locality it should be executed
+        // on, an invalid id denotes the locality the task was submitted on.
+        using stealable_task =
+            hpx::move_only_function<void(hpx::id_type const&)>;
+
+        HPX_EXPORT void submit_stealable_task(stealable_task&& task);
+
+        template <typename Action, typename Result, typename... Ts>
+        struct stealable_task_impl
+        {
+            void operator()(hpx::id_type const& target)
+            {
+                if (target)
+                {
+                    // the task was stolen, the action is executed on the
+                    // thief, which sends the result back to our promise
+                    hpx::invoke_fused(
+                        [&](Ts&... vs) { p.post(target, HPX_MOVE(vs)...); },
+                        args);
+                    return;
+                }
+
+                // execute the task in place
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        auto&& f = [](Ts&... vs) -> decltype(auto) {
+                            return Action::invoke(
+                                naming::address::address_type(),
+                                naming::address::component_type(),
+                                HPX_MOVE(vs)...);
+                        };
+
+                        if constexpr (std::is_void_v<Result>)
+                        {
+                            hpx::invoke_fused(f, args);
+                            p.set_value();
+                        }
+                        else
+                        {
+                            p.set_value(hpx::invoke_fused(f, args));
+                        }
+                    },
+                    [&](std::exception_ptr ep) {
+                        p.set_exception(HPX_MOVE(ep));
+                    });
+            }
+
+            lcos::packaged_action<Action, Result> p;
+            hpx::tuple<Ts...> args;
+        };
+
+        HPX_EXPORT void start_distributed_work_stealing();
+        HPX_EXPORT void register_distributed_work_stealing_counter_types();
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Invoke the given plain action as a location-agnostic task.
+    ///
+    /// The task is queued on the current locality and is executed there
+    /// unless an idle locality steals it first. Distributed work stealing is
+    /// opt-in: localities steal only if the configuration setting
+    /// hpx.distributed_stealing.enable is set to 1. Idle localities
+    /// periodically (hpx.distributed_stealing.interval [us]) request tasks
+    /// from the peer with the longest queue. The queue lengths are
+    /// advertised by piggybacking them on the messages exchanged while
+    /// stealing. Stolen tasks are the oldest ones queued on the victim,
+    /// which for recursively spawned task trees are the largest ones.
+    ///
+    /// \tparam Action  The plain action to invoke. It must be marked as
+    ///                 stealable using \a HPX_ACTION_IS_STEALABLE and must not
+    ///                 return a future.
+    ///
+    /// \param vs       The arguments to pass to the action.
+    ///
+    /// \returns A future representing the result of the action invocation,
+    ///          wherever the action was executed.
+    ///
+    template <typename Action, typename... Ts>
+    hpx::future<
+        typename hpx::traits::extract_action_t<Action>::local_result_type>
+    async_stealable(Ts&&... vs)
+    {
+        using action_type = hpx::traits::extract_action_t<Action>;
+        using result_type = typename action_type::local_result_type;
+
+        static_assert(hpx::traits::action_is_stealable_v<action_type>,
+            "only actions marked using HPX_ACTION_IS_STEALABLE can be "
+            "invoked as stealable tasks");
+
+        detail::stealable_task_impl<action_type, result_type,
+            std::decay_t<Ts>...>
+            task{{}, hpx::tuple<std::decay_t<Ts>...>(HPX_FORWARD(Ts, vs)...)};
+
+        hpx::future<result_type> f = task.p.get_future();
+        detail::submit_stealable_task(HPX_MOVE(task));
+        return f;
+    }
+
+    /// Return the number of stealable tasks currently queued on this
+    /// locality.
+    HPX_EXPORT std::size_t get_stealable_queue_length() noexcept;
+}    // namespace hpx::distributed::experimental
+#endif
@@ -0,0 +1,315 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_balancer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components/client_base.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/get_lva.hpp>
+#include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/components_base/traits/component_supports_migration.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/naming_base/naming_base.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace hpx::components {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The load of a single component instance as sampled by the load
+    /// balancer
+    struct component_load
+    {
+        naming::gid_type id;
+
+        // (wall clock) time spent executing actions on the component since
+        // it was sampled last [ns]
+        std::uint64_t load = 0;
+
+        // number of actions executed since the component was sampled last
+        std::uint64_t invocations = 0;
+
+        // number of actions currently executing (or being scheduled) on the
+        // component, the load balancer does not migrate busy components
+        std::uint32_t pending = 0;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & id & load & invocations & pending;
+            // clang-format on
+        }
+    };
+
+    /// The load of all components registered for load balancing on a
+    /// locality
+    struct locality_load
+    {
+        std::uint32_t locality_id = naming::invalid_locality_id;
+        std::vector<component_load> components;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & locality_id & components;
+            // clang-format on
+        }
+    };
+
+    /// A single step of a migration plan
+    struct migration_step
+    {
+        naming::gid_type id;
+        std::uint32_t source = naming::invalid_locality_id;
+        std::uint32_t target = naming::invalid_locality_id;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & id & source & target;
+            // clang-format on
+        }
+    };
+
+    /// Parameters controlling the decisions of the load balancer
+    struct load_balancer_parameters
+    {
+        // migrations are planned only if the ratio of the load of the most
+        // loaded locality and the average load exceeds this value
+        double imbalance_threshold = 1.1;
+
+        // maximal number of components migrated in one balancing step
+        std::size_t max_migrations = 16;
+
+        // components with more pending actions are considered busy and are
+        // not migrated
+        std::uint32_t max_pending = 1;
+    };
+
+    /// Return the ratio of the load of the most loaded locality and the
+    /// average load of all localities (1.0 if there is no load at all).
+    HPX_EXPORT double compute_imbalance(
+        std::vector<locality_load> const& loads) noexcept;
+
+    /// Compute the components to migrate to balance the given loads. The
+    /// plan is computed greedily: the component moved next is the one that
+    /// best evens out the loads of the currently most and least loaded
+    /// localities. Busy components are left in place.
+    HPX_EXPORT std::vector<migration_step> compute_migration_plan(
+        std::vector<locality_load> const& loads,
+        load_balancer_parameters const& params = load_balancer_parameters());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // type-erased operations used by the load balancer to sample and
+        // migrate a registered component
+        struct load_balancing_vtable
+        {
+            char const* name;
+            bool (*enable)(naming::gid_type const&, naming::address_type, bool);
+            bool (*sample)(naming::gid_type const&, naming::address_type,
+                component_load&);
+            hpx::future<hpx::id_type> (*migrate)(
+                hpx::id_type const&, hpx::id_type const&);
+        };
+
+        HPX_EXPORT void register_load_balancing_type(
+            load_balancing_vtable const* vtable);
+
+        HPX_EXPORT hpx::future<void> register_for_load_balancing(
+            hpx::id_type const& id, load_balancing_vtable const* vtable);
+
+        template <typename Component>
+        struct load_balancing_type
+        {
+            static_assert(
+                traits::component_supports_migration<Component>::call(),
+                "only components supporting migration can be balanced");
+
+            // start or stop collecting the load statistics of a registered
+            // component, fails if the object was migrated in the meantime
+            static bool enable(naming::gid_type const& id,
+                naming::address_type lva, bool enable)
+            {
+                auto const r = Component::was_object_migrated(id, lva);
+                if (r.first)
+                {
+                    return false;
+                }
+
+                get_lva<Component>::call(lva)->enable_load_statistics(enable);
+                return true;
+            }
+
+            static bool sample(naming::gid_type const& id,
+                naming::address_type lva, component_load& load)
+            {
+                // pin the object while sampling, this fails if the object
+                // was migrated in the meantime
+                auto const r = Component::was_object_migrated(id, lva);
+                if (r.first)
+                {
+                    return false;
+                }
+
+                auto* p = get_lva<Component>::call(lva);
+                auto const stats = p->load_statistics(true);
+
+                load.id = id;
+                load.load = stats.busy_time;
+                load.invocations = stats.invocations;
+
+                // don't account for the pin acquired above
+                std::uint32_t const pin_count = p->pin_count();
+                load.pending = pin_count != 0 ? pin_count - 1 : 0;
+                return true;
+            }
+
+            static hpx::future<hpx::id_type> migrate(
+                hpx::id_type const& id, hpx::id_type const& target)
+            {
+                return components::migrate<Component>(id, target);
+            }
+
+            static load_balancing_vtable const* get_vtable()
+            {
+                static load_balancing_vtable const vtable = {
+                    typeid(Component).name(), &enable, &sample, &migrate};
+                return &vtable;
+            }
+
+            // all localities run the same executable, this makes sure the
+            // type is known everywhere the components might be migrated to
+            struct registration
+            {
+                registration()
+                {
+                    register_load_balancing_type(get_vtable());
+                }
+            };
+            static registration instance;
+        };
+
+        template <typename Component>
+        typename load_balancing_type<Component>::registration
+            load_balancing_type<Component>::instance;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Register the given component instance with the load balancer. The
+    /// component will be considered for migration by all load balancing
+    /// steps until it is unregistered. The load balancer holds a reference
+    /// to the component, which keeps it alive while it is registered.
+    ///
+    /// \tparam  Component     Specifies the (server) component type of the
+    ///                        component, it must support migration.
+    ///
+    /// \param id              [in] The global id of the component instance.
+    ///
+    /// \returns A future that becomes ready once the component was
+    ///          registered.
+    ///
+    template <typename Component>
+    hpx::future<void> register_for_load_balancing(hpx::id_type const& id)
+    {
+        (void) &detail::load_balancing_type<Component>::instance;
+        return detail::register_for_load_balancing(
+            id, detail::load_balancing_type<Component>::get_vtable());
+    }
+
+    /// \copydoc register_for_load_balancing(hpx::id_type const&)
+    template <typename Derived, typename Stub, typename Data>
+    hpx::future<void> register_for_load_balancing(
+        client_base<Derived, Stub, Data> const& c)
+    {
+        using component_type =
+            typename client_base<Derived, Stub, Data>::server_component_type;
+        return register_for_load_balancing<component_type>(c.get_id());
+    }
+
+    /// Remove the given component instance from the load balancer and
+    /// release the reference held by it. The returned future holds false if
+    /// the component was not found, e.g. because it is being migrated by
+    /// the load balancer at this point.
+    HPX_EXPORT hpx::future<bool> unregister_from_load_balancing(
+        hpx::id_type const& id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The load balancer periodically samples the load caused by the
+    /// components registered for load balancing on all localities, computes
+    /// a migration plan (see \a compute_migration_plan), and migrates the
+    /// selected components in bulk. The load of a component is the (wall
+    /// clock) time spent executing actions on it since it was sampled last,
+    /// i.e. the load balancer reacts to the load observed during the last
+    /// balancing interval.
+    ///
+    /// The number of performed migrations and the current imbalance are
+    /// exposed as the performance counters
+    /// /load_balancer{locality#N/total}/count/migrations and
+    /// /load_balancer{locality#N/total}/imbalance.
+    class HPX_EXPORT load_balancer
+    {
+    public:
+        explicit load_balancer(load_balancer_parameters const& params =
+                load_balancer_parameters());
+
+        load_balancer(load_balancer const&) = delete;
+        load_balancer(load_balancer&&) = delete;
+        load_balancer& operator=(load_balancer const&) = delete;
+        load_balancer& operator=(load_balancer&&) = delete;
+
+        ~load_balancer();
+
+        /// Perform one load balancing step, return the number of migrated
+        /// components.
+        hpx::future<std::size_t> balance();
+
+        /// Start performing load balancing steps in regular intervals.
+        void start(hpx::chrono::steady_duration const& interval);
+
+        /// Stop performing load balancing steps.
+        void stop();
+
+        /// Return the imbalance (see \a compute_imbalance) observed during the
+        /// last load balancing step.
+        [[nodiscard]] double imbalance() const noexcept;
+
+        /// Return the number of migrations performed by this load balancer.
+        [[nodiscard]] std::size_t migrations() const noexcept;
+
+    private:
+        struct data;
+        std::shared_ptr<data> data_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        HPX_EXPORT void register_load_balancer_counter_types();
+    }    // namespace detail
+    /// \endcond
+}    // namespace hpx::components
+#endif
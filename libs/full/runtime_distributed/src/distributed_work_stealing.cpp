@@ -0,0 +1,336 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_local/post.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime_distributed/distributed_work_stealing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/get_num_all_localities.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/from_string.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed::experimental::detail {
+
+    namespace {
+
+        // maximal number of timer ticks skipped after unsuccessful attempts
+        // to steal from peers which did not advertise any work
+        constexpr std::uint32_t max_backoff = 64;
+
+        struct work_stealing_data
+        {
+            // the stealable tasks submitted on this locality, new tasks are
+            // added at the end
+            hpx::spinlock mtx_;
+            std::deque<stealable_task> queue_;
+            std::atomic<std::size_t> queue_length_ = 0;
+
+            // the queue lengths last advertised by the other localities
+            hpx::spinlock loads_mtx_;
+            std::vector<std::size_t> loads_;
+            std::uint32_t next_probe_ = 0;
+            std::uint32_t backoff_ = 0;
+            std::uint32_t skip_ = 0;
+
+            std::atomic<bool> steal_pending_ = false;
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+
+            // performance counter data
+            std::atomic<std::int64_t> stolen_ = 0;
+            std::atomic<std::int64_t> steal_requests_ = 0;
+        };
+
+        work_stealing_data& get_data()
+        {
+            static work_stealing_data data;
+            return data;
+        }
+
+        // execute the most recently submitted task on this locality, the
+        // task might have been stolen in the meantime
+        void run_local_task()
+        {
+            auto& data = get_data();
+
+            stealable_task task;
+            {
+                std::lock_guard l(data.mtx_);
+                if (data.queue_.empty())
+                {
+                    return;
+                }
+
+                task = HPX_MOVE(data.queue_.back());
+                data.queue_.pop_back();
+                data.queue_length_.store(
+                    data.queue_.size(), std::memory_order_relaxed);
+            }
+
+            task(hpx::invalid_id);
+        }
+
+        void update_load(std::uint32_t locality_id, std::size_t length)
+        {
+            auto& data = get_data();
+
+            std::lock_guard l(data.loads_mtx_);
+            if (locality_id < data.loads_.size())
+            {
+                data.loads_[locality_id] = length;
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void submit_stealable_task(stealable_task&& task)
+    {
+        auto& data = get_data();
+        {
+            std::lock_guard l(data.mtx_);
+            data.queue_.push_back(HPX_MOVE(task));
+            data.queue_length_.store(
+                data.queue_.size(), std::memory_order_relaxed);
+        }
+
+        // every submitted task is matched by one local HPX thread, this
+        // makes sure all tasks that were not stolen will be executed
+        hpx::post(&run_local_task);
+    }
+
+    // Invoked on the victim, hands out the oldest (at most half of the)
+    // queued tasks to the thief. Returns the number of tasks remaining in
+    // the queue of the victim.
+    std::size_t steal_stealable_tasks(
+        std::uint32_t thief, std::size_t thief_length, std::size_t count)
+    {
+        auto& data = get_data();
+        update_load(thief, thief_length);
+
+        std::vector<stealable_task> stolen;
+        std::size_t remaining = 0;
+        {
+            std::lock_guard l(data.mtx_);
+
+            std::size_t const n =
+                (std::min)(count, (data.queue_.size() + 1) / 2);
+            stolen.reserve(n);
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                stolen.push_back(HPX_MOVE(data.queue_.front()));
+                data.queue_.pop_front();
+            }
+
+            remaining = data.queue_.size();
+            data.queue_length_.store(remaining, std::memory_order_relaxed);
+        }
+
+        if (!stolen.empty())
+        {
+            data.stolen_.fetch_add(static_cast<std::int64_t>(stolen.size()),
+                std::memory_order_relaxed);
+
+            hpx::id_type const target = naming::get_id_from_locality_id(thief);
+            for (stealable_task& task : stolen)
+            {
+                task(target);
+            }
+        }
+
+        return remaining;
+    }
+}    // namespace hpx::distributed::experimental::detail
+
+HPX_PLAIN_ACTION(
+    hpx::distributed::experimental::detail::steal_stealable_tasks,
+    distributed_work_stealing_steal_action)
+
+namespace hpx::distributed::experimental {
+
+    namespace detail {
+
+        namespace {
+
+            // a locality is idle if it has no stealable tasks queued and no
+            // HPX threads waiting to be executed
+            bool is_idle()
+            {
+                return get_data().queue_length_.load(
+                           std::memory_order_relaxed) == 0 &&
+                    hpx::threads::get_thread_count(
+                        threads::thread_schedule_state::pending) == 0 &&
+                    hpx::threads::get_thread_count(
+                        threads::thread_schedule_state::staged) == 0;
+            }
+
+            // select the locality advertising the longest queue, probe the
+            // localities round-robin if none advertised any work
+            std::uint32_t select_victim(std::uint32_t here)
+            {
+                auto& data = get_data();
+
+                std::lock_guard l(data.loads_mtx_);
+
+                auto const num_localities =
+                    static_cast<std::uint32_t>(data.loads_.size());
+                if (num_localities < 2)
+                {
+                    return naming::invalid_locality_id;
+                }
+
+                auto const it =
+                    std::max_element(data.loads_.begin(), data.loads_.end());
+                if (*it != 0)
+                {
+                    data.backoff_ = 0;
+                    return static_cast<std::uint32_t>(
+                        std::distance(data.loads_.begin(), it));
+                }
+
+                // back off exponentially while no work can be found
+                if (data.skip_ != 0)
+                {
+                    --data.skip_;
+                    return naming::invalid_locality_id;
+                }
+                data.skip_ = data.backoff_;
+                data.backoff_ = (std::min)(
+                    max_backoff, data.backoff_ == 0 ? 1 : 2 * data.backoff_);
+
+                data.next_probe_ = (data.next_probe_ + 1) % num_localities;
+                if (data.next_probe_ == here)
+                {
+                    data.next_probe_ = (data.next_probe_ + 1) % num_localities;
+                }
+                return data.next_probe_;
+            }
+
+            bool try_steal()
+            {
+                auto& data = get_data();
+                if (!is_idle() || data.steal_pending_.exchange(true))
+                {
+                    return true;
+                }
+
+                std::uint32_t const here = hpx::get_locality_id();
+                std::uint32_t const victim = select_victim(here);
+                if (victim == naming::invalid_locality_id)
+                {
+                    data.steal_pending_.store(false);
+                    return true;
+                }
+
+                data.steal_requests_.fetch_add(1, std::memory_order_relaxed);
+
+                // the victim sends the stolen tasks directly to us, the
+                // reply carries its remaining queue length only
+                hpx::async(distributed_work_stealing_steal_action(),
+                    naming::get_id_from_locality_id(victim), here,
+                    data.queue_length_.load(std::memory_order_relaxed),
+                    hpx::get_num_worker_threads())
+                    .then(hpx::launch::sync,
+                        [victim](hpx::future<std::size_t>&& f) {
+                            update_load(victim, f.has_value() ? f.get() : 0);
+                            get_data().steal_pending_.store(false);
+                        });
+
+                return true;
+            }
+        }    // namespace
+
+        void start_distributed_work_stealing()
+        {
+            if (hpx::get_config_entry("hpx.distributed_stealing.enable", "0") !=
+                "1")
+            {
+                return;
+            }
+
+            auto& data = get_data();
+            {
+                std::lock_guard l(data.loads_mtx_);
+                data.loads_.assign(hpx::get_initial_num_localities(), 0);
+                data.next_probe_ = hpx::get_locality_id();
+                data.backoff_ = 0;
+                data.skip_ = 0;
+            }
+
+            if (data.loads_.size() < 2)
+            {
+                return;
+            }
+
+            std::int64_t const interval =
+                hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+                    "hpx.distributed_stealing.interval", "1000"));
+
+            data.timer_ = std::make_unique<hpx::util::interval_timer>(
+                &try_steal, interval, "hpx::distributed_work_stealing", true);
+            data.timer_->start(false);
+
+            hpx::register_shutdown_function(
+                []() { get_data().timer_.reset(); });
+        }
+
+        void register_distributed_work_stealing_counter_types()
+        {
+            performance_counters::install_counter_type(
+                "/distributed_stealing/count/stolen",
+                [](bool reset) {
+                    return hpx::util::get_and_reset_value(
+                        get_data().stolen_, reset);
+                },
+                "returns the number of stealable tasks stolen from this "
+                "locality by other localities");
+
+            performance_counters::install_counter_type(
+                "/distributed_stealing/count/steal-requests",
+                [](bool reset) {
+                    return hpx::util::get_and_reset_value(
+                        get_data().steal_requests_, reset);
+                },
+                "returns the number of steal requests sent by this locality");
+
+            performance_counters::install_counter_type(
+                "/distributed_stealing/queue-length",
+                [](bool) {
+                    return static_cast<std::int64_t>(
+                        get_data().queue_length_.load(
+                            std::memory_order_relaxed));
+                },
+                "returns the number of stealable tasks currently queued on "
+                "this locality");
+        }
+    }    // namespace detail
+
+    std::size_t get_stealable_queue_length() noexcept
+    {
+        return detail::get_data().queue_length_.load(
+            std::memory_order_relaxed);
+    }
+}    // namespace hpx::distributed::experimental
@@ -0,0 +1,617 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_colocated/get_colocation_id.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading/thread.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::components {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::uint64_t total_load(locality_load const& l) noexcept
+        {
+            std::uint64_t result = 0;
+            for (component_load const& c : l.components)
+            {
+                result += c.load;
+            }
+            return result;
+        }
+    }    // namespace
+
+    double compute_imbalance(std::vector<locality_load> const& loads) noexcept
+    {
+        if (loads.empty())
+        {
+            return 1.0;
+        }
+
+        std::uint64_t sum = 0;
+        std::uint64_t max_load = 0;
+        for (locality_load const& l : loads)
+        {
+            std::uint64_t const load = total_load(l);
+            sum += load;
+            max_load = (std::max)(max_load, load);
+        }
+
+        if (sum == 0)
+        {
+            return 1.0;
+        }
+
+        double const mean =
+            static_cast<double>(sum) / static_cast<double>(loads.size());
+        return static_cast<double>(max_load) / mean;
+    }
+
+    std::vector<migration_step> compute_migration_plan(
+        std::vector<locality_load> const& loads,
+        load_balancer_parameters const& params)
+    {
+        std::vector<migration_step> plan;
+
+        std::size_t const num_localities = loads.size();
+        if (num_localities < 2)
+        {
+            return plan;
+        }
+
+        // the components that may be migrated, per locality
+        std::vector<std::uint64_t> totals(num_localities, 0);
+        std::vector<std::vector<component_load const*>> candidates(
+            num_localities);
+
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i != num_localities; ++i)
+        {
+            totals[i] = total_load(loads[i]);
+            sum += totals[i];
+
+            for (component_load const& c : loads[i].components)
+            {
+                if (c.load != 0 && c.pending <= params.max_pending)
+                {
+                    candidates[i].push_back(&c);
+                }
+            }
+        }
+
+        if (sum == 0)
+        {
+            return plan;
+        }
+
+        double const mean =
+            static_cast<double>(sum) / static_cast<double>(num_localities);
+
+        while (plan.size() < params.max_migrations)
+        {
+            auto const [min_it, max_it] =
+                std::minmax_element(totals.begin(), totals.end());
+            std::size_t const source = max_it - totals.begin();
+            std::size_t const target = min_it - totals.begin();
+
+            if (static_cast<double>(*max_it) <=
+                mean * params.imbalance_threshold)
+            {
+                break;
+            }
+
+            // moving a component with a load smaller than the difference of
+            // the loads reduces the maximum of both loads, a load of half the
+            // difference evens them out
+            std::uint64_t const diff = *max_it - *min_it;
+
+            auto& source_candidates = candidates[source];
+            auto best = source_candidates.end();
+            std::uint64_t best_distance =
+                (std::numeric_limits<std::uint64_t>::max)();
+            for (auto it = source_candidates.begin();
+                 it != source_candidates.end(); ++it)
+            {
+                std::uint64_t const load = (*it)->load;
+                if (load >= diff)
+                {
+                    continue;
+                }
+
+                std::uint64_t const distance =
+                    load > diff / 2 ? load - diff / 2 : diff / 2 - load;
+                if (distance < best_distance)
+                {
+                    best = it;
+                    best_distance = distance;
+                }
+            }
+
+            if (best == source_candidates.end())
+            {
+                break;    // nothing left to improve the balance
+            }
+
+            std::uint64_t const load = (*best)->load;
+            plan.push_back(migration_step{(*best)->id,
+                loads[source].locality_id, loads[target].locality_id});
+
+            totals[source] -= load;
+            totals[target] += load;
+
+            // never move a component more than once during one step
+            source_candidates.erase(best);
+        }
+
+        return plan;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        namespace {
+
+            // all component types known to the load balancer
+            struct load_balancing_types
+            {
+                std::mutex mtx_;
+                std::map<std::string, load_balancing_vtable const*> types_;
+            };
+
+            load_balancing_types& get_load_balancing_types()
+            {
+                static load_balancing_types types;
+                return types;
+            }
+
+            load_balancing_vtable const* find_load_balancing_type(
+                std::string const& name)
+            {
+                auto& types = get_load_balancing_types();
+
+                std::lock_guard l(types.mtx_);
+                auto const it = types.types_.find(name);
+                return it != types.types_.end() ? it->second : nullptr;
+            }
+
+            // all components registered for load balancing that are located
+            // on this locality
+            struct registered_component
+            {
+                hpx::id_type id;
+                naming::address_type lva;
+                load_balancing_vtable const* vtable;
+            };
+
+            struct load_balancing_registry
+            {
+                hpx::spinlock mtx_;
+                std::unordered_map<naming::gid_type, registered_component>
+                    components_;
+            };
+
+            load_balancing_registry& get_load_balancing_registry()
+            {
+                static load_balancing_registry registry;
+                return registry;
+            }
+
+            // values exposed as performance counters
+            std::atomic<std::int64_t> migrations_count(0);
+            std::atomic<std::int64_t> imbalance_value(0);    // [0.01%]
+
+            // Wait for the given (re-)registrations to finish. A component
+            // whose registration failed drops out of load balancing, this is
+            // reported but doesn't fail the load balancing step.
+            void wait_for_registrations(
+                std::vector<hpx::future<void>>& registered)
+            {
+                hpx::wait_all(registered);
+                for (hpx::future<void>& f : registered)
+                {
+                    if (f.has_exception())
+                    {
+                        LRT_(warning).format("load_balancer: {}",
+                            hpx::get_error_what(f.get_exception_ptr()));
+                    }
+                }
+            }
+        }    // namespace
+
+        void register_load_balancing_type(load_balancing_vtable const* vtable)
+        {
+            auto& types = get_load_balancing_types();
+
+            std::lock_guard l(types.mtx_);
+            types.types_.emplace(vtable->name, vtable);
+        }
+
+        // Add the given component to the registry of this locality, returns
+        // false if the component is not located here (anymore).
+        bool add_balanced_component(
+            hpx::id_type const& id, std::string const& type_name)
+        {
+            load_balancing_vtable const* vtable =
+                find_load_balancing_type(type_name);
+            if (vtable == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_component_type,
+                    "hpx::components::detail::add_balanced_component",
+                    "component type {} is unknown to the load balancer",
+                    type_name);
+            }
+
+            naming::address const addr = agas::resolve(launch::sync, id);
+            if (addr.locality_ != agas::get_locality() ||
+                !vtable->enable(id.get_gid(), addr.address_, true))
+            {
+                return false;
+            }
+
+            auto& registry = get_load_balancing_registry();
+
+            std::lock_guard l(registry.mtx_);
+            registry.components_.insert_or_assign(id.get_gid(),
+                registered_component{id, addr.address_, vtable});
+            return true;
+        }
+
+        bool remove_balanced_component(hpx::id_type const& id)
+        {
+            auto& registry = get_load_balancing_registry();
+
+            registered_component c;
+            {
+                std::lock_guard l(registry.mtx_);
+
+                auto const it = registry.components_.find(id.get_gid());
+                if (it == registry.components_.end())
+                {
+                    return false;
+                }
+                c = HPX_MOVE(it->second);
+                registry.components_.erase(it);
+            }
+
+            // stop collecting statistics, nothing to do if the component was
+            // migrated in the meantime
+            c.vtable->enable(c.id.get_gid(), c.lva, false);
+            return true;
+        }
+
+        // Sample the loads of all components registered on this locality
+        std::vector<component_load> sample_balanced_components()
+        {
+            auto& registry = get_load_balancing_registry();
+
+            std::vector<registered_component> components;
+            {
+                std::lock_guard l(registry.mtx_);
+
+                components.reserve(registry.components_.size());
+                for (auto const& p : registry.components_)
+                {
+                    components.push_back(p.second);
+                }
+            }
+
+            std::vector<component_load> loads;
+            std::vector<hpx::future<void>> registered;
+            loads.reserve(components.size());
+            for (registered_component const& c : components)
+            {
+                component_load load;
+                if (c.vtable->sample(c.id.get_gid(), c.lva, load))
+                {
+                    loads.push_back(load);
+                    continue;
+                }
+
+                // the component was migrated by somebody else, move its
+                // registration to its new location
+                {
+                    std::lock_guard l(registry.mtx_);
+                    registry.components_.erase(c.id.get_gid());
+                }
+                registered.push_back(
+                    register_for_load_balancing(c.id, c.vtable));
+            }
+
+            wait_for_registrations(registered);
+            return loads;
+        }
+
+        // Migrate the given components away from this locality, returns the
+        // number of successfully migrated components
+        std::size_t migrate_balanced_components(
+            std::vector<migration_step> const& steps)
+        {
+            auto& registry = get_load_balancing_registry();
+
+            std::vector<registered_component> components;
+            std::vector<hpx::future<hpx::id_type>> migrated;
+            components.reserve(steps.size());
+            migrated.reserve(steps.size());
+
+            for (migration_step const& step : steps)
+            {
+                {
+                    std::lock_guard l(registry.mtx_);
+
+                    auto const it = registry.components_.find(step.id);
+                    if (it == registry.components_.end())
+                    {
+                        continue;    // unregistered in the meantime
+                    }
+                    components.push_back(HPX_MOVE(it->second));
+                    registry.components_.erase(it);
+                }
+
+                registered_component const& c = components.back();
+                migrated.push_back(c.vtable->migrate(
+                    c.id, naming::get_id_from_locality_id(step.target)));
+            }
+
+            hpx::wait_all(migrated);
+
+            std::size_t count = 0;
+            std::vector<hpx::future<void>> registered;
+            registered.reserve(components.size());
+            for (std::size_t i = 0; i != components.size(); ++i)
+            {
+                // a failed migration leaves the component in place, the
+                // (updated) registration will find it wherever it is
+                if (!migrated[i].has_exception())
+                {
+                    ++count;
+                }
+                registered.push_back(register_for_load_balancing(
+                    components[i].id, components[i].vtable));
+            }
+
+            wait_for_registrations(registered);
+
+            migrations_count.fetch_add(
+                static_cast<std::int64_t>(count), std::memory_order_relaxed);
+            return count;
+        }
+    }    // namespace detail
+}    // namespace hpx::components
+
+HPX_PLAIN_ACTION(hpx::components::detail::add_balanced_component,
+    load_balancer_add_component_action)
+HPX_PLAIN_ACTION(hpx::components::detail::remove_balanced_component,
+    load_balancer_remove_component_action)
+HPX_PLAIN_ACTION(hpx::components::detail::sample_balanced_components,
+    load_balancer_sample_action)
+HPX_PLAIN_ACTION(hpx::components::detail::migrate_balanced_components,
+    load_balancer_migrate_action)
+
+namespace hpx::components {
+
+    namespace detail {
+
+        hpx::future<void> register_for_load_balancing(
+            hpx::id_type const& id, load_balancing_vtable const* vtable)
+        {
+            // the component might be migrated concurrently, retry (with
+            // exponential backoff) until it was registered on the locality it
+            // is located on
+            return hpx::async([id, name = std::string(vtable->name)]() {
+                constexpr int max_attempts = 10;
+                std::chrono::milliseconds delay(1);
+                for (int attempt = 0; attempt != max_attempts; ++attempt)
+                {
+                    if (hpx::async(load_balancer_add_component_action(),
+                            hpx::get_colocation_id(launch::sync, id), id, name)
+                            .get())
+                    {
+                        return;
+                    }
+
+                    hpx::this_thread::sleep_for(delay);
+                    delay *= 2;
+                }
+
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "hpx::components::detail::register_for_load_balancing",
+                    "could not register component {} for load balancing, it "
+                    "kept moving for {} attempts",
+                    id, max_attempts);
+            });
+        }
+
+        void register_load_balancer_counter_types()
+        {
+            performance_counters::install_counter_type(
+                "/load_balancer/count/migrations",
+                [](bool reset) {
+                    return hpx::util::get_and_reset_value(
+                        migrations_count, reset);
+                },
+                "returns the number of components migrated away from this "
+                "locality by the load balancer");
+
+            performance_counters::install_counter_type(
+                "/load_balancer/imbalance",
+                [](bool) {
+                    return imbalance_value.load(std::memory_order_relaxed);
+                },
+                "returns the ratio of the load of the most loaded locality "
+                "and the average load of all localities as observed by the "
+                "last load balancing step performed on this locality",
+                "0.01%");
+        }
+    }    // namespace detail
+
+    hpx::future<bool> unregister_from_load_balancing(hpx::id_type const& id)
+    {
+        return hpx::get_colocation_id(id).then(
+            [id](hpx::future<hpx::id_type>&& f) {
+                return hpx::async(
+                    load_balancer_remove_component_action(), f.get(), id);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct load_balancer::data
+    {
+        explicit data(load_balancer_parameters const& params)
+          : params_(params)
+        {
+        }
+
+        std::size_t balance()
+        {
+            // don't run overlapping balancing steps
+            std::lock_guard l(mtx_);
+
+            std::vector<hpx::id_type> const localities =
+                hpx::find_all_localities();
+
+            std::vector<hpx::future<std::vector<component_load>>> samples;
+            samples.reserve(localities.size());
+            for (hpx::id_type const& locality : localities)
+            {
+                samples.push_back(
+                    hpx::async(load_balancer_sample_action(), locality));
+            }
+
+            std::vector<locality_load> loads(localities.size());
+            for (std::size_t i = 0; i != localities.size(); ++i)
+            {
+                loads[i].locality_id =
+                    naming::get_locality_id_from_id(localities[i]);
+                loads[i].components = samples[i].get();
+            }
+
+            double const imbalance = compute_imbalance(loads);
+            imbalance_.store(imbalance, std::memory_order_relaxed);
+            detail::imbalance_value.store(
+                static_cast<std::int64_t>(imbalance * 10000.0),
+                std::memory_order_relaxed);
+
+            // migrate the selected components, one bulk operation per source
+            // locality
+            std::map<std::uint32_t, std::vector<migration_step>> plan;
+            for (migration_step const& step :
+                compute_migration_plan(loads, params_))
+            {
+                plan[step.source].push_back(step);
+            }
+
+            std::vector<hpx::future<std::size_t>> migrated;
+            migrated.reserve(plan.size());
+            for (auto& p : plan)
+            {
+                migrated.push_back(hpx::async(load_balancer_migrate_action(),
+                    naming::get_id_from_locality_id(p.first),
+                    HPX_MOVE(p.second)));
+            }
+
+            std::size_t count = 0;
+            for (auto& f : migrated)
+            {
+                count += f.get();
+            }
+
+            migrations_.fetch_add(count, std::memory_order_relaxed);
+            return count;
+        }
+
+        load_balancer_parameters const params_;
+        hpx::mutex mtx_;
+        std::atomic<double> imbalance_ = 1.0;
+        std::atomic<std::size_t> migrations_ = 0;
+        std::unique_ptr<hpx::util::interval_timer> timer_;
+    };
+
+    load_balancer::load_balancer(load_balancer_parameters const& params)
+      : data_(std::make_shared<data>(params))
+    {
+    }
+
+    load_balancer::~load_balancer()
+    {
+        stop();
+    }
+
+    hpx::future<std::size_t> load_balancer::balance()
+    {
+        return hpx::async([data = data_]() { return data->balance(); });
+    }
+
+    void load_balancer::start(hpx::chrono::steady_duration const& interval)
+    {
+        stop();
+
+        // the timer must not keep the load balancer alive
+        std::weak_ptr<data> weak_data = data_;
+        data_->timer_ = std::make_unique<hpx::util::interval_timer>(
+            [weak_data]() -> bool {
+                auto const data = weak_data.lock();
+                if (!data)
+                {
+                    return false;
+                }
+                data->balance();
+                return true;
+            },
+            interval, "hpx::components::load_balancer", true);
+
+        data_->timer_->start(false);
+    }
+
+    void load_balancer::stop()
+    {
+        if (data_->timer_)
+        {
+            data_->timer_->stop();
+            data_->timer_.reset();
+        }
+    }
+
+    double load_balancer::imbalance() const noexcept
+    {
+        return data_->imbalance_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t load_balancer::migrations() const noexcept
+    {
+        return data_->migrations_.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::components
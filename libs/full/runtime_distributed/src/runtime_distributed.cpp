@@ -45,8 +45,10 @@
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
+#include <hpx/runtime_distributed/distributed_work_stealing.hpp>
 #include <hpx/runtime_distributed/find_localities.hpp>
 #include <hpx/runtime_distributed/get_num_localities.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
 #include <hpx/runtime_distributed/server/runtime_support.hpp>
@@ -63,6 +65,7 @@
 #include <hpx/thread_support/set_thread_name.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -383,6 +386,10 @@ namespace hpx {
                     "complete";
             set_state(hpx::state::running);
 
+            // start stealing tasks from other localities, if enabled
+            distributed::experimental::detail::
+                start_distributed_work_stealing();
+
 #if defined(HPX_HAVE_NETWORKING)
             parcel_handler_.enable_alternative_parcelports();
 #endif
@@ -866,6 +873,10 @@ namespace hpx {
     {
         if (active_counters_)
             active_counters_->reset_counters(ec);
+
+        // have the task events collected so far written as well
+        if (threads::tracing::enabled())
+            threads::tracing::request_dump();
     }
 
     void runtime_distributed::reinit_active_counters(
@@ -1249,6 +1260,10 @@ namespace hpx {
             };
         performance_counters::install_counter_types(
             arithmetic_counter_types, std::size(arithmetic_counter_types));
+
+        components::detail::register_load_balancer_counter_types();
+        distributed::experimental::detail::
+            register_distributed_work_stealing_counter_types();
     }
 
     ///////////////////////////////////////////////////////////////////////////
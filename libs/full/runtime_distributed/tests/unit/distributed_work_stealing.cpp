@@ -0,0 +1,124 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+// keep the executing core busy, this makes sure the locality submitting the
+// tasks can't execute all of them concurrently
+std::uint32_t work(std::uint32_t delay_ms)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+        std::chrono::milliseconds(delay_ms))
+    {
+    }
+    return hpx::get_locality_id();
+}
+
+HPX_PLAIN_ACTION(work, work_action)
+HPX_ACTION_IS_STEALABLE(work_action)
+
+void throw_error()
+{
+    throw std::runtime_error("throw_error");
+}
+
+HPX_PLAIN_ACTION(throw_error, throw_error_action)
+HPX_ACTION_IS_STEALABLE(throw_error_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stealable_tasks()
+{
+    using hpx::distributed::experimental::async_stealable;
+
+    std::vector<hpx::future<std::uint32_t>> results;
+    results.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        results.push_back(async_stealable<work_action>(std::uint32_t(10)));
+    }
+
+    std::size_t remote = 0;
+    for (auto& f : results)
+    {
+        if (f.get() != hpx::get_locality_id())
+        {
+            ++remote;
+        }
+    }
+
+    HPX_TEST_EQ(hpx::distributed::experimental::get_stealable_queue_length(),
+        std::size_t(0));
+
+    // idle localities have stolen some of the tasks
+    if (hpx::get_num_localities(hpx::launch::sync) > 1)
+    {
+        HPX_TEST_LT(std::size_t(0), remote);
+    }
+}
+
+void test_stealable_exceptions()
+{
+    using hpx::distributed::experimental::async_stealable;
+
+    std::vector<hpx::future<void>> results;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        results.push_back(async_stealable<throw_error_action>());
+    }
+
+    for (auto& f : results)
+    {
+        bool caught_exception = false;
+        try
+        {
+            f.get();
+            HPX_TEST(false);
+        }
+        catch (std::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    test_stealable_tasks();
+    test_stealable_exceptions();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.distributed_stealing.enable=1",
+        "hpx.distributed_stealing.interval=100"};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,220 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the overheads of publishing performance counters
+// into shared memory (--hpx:export-counter) with periodically printing them
+// (--hpx:print-counter with --hpx:print-counter-interval). It measures the
+// time of a task based workload while the counters are sampled in the
+// background, the cost of a single sampling round, and the cost of reading
+// all values from the shared memory segment as an external agent would.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && !defined(HPX_WINDOWS)
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/counter_export_layout.hpp>
+#include <hpx/performance_counters/export_counters.hpp>
+#include <hpx/performance_counters/query_counters.hpp>
+
+#include "worker_timed.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace layout = hpx::performance_counters::counter_export;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t delay_ns = 0;
+
+void test_func()
+{
+    worker_timed(delay_ns);
+}
+
+// returns the time per task [s]
+double measure_tasks(std::size_t num_tasks, std::size_t repetitions)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t r = 0; r != repetitions; ++r)
+    {
+        for (std::size_t i = 0; i != num_tasks; ++i)
+            tasks.push_back(hpx::async(&test_func));
+
+        hpx::wait_all(tasks);
+        tasks.clear();
+    }
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(end - start) / 1e9 /
+        static_cast<double>(num_tasks * repetitions);
+}
+
+// returns the time per invocation of f [s]
+template <typename F>
+double measure_rounds(std::size_t rounds, F&& f)
+{
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != rounds; ++i)
+        f();
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(end - start) / 1e9 /
+        static_cast<double>(rounds);
+}
+
+// returns the time needed to read all values from the segment [s]
+double measure_reader(std::string const& name, std::size_t rounds)
+{
+    int const fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1)
+        return 0.0;
+
+    struct stat st = {};
+    ::fstat(fd, &st);
+    auto const size = static_cast<std::size_t>(st.st_size);
+    void* p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        return 0.0;
+
+    auto const* data = static_cast<char const*>(p);
+    auto const& header = *reinterpret_cast<layout::segment_header const*>(data);
+    auto const* values = reinterpret_cast<layout::value_entry const*>(
+        data + header.values_offset);
+
+    double sum = 0.0;
+    double const t = measure_rounds(rounds, [&] {
+        for (std::uint32_t i = 0; i != header.num_counters; ++i)
+            sum += layout::get_value(layout::read(values[i]));
+    });
+
+    ::munmap(p, size);
+
+    // make sure the reads are not optimized away
+    return sum != -1.0 ? t : 0.0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
+    std::size_t const rounds = vm["rounds"].as<std::size_t>();
+    auto const interval =
+        static_cast<std::int64_t>(vm["interval"].as<std::size_t>());
+    std::string const destination = vm["print-destination"].as<std::string>();
+    std::vector<std::string> const counters =
+        vm["counter"].as<std::vector<std::string>>();
+
+    // workload without sampling any counters
+    double const baseline = measure_tasks(num_tasks, repetitions);
+
+    // workload while printing the counters periodically
+    double print_time = 0.0;
+    double print_round = 0.0;
+    {
+        hpx::util::query_counters qc(counters, {}, interval, destination,
+            "normal", {}, false, true, false);
+        qc.start();
+        print_time = measure_tasks(num_tasks, repetitions);
+        print_round = measure_rounds(rounds, [&] { qc.evaluate(true); });
+        qc.stop_evaluating_counters(true);
+    }
+
+    // workload while exporting the counters periodically
+    double export_time = 0.0;
+    double export_round = 0.0;
+    double read_round = 0.0;
+    std::size_t num_counters = 0;
+    {
+        hpx::util::export_counters ec(
+            counters, interval, "/counter_export_overheads.{pid}");
+        ec.start();
+        num_counters = ec.size();
+        export_time = measure_tasks(num_tasks, repetitions);
+        export_round = measure_rounds(rounds, [&] { ec.evaluate(); });
+        read_round = measure_reader(ec.get_segment_name(), rounds);
+        ec.stop();
+    }
+
+    std::cout << "Number of counters: " << num_counters << "\n"
+              << "Time per task, no counters:        " << baseline << " [s]\n"
+              << "Time per task, printing counters:  " << print_time
+              << " [s]\n"
+              << "Time per task, exporting counters: " << export_time
+              << " [s]\n"
+              << "Time per sampling round, printing:  " << print_round * 1e6
+              << " [us]\n"
+              << "Time per sampling round, exporting: " << export_round * 1e6
+              << " [us]\n"
+              << "Time per read of all values (external reader): "
+              << read_round * 1e6 << " [us]" << std::endl;
+
+    hpx::util::print_cdash_timing("CounterPrintTask", print_time);
+    hpx::util::print_cdash_timing("CounterExportTask", export_time);
+    hpx::util::print_cdash_timing("CounterPrintRound", print_round);
+    hpx::util::print_cdash_timing("CounterExportRound", export_round);
+    hpx::util::print_cdash_timing("CounterExportRead", read_round);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    std::vector<std::string> const default_counters = {
+        "/threads{locality#*/total}/count/cumulative",
+        "/threads{locality#*/worker-thread#*}/count/cumulative",
+        "/runtime{locality#*/total}/uptime"};
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks,t", value<std::size_t>()->default_value(100000),
+         "number of tasks to spawn per repetition (default: 100000)")
+        ("repetitions,r", value<std::size_t>()->default_value(10),
+         "number of repetitions of the workload (default: 10)")
+        ("rounds", value<std::size_t>()->default_value(1000),
+         "number of sampling rounds to time (default: 1000)")
+        ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
+         "time spent in the delay loop of each task [ns]")
+        ("interval,i", value<std::size_t>()->default_value(10),
+         "sampling interval [ms] (default: 10)")
+        ("print-destination", value<std::string>()->default_value("/dev/null"),
+         "destination of the printed counter values (default: /dev/null)")
+        ("counter", value<std::vector<std::string>>()->composing()
+            ->default_value(default_counters, "thread counts and uptime"),
+         "performance counter(s) to sample");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
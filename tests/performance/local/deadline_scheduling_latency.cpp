@@ -0,0 +1,156 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the scheduling latency of short, periodically
+// submitted tasks carrying a deadline while all cores are busy executing long
+// running batch tasks. Run it with --hpx:queuing=local-deadline and compare
+// with other schedulers (e.g. --hpx:queuing=local-priority-fifo), which ignore
+// the deadlines.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "worker_timed.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t batch_tasks = 10000;
+std::uint64_t batch_work = 200;    // microseconds
+std::size_t latency_tasks = 1000;
+std::uint64_t period = 500;      // microseconds
+std::uint64_t deadline = 100;    // microseconds
+
+std::uint64_t percentile(std::vector<std::uint64_t> const& sorted, double p)
+{
+    auto const idx =
+        static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[idx];
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    namespace ex = hpx::execution::experimental;
+
+    bool const print_header = vm.count("no-header") == 0;
+
+    hpx::execution::parallel_executor batch_exec;
+    auto const latency_exec = ex::with_deadline(
+        hpx::execution::parallel_executor(),
+        std::chrono::microseconds(deadline));
+
+    // saturate all cores with batch work
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    hpx::latch batch_done(static_cast<std::ptrdiff_t>(batch_tasks));
+    for (std::size_t i = 0; i != batch_tasks; ++i)
+    {
+        hpx::parallel::execution::post(batch_exec, [&] {
+            worker_timed(batch_work * 1000);
+            batch_done.count_down(1);
+        });
+    }
+
+    // the latency tasks are submitted from a separate OS thread to not depend
+    // on the scheduling of the submitting thread
+    std::vector<std::uint64_t> latencies(latency_tasks, 0);
+    hpx::latch latency_done(static_cast<std::ptrdiff_t>(latency_tasks));
+
+    std::thread submitter([&] {
+        for (std::size_t i = 0; i != latency_tasks; ++i)
+        {
+            std::uint64_t const submitted =
+                hpx::chrono::high_resolution_clock::now();
+            hpx::parallel::execution::post(latency_exec, [&, i, submitted] {
+                latencies[i] =
+                    hpx::chrono::high_resolution_clock::now() - submitted;
+                latency_done.count_down(1);
+            });
+            std::this_thread::sleep_for(std::chrono::microseconds(period));
+        }
+    });
+
+    latency_done.wait();
+    submitter.join();
+    batch_done.wait();
+
+    double const elapsed =
+        static_cast<double>(hpx::chrono::high_resolution_clock::now() - start) /
+        1e9;
+
+    std::sort(latencies.begin(), latencies.end());
+
+    if (print_header)
+    {
+        std::cout << "scheduler,num_cores,batch_tasks,latency_tasks,"
+                     "p50_latency[us],p99_latency[us],max_latency[us],"
+                     "total_time[s]"
+                  << std::endl;
+    }
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{},{},{}",
+        hpx::get_config_entry("hpx.scheduler", "unknown"),
+        hpx::get_os_thread_count(), batch_tasks, latency_tasks,
+        static_cast<double>(percentile(latencies, 0.5)) / 1e3,
+        static_cast<double>(percentile(latencies, 0.99)) / 1e3,
+        static_cast<double>(latencies.back()) / 1e3, elapsed)
+        << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("batch-tasks",
+            po::value<std::size_t>(&batch_tasks)->default_value(10000),
+            "number of batch tasks to execute (default: 10000)")
+        ("batch-work",
+            po::value<std::uint64_t>(&batch_work)->default_value(200),
+            "time to busy wait in each batch task [microseconds] "
+            "(default: 200)")
+        ("latency-tasks",
+            po::value<std::size_t>(&latency_tasks)->default_value(1000),
+            "number of latency sensitive tasks to execute (default: 1000)")
+        ("period",
+            po::value<std::uint64_t>(&period)->default_value(500),
+            "time between submitting two latency sensitive tasks "
+            "[microseconds] (default: 500)")
+        ("deadline",
+            po::value<std::uint64_t>(&deadline)->default_value(100),
+            "relative deadline of the latency sensitive tasks [microseconds] "
+            "(default: 100)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
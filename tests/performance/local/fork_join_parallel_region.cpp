@@ -0,0 +1,114 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example benchmarks the time it takes to enter and exit a parallel
+// region using the fork_join_executor. This is meant to be compared to
+// openmp_parallel_region.
+//
+// With --numa-domains the parallel regions are run on the worker threads
+// located in the given numbers of NUMA domains.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// the PUs of all worker threads located in the first num_domains NUMA
+// domains, an empty mask means all worker threads
+hpx::threads::mask_type get_numa_domains_mask(std::size_t num_domains)
+{
+    auto const& topo = hpx::threads::create_topology();
+    auto const& rp = hpx::resource::get_partitioner();
+
+    hpx::threads::mask_type mask(hpx::threads::hardware_concurrency());
+    for (std::size_t t = 0; t != hpx::get_os_thread_count(); ++t)
+    {
+        std::size_t const pu_num = rp.get_pu_num(t);
+        if (num_domains == 0 || topo.get_numa_node_number(pu_num) < num_domains)
+        {
+            hpx::threads::set(mask, pu_num);
+        }
+    }
+    return mask;
+}
+
+void measure_parallel_region(std::size_t num_domains, std::uint64_t repetitions)
+{
+    hpx::threads::mask_type const mask = get_numa_domains_mask(num_domains);
+    std::size_t const threads = hpx::threads::count(mask);
+    if (threads == 0)
+    {
+        return;
+    }
+
+    hpx::execution::experimental::fork_join_executor exec(mask);
+    hpx::util::counting_shape<std::size_t> const shape(threads);
+
+    // Do one warmup iteration
+    hpx::parallel::execution::bulk_sync_execute(
+        exec, [](std::size_t) {}, shape);
+
+    hpx::chrono::high_resolution_timer timer;
+
+    for (std::uint64_t i = 0; i < repetitions; ++i)
+    {
+        timer.restart();
+
+        hpx::parallel::execution::bulk_sync_execute(
+            exec, [](std::size_t) {}, shape);
+
+        auto t_parallel = timer.elapsed();
+
+        std::cout << num_domains << ", " << threads << ", " << t_parallel
+                  << std::endl;
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+
+    std::cout << "numa domains, threads, parallel region [s]" << std::endl;
+
+    if (vm.count("numa-domains"))
+    {
+        for (std::size_t domains :
+            vm["numa-domains"].as<std::vector<std::size_t>>())
+        {
+            measure_parallel_region(domains, repetitions);
+        }
+    }
+    else
+    {
+        measure_parallel_region(0, repetitions);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline;
+    desc_commandline.add_options()("repetitions",
+        hpx::program_options::value<std::uint64_t>()->default_value(100),
+        "Number of repetitions")("numa-domains",
+        hpx::program_options::value<std::vector<std::size_t>>()->multitoken(),
+        "Numbers of NUMA domains to run the parallel regions on, e.g. "
+        "--numa-domains 2 4 8 (default: use all worker threads)");
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
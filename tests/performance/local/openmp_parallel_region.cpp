@@ -5,26 +5,53 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 // This example benchmarks the time it takes to enter and exit an OpenMP
-// parallel region. This is meant to be compared to resume_suspend and
-// start_stop.
+// parallel region. This is meant to be compared to resume_suspend,
+// start_stop, and fork_join_parallel_region.
+//
+// With --numa-domains the parallel regions are run on as many threads as
+// there are PUs in the given numbers of NUMA domains. Use OMP_PROC_BIND=close
+// and OMP_PLACES=threads to make the OpenMP threads fill the NUMA domains in
+// order.
 
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/program_options.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/modules/topology.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <omp.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <vector>
+
+// the number of PUs in the first num_domains NUMA domains
+std::size_t get_numa_domains_pus(std::size_t num_domains)
+{
+    auto const& topo = hpx::threads::create_topology();
+
+    std::size_t const available =
+        (std::max)(topo.get_number_of_numa_nodes(), std::size_t(1));
+
+    std::size_t pus = 0;
+    for (std::size_t d = 0; d != (std::min)(num_domains, available); ++d)
+    {
+        pus += topo.get_number_of_numa_node_pus(d);
+    }
+    return pus;
+}
 
 int main(int argc, char** argv)
 {
     hpx::program_options::options_description desc_commandline;
     desc_commandline.add_options()("repetitions",
         hpx::program_options::value<std::uint64_t>()->default_value(100),
-        "Number of repetitions");
+        "Number of repetitions")("numa-domains",
+        hpx::program_options::value<std::vector<std::size_t>>()->multitoken(),
+        "Numbers of NUMA domains to run the parallel regions on, e.g. "
+        "--numa-domains 2 4 8 (default: use all threads)");
 
     hpx::program_options::variables_map vm;
     hpx::program_options::store(
@@ -46,22 +73,63 @@ int main(int argc, char** argv)
 
     std::size_t threads = omp_get_max_threads();
 
-    std::cout << "threads, parallel region [s]" << std::endl;
+    if (!vm.count("numa-domains"))
+    {
+        std::cout << "threads, parallel region [s]" << std::endl;
 
-    hpx::chrono::high_resolution_timer timer;
+        hpx::chrono::high_resolution_timer timer;
 
-    for (std::size_t i = 0; i < repetitions; ++i)
-    {
-        timer.restart();
+        for (std::size_t i = 0; i < repetitions; ++i)
+        {
+            timer.restart();
 
-        // TODO: Is there a more minimal way of starting all OpenMP threads?
+            // TODO: Is there a more minimal way of starting all OpenMP
+            // threads?
 #pragma omp parallel
+            {
+                x += 1;
+            }
+
+            auto t_parallel = timer.elapsed();
+
+            std::cout << threads << ", " << t_parallel << std::endl;
+        }
+        return 0;
+    }
+
+    std::cout << "numa domains, threads, parallel region [s]" << std::endl;
+
+    for (std::size_t domains :
+        vm["numa-domains"].as<std::vector<std::size_t>>())
+    {
+        threads = get_numa_domains_pus(domains);
+        if (threads == 0)
+        {
+            continue;
+        }
+
+        // warmup iteration with the new number of threads
+#pragma omp parallel num_threads(static_cast<int>(threads))
         {
             x += 1;
         }
 
-        auto t_parallel = timer.elapsed();
+        hpx::chrono::high_resolution_timer timer;
+
+        for (std::size_t i = 0; i < repetitions; ++i)
+        {
+            timer.restart();
+
+#pragma omp parallel num_threads(static_cast<int>(threads))
+            {
+                x += 1;
+            }
+
+            auto t_parallel = timer.elapsed();
 
-        std::cout << threads << ", " << t_parallel << std::endl;
+            std::cout << domains << ", " << threads << ", " << t_parallel
+                      << std::endl;
+        }
     }
+    return 0;
 }
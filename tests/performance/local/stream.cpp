@@ -48,6 +48,44 @@ hpx::threads::topology& retrieve_topology()
     return topo;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+hpx::compute::host::memory_policy get_memory_policy(
+    hpx::program_options::variables_map& vm)
+{
+    using hpx::compute::host::page_size_policy;
+    using hpx::compute::host::placement_policy;
+
+    std::string const pages = vm["huge_pages"].as<std::string>();
+    std::string const placement = vm["placement"].as<std::string>();
+
+    hpx::compute::host::memory_policy policy;
+    if (pages == "transparent")
+        policy.pages = page_size_policy::transparent_huge_pages;
+    else if (pages == "explicit")
+        policy.pages = page_size_policy::huge_pages;
+    else if (pages != "none")
+    {
+        HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
+            "get_memory_policy", "Invalid huge page policy given: {}", pages);
+    }
+
+    if (placement == "bind")
+        policy.placement = placement_policy::bind;
+    else if (placement == "interleave")
+        policy.placement = placement_policy::interleave;
+    else if (placement == "block_cyclic")
+        policy.placement = placement_policy::block_cyclic;
+    else if (placement != "first_touch")
+    {
+        HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
+            "get_memory_policy", "Invalid placement policy given: {}",
+            placement);
+    }
+
+    policy.block_size = vm["placement_block_size"].as<std::size_t>();
+    return policy;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 double mysecond()
 {
@@ -469,6 +507,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     HPX_UNUSED(chunk_size);
 
     std::string chunker = vm["chunker"].as<std::string>();
+    hpx::compute::host::memory_policy const mem_policy = get_memory_policy(vm);
 
     if (vector_size < 1)
     {
@@ -508,6 +547,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 << hpx::get_os_thread_count() << "\n"
             << "Chunking policy requested: " << chunker << "\n"
             << "Executor requested: " << executor << "\n"
+            << "Huge pages requested: " << vm["huge_pages"].as<std::string>()
+                << "\n"
+            << "Memory placement requested: "
+                << vm["placement"].as<std::string>() << "\n"
             << "-------------------------------------------------------------\n"
             ;
     }
@@ -531,7 +574,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 hpx::compute::host::block_allocator<STREAM_TYPE>;
 
             auto numa_nodes = hpx::compute::host::numa_domains();
-            allocator_type alloc(numa_nodes);
+            allocator_type alloc(numa_nodes, mem_policy);
             executor_type exec(numa_nodes);
             auto policy = hpx::execution::par.on(exec);
 
@@ -544,7 +587,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto policy = hpx::execution::par;
             hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
                 decltype(policy)>
-                alloc(policy);
+                alloc(policy, mem_policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
@@ -559,7 +602,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto policy = hpx::execution::par.on(exec);
             hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
                 decltype(policy)>
-                alloc(policy);
+                alloc(policy, mem_policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
@@ -575,7 +618,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto policy = hpx::execution::par.on(exec);
             hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
                 decltype(policy)>
-                alloc(policy);
+                alloc(policy, mem_policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
@@ -592,7 +635,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto policy = hpx::execution::par.on(exec);
             hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
                 decltype(policy)>
-                alloc(policy);
+                alloc(policy, mem_policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
@@ -734,6 +777,20 @@ int main(int argc, char* argv[])
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
             "executor to use (0-5) (default: 2, parallel_executor)")
+        (   "huge_pages",
+            hpx::program_options::value<std::string>()->default_value("none"),
+            "huge pages to use for executors 1-5, possible values: "
+            "none, transparent, explicit. (default: none)")
+        (   "placement",
+            hpx::program_options::value<std::string>()->default_value(
+                "first_touch"),
+            "NUMA placement of the arrays for executors 1-5, possible values: "
+            "first_touch, bind, interleave, block_cyclic. "
+            "(default: first_touch)")
+        (   "placement_block_size",
+            hpx::program_options::value<std::size_t>()->default_value(0),
+            "block size in bytes used for the block_cyclic placement "
+            "(default: 0, one page)")
         ;
     // clang-format on
 
@@ -0,0 +1,221 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark solves the 1D heat equation on a periodic, partitioned grid
+// (similar to examples/1d_stencil). It compares rebuilding the dependency
+// graph every time step using hpx::dataflow with recording the graph for a
+// number of time steps once and replaying it using a task_graph_executor.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr double k = 0.5;    // heat transfer coefficient
+constexpr double dt = 1.;    // time step
+constexpr double dx = 1.;    // grid spacing
+
+struct stencil
+{
+    stencil(std::size_t np, std::size_t nx)
+      : np_(np)
+      , nx_(nx)
+      , u_{std::vector<double>(np * nx), std::vector<double>(np * nx)}
+    {
+        for (std::size_t i = 0; i != np * nx; ++i)
+        {
+            u_[0][i] = static_cast<double>(i);
+        }
+    }
+
+    static double heat(double left, double middle, double right) noexcept
+    {
+        return middle + (k * dt / (dx * dx)) * (left - 2 * middle + right);
+    }
+
+    // compute partition p of the time step reading from buffer src
+    void update(std::size_t src, std::size_t p) noexcept
+    {
+        std::vector<double> const& current = u_[src];
+        std::vector<double>& next = u_[1 - src];
+
+        std::size_t const size = np_ * nx_;
+        std::size_t const first = p * nx_;
+        std::size_t const last = first + nx_;
+        for (std::size_t i = first; i != last; ++i)
+        {
+            next[i] = heat(current[(i + size - 1) % size], current[i],
+                current[(i + 1) % size]);
+        }
+    }
+
+    double checksum(std::size_t buffer) const noexcept
+    {
+        double result = 0.0;
+        for (double v : u_[buffer])
+        {
+            result += v;
+        }
+        return result;
+    }
+
+    std::size_t np_;
+    std::size_t nx_;
+    std::vector<double> u_[2];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// rebuild the dependency graph for each time step using dataflow
+double run_dataflow(stencil& s, std::size_t nt)
+{
+    std::size_t const np = s.np_;
+    std::vector<hpx::shared_future<void>> current(np, hpx::make_ready_future());
+    std::vector<hpx::shared_future<void>> next(np);
+
+    for (std::size_t t = 0; t != nt; ++t)
+    {
+        std::size_t const src = t % 2;
+        for (std::size_t p = 0; p != np; ++p)
+        {
+            next[p] = hpx::dataflow(
+                hpx::launch::async,
+                [&s, src, p](auto&&...) { s.update(src, p); },
+                current[(p + np - 1) % np], current[p], current[(p + 1) % np]);
+        }
+        std::swap(current, next);
+    }
+
+    hpx::wait_all(current);
+    return s.checksum(nt % 2);
+}
+
+// record the graph for steps_per_graph time steps once and replay it
+double run_task_graph(stencil& s, std::size_t nt, std::size_t steps_per_graph)
+{
+    using hpx::execution::experimental::task_graph;
+
+    std::size_t const np = s.np_;
+
+    task_graph graph;
+    std::vector<task_graph::node> current;
+    std::vector<task_graph::node> next(np);
+
+    for (std::size_t t = 0; t != steps_per_graph; ++t)
+    {
+        std::size_t const src = t % 2;
+        for (std::size_t p = 0; p != np; ++p)
+        {
+            auto f = [&s, src, p]() { s.update(src, p); };
+            if (current.empty())
+            {
+                next[p] = graph.add(HPX_MOVE(f), {});
+            }
+            else
+            {
+                // list the partition itself first, this keeps the nodes
+                // updating the same partition on the same core
+                next[p] = graph.dataflow(HPX_MOVE(f), current[p],
+                    current[(p + np - 1) % np], current[(p + 1) % np]);
+            }
+        }
+        current = next;
+    }
+
+    hpx::execution::experimental::task_graph_executor exec(HPX_MOVE(graph));
+    for (std::size_t t = 0; t != nt; t += steps_per_graph)
+    {
+        exec.replay().get();
+    }
+
+    return s.checksum(nt % 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const np = vm["np"].as<std::size_t>();
+    std::size_t const nx = vm["nx"].as<std::size_t>();
+
+    // the graph has to record an even number of time steps to start each
+    // replay from the same buffer, the number of time steps has to be a
+    // multiple of the time steps recorded in the graph
+    std::size_t steps_per_graph =
+        (std::max)(vm["steps-per-graph"].as<std::size_t>(), std::size_t(2));
+    steps_per_graph += steps_per_graph % 2;
+
+    std::size_t nt = vm["nt"].as<std::size_t>();
+    nt = (nt + steps_per_graph - 1) / steps_per_graph * steps_per_graph;
+
+    std::cout << "partitions: " << np << ", points per partition: " << nx
+              << ", time steps: " << nt
+              << ", time steps per graph: " << steps_per_graph
+              << ", threads: " << hpx::get_num_worker_threads() << std::endl;
+
+    double elapsed_dataflow = 0.0;
+    {
+        stencil s(np, nx);
+
+        hpx::chrono::high_resolution_timer timer;
+        double const checksum = run_dataflow(s, nt);
+        elapsed_dataflow = timer.elapsed();
+
+        std::cout << "dataflow:   " << elapsed_dataflow << " [s], "
+                  << elapsed_dataflow / static_cast<double>(nt * np) * 1e9
+                  << " [ns/task], checksum: " << checksum << std::endl;
+    }
+
+    {
+        stencil s(np, nx);
+
+        hpx::chrono::high_resolution_timer timer;
+        double const checksum = run_task_graph(s, nt, steps_per_graph);
+        double const elapsed = timer.elapsed();
+
+        std::cout << "task graph: " << elapsed << " [s], "
+                  << elapsed / static_cast<double>(nt * np) * 1e9
+                  << " [ns/task], checksum: " << checksum << std::endl;
+        std::cout << "speedup (dataflow/task graph): "
+                  << elapsed_dataflow / elapsed << std::endl;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("np", value<std::size_t>()->default_value(256),
+         "number of partitions")
+        ("nx", value<std::size_t>()->default_value(1000),
+         "number of grid points per partition")
+        ("nt", value<std::size_t>()->default_value(1000),
+         "number of time steps")
+        ("steps-per-graph", value<std::size_t>()->default_value(10),
+         "number of time steps recorded in the task graph (rounded up to "
+         "an even number)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,136 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of the task event tracer. It spawns the
+// same tasks as async_overheads with tracing disabled and enabled, and
+// additionally measures the cost of recording a single event.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include "worker_timed.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t delay_ns = 0;
+
+void test_func()
+{
+    worker_timed(delay_ns);
+}
+
+// returns the time per task [s]
+double measure_tasks(std::size_t num_tasks)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(&test_func));
+
+    hpx::wait_all(tasks);
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(end - start) / 1e9 /
+        static_cast<double>(num_tasks);
+}
+
+// returns the time per recorded event [s]
+double measure_events(std::size_t num_events)
+{
+    namespace tracing = hpx::threads::tracing;
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != num_events; ++i)
+    {
+        tracing::record(tracing::event_type::thread_create, &i, "benchmark");
+    }
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(end - start) / 1e9 /
+        static_cast<double>(num_events);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    namespace tracing = hpx::threads::tracing;
+
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const num_events = vm["events"].as<std::size_t>();
+
+    tracing::enable(false);
+    double const untraced_time_per_task = measure_tasks(num_tasks);
+    double const untraced_time_per_event = measure_events(num_events);
+
+    tracing::enable(true);
+    double const traced_time_per_task = measure_tasks(num_tasks);
+    double const traced_time_per_event = measure_events(num_events);
+    tracing::enable(false);
+
+    std::cout << "Time per task, tracing disabled: " << untraced_time_per_task
+              << " [s]" << std::endl;
+    std::cout << "Time per task, tracing enabled:  " << traced_time_per_task
+              << " [s]" << std::endl;
+    std::cout << "Time per event, tracing disabled: "
+              << untraced_time_per_event * 1e9 << " [ns]" << std::endl;
+    std::cout << "Time per event, tracing enabled:  "
+              << traced_time_per_event * 1e9 << " [ns]" << std::endl;
+
+    hpx::util::print_cdash_timing("AsyncUntraced", untraced_time_per_task);
+    hpx::util::print_cdash_timing("AsyncTraced", traced_time_per_task);
+    hpx::util::print_cdash_timing("TraceEvent", traced_time_per_event);
+
+    if (vm.count("trace-file"))
+    {
+        std::string const filename = vm["trace-file"].as<std::string>();
+        std::ofstream os(filename, std::ios_base::out | std::ios_base::binary);
+        tracing::write_trace(os,
+            filename.find(".pftrace") != std::string::npos ?
+                tracing::trace_format::perfetto :
+                tracing::trace_format::chrome_json);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks,t", value<std::size_t>()->default_value(100000),
+         "number of tasks to spawn (default: 100000)")
+        ("events,e", value<std::size_t>()->default_value(10000000),
+         "number of events to record directly (default: 10000000)")
+        ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
+         "time spent in the delay loop [ns]")
+        ("trace-file", value<std::string>(),
+         "write the collected trace to the given file (Perfetto format if "
+         "the file name contains '.pftrace', Chrome JSON otherwise)");
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -21,13 +21,18 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 std::vector<hpx::future<void>> create_tasks(
-    std::size_t num_tasks, std::size_t delay)
+    std::size_t num_tasks, std::size_t delay, bool async_tasks)
 {
     std::vector<hpx::future<void>> tasks;
     tasks.reserve(num_tasks);
     for (std::size_t i = 0; i != num_tasks; ++i)
     {
-        if (delay == 0)
+        if (async_tasks)
+        {
+            // the futures become ready concurrently while being waited on
+            tasks.push_back(hpx::async([]() {}));
+        }
+        else if (delay == 0)
         {
             tasks.push_back(hpx::make_ready_future());
         }
@@ -40,8 +45,21 @@ std::vector<hpx::future<void>> create_tasks(
     return tasks;
 }
 
+void wait_for(std::vector<hpx::future<void>>& tasks, bool use_when_all)
+{
+    if (use_when_all)
+    {
+        hpx::when_all(tasks).get();
+    }
+    else
+    {
+        hpx::wait_all(tasks);
+    }
+}
+
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, bool async_tasks,
+    bool use_when_all)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks =
@@ -55,9 +73,11 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         chunks.reserve(num_chunks);
         for (std::size_t c = 0; c != num_chunks - 1; ++c)
         {
-            chunks.push_back(create_tasks(num_chunk_tasks, delay));
+            chunks.push_back(
+                create_tasks(num_chunk_tasks, delay, async_tasks));
         }
-        chunks.push_back(create_tasks(last_num_chunk_tasks, delay));
+        chunks.push_back(
+            create_tasks(last_num_chunk_tasks, delay, async_tasks));
 
         std::vector<hpx::future<void>> chunk_results;
         chunk_results.reserve(num_chunks);
@@ -66,14 +86,16 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         hpx::chrono::high_resolution_timer t;
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            wait_for(chunks[0], use_when_all);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
                 chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); }));
+                    hpx::async([&chunks, c, use_when_all]() {
+                        wait_for(chunks[c], use_when_all);
+                    }));
             }
             hpx::wait_all(chunk_results);
         }
@@ -91,6 +113,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::size_t num_chunks = 1;
     std::size_t delay = 0;
     bool header = true;
+    bool async_tasks = false;
+    bool use_when_all = false;
 
     if (vm.count("no-header"))
         header = false;
@@ -102,17 +126,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
         num_chunks = vm["chunks"].as<std::size_t>();
     if (vm.count("delay"))
         delay = vm["delay"].as<std::size_t>();
+    if (vm.count("async"))
+        async_tasks = true;
+    if (vm.count("when_all"))
+        use_when_all = true;
 
     if (num_chunks == 0)
         num_chunks = 1;
 
     // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
+    double elapsed_seq = wait_tasks(
+        num_samples, num_tasks, 1, delay, async_tasks, use_when_all);
 
     // wait of tasks in chunks
     double elapsed_chunks = 0;
     if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
+        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay,
+            async_tasks, use_when_all);
 
     if (header)
     {
@@ -129,7 +159,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
         tasks_str, std::string("1"), delay_str, elapsed_seq,
         elapsed_seq / num_tasks)
         << std::endl;
-    hpx::util::print_cdash_timing("WaitAll", elapsed_seq / num_tasks);
+    hpx::util::print_cdash_timing(
+        use_when_all ? "WhenAll" : "WaitAll", elapsed_seq / num_tasks);
 
     if (num_chunks != 1)
     {
@@ -138,7 +169,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
             chunks_str, delay_str, elapsed_chunks, elapsed_chunks / num_tasks)
             << std::endl;
         hpx::util::print_cdash_timing(
-            "WaitAllChunks", elapsed_chunks / num_tasks);
+            use_when_all ? "WhenAllChunks" : "WaitAllChunks",
+            elapsed_chunks / num_tasks);
     }
     return hpx::local::finalize();
 }
@@ -159,7 +191,10 @@ int main(int argc, char* argv[])
         po::value<std::size_t>()->default_value(1),
         "number of chunks to split tasks into (default: 1)")("delay,d",
         po::value<std::size_t>()->default_value(0),
-        "number of iterations in the delay loop")("no-header,n",
+        "number of iterations in the delay loop")("async,a",
+        "create the futures using hpx::async, those become ready while "
+        "being waited on")("when_all,w",
+        "use hpx::when_all instead of hpx::wait_all")("no-header,n",
         po::value<bool>()->default_value(true),
         "do not print out the csv header row");
 
@@ -11,9 +11,13 @@
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <complex>
 #include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -27,11 +31,127 @@ namespace pingpong { namespace server {
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action)
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action)
 
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+namespace pingpong { namespace server {
+    // sends the received message back to the caller
+    buffer_type echo(buffer_type const& buffer)
+    {
+        return buffer;
+    }
+
+    // acknowledges the received message by returning its size only
+    std::size_t receive(buffer_type const& buffer)
+    {
+        return buffer.size();
+    }
+}}    // namespace pingpong::server
+
+HPX_PLAIN_ACTION(pingpong::server::echo, pingpong_echo_action)
+HPX_PLAIN_ACTION(pingpong::server::receive, pingpong_receive_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// Measure the round trip latency of messages of the given size, exactly one
+// message is in flight at any point in time.
+void measure_latency(hpx::id_type const& other_locality,
+    std::size_t message_size, std::size_t iterations)
+{
+    buffer_type message(message_size);
+    std::fill(message.begin(), message.end(), 'a');
+
+    pingpong_echo_action act;
+
+    // warm up the connection
+    hpx::async(act, other_locality, message).get();
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        buffer_type result = hpx::async(act, other_locality, message).get();
+        if (result.size() != message_size)
+        {
+            throw std::logic_error("received message has unexpected size");
+        }
+    }
+    double const elapsed = t.elapsed();
+
+    // the one-way latency is half of the round trip time
+    hpx::cout << "latency," << message_size << ","
+              << elapsed * 1e6 / (2.0 * static_cast<double>(iterations))
+              << " [us]\n"
+              << std::flush;
+}
+
+// Measure the bandwidth achieved by sending messages of the given size, up to
+// 'window' messages are in flight at any point in time.
+void measure_bandwidth(hpx::id_type const& other_locality,
+    std::size_t message_size, std::size_t iterations, std::size_t window)
+{
+    buffer_type message(message_size);
+    std::fill(message.begin(), message.end(), 'a');
+
+    pingpong_receive_action act;
+
+    // warm up the connection
+    hpx::async(act, other_locality, message).get();
+
+    std::vector<hpx::future<std::size_t>> acks;
+    acks.reserve(window);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (std::size_t j = 0; j != window; ++j)
+        {
+            acks.push_back(hpx::async(act, other_locality, message));
+        }
+        hpx::wait_all(acks);
+        acks.clear();
+    }
+    double const elapsed = t.elapsed();
+
+    double const bytes = static_cast<double>(message_size) *
+        static_cast<double>(iterations) * static_cast<double>(window);
+    hpx::cout << "bandwidth," << message_size << "," << bytes / elapsed / 1e9
+              << " [GB/s]\n"
+              << std::flush;
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     //Commandline specific code
     std::size_t const n = vm["nparcels"].as<std::size_t>();
 
+    if (vm.count("latency") || vm.count("bandwidth"))
+    {
+        if (0 == hpx::get_locality_id())
+        {
+            hpx::id_type const other_locality =
+                hpx::find_remote_localities()[0];
+
+            std::size_t const iterations = vm["iterations"].as<std::size_t>();
+            std::size_t const window = vm["window"].as<std::size_t>();
+            std::size_t const min_size = (std::max)(
+                vm["min-message-size"].as<std::size_t>(), std::size_t(1));
+            std::size_t const max_size =
+                vm["max-message-size"].as<std::size_t>();
+
+            for (std::size_t size = min_size; size <= max_size; size *= 2)
+            {
+                if (vm.count("latency"))
+                {
+                    measure_latency(other_locality, size, iterations);
+                }
+                if (vm.count("bandwidth"))
+                {
+                    measure_bandwidth(
+                        other_locality, size, iterations, window);
+                }
+            }
+        }
+        return hpx::finalize();
+    }
+
     if (0 == hpx::get_locality_id())
     {
         hpx::cout << "Running With nparcel = " << n << "\n" << std::flush;
@@ -76,9 +196,33 @@ int main(int argc, char* argv[])
     hpx::program_options::options_description cmdline(
         "Usage: " HPX_APPLICATION_STRING " [options]");
 
-    cmdline.add_options()("nparcels,n",
-        hpx::program_options::value<std::size_t>()->default_value(100),
-        "the number of parcels to create");
+    // clang-format off
+    cmdline.add_options()
+        ("nparcels,n",
+            hpx::program_options::value<std::size_t>()->default_value(100),
+            "the number of parcels to create")
+        ("latency",
+            "measure the round trip latency for a range of message sizes")
+        ("bandwidth",
+            "measure the bandwidth for a range of message sizes")
+        ("min-message-size",
+            hpx::program_options::value<std::size_t>()->default_value(1),
+            "the smallest message size used for --latency and --bandwidth "
+            "[bytes] (default: 1)")
+        ("max-message-size",
+            hpx::program_options::value<std::size_t>()->default_value(
+                std::size_t(1) << 22),
+            "the largest message size used for --latency and --bandwidth "
+            "[bytes] (default: 4194304)")
+        ("iterations",
+            hpx::program_options::value<std::size_t>()->default_value(100),
+            "the number of measurements per message size (default: 100)")
+        ("window",
+            hpx::program_options::value<std::size_t>()->default_value(16),
+            "the number of messages in flight for --bandwidth (default: 16)")
+        ;
+    // clang-format on
+
     // Initialize and run HPX
     std::vector<std::string> cfg;
     cfg.push_back("hpx.run_hpx_main!=1");
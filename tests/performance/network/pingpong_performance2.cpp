@@ -30,14 +30,17 @@ const std::size_t inject_rate_default = 0;
 const std::size_t batch_size_default = 10;
 const std::size_t nwarmups_default = 1;
 const std::size_t niters_default = 1;
+const std::size_t action_types_default = 1;
+const std::size_t max_action_types = 4;
 
 size_t window;
 size_t inject_rate;
 size_t batch_size;
+size_t action_types;
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void set_window(std::size_t window);
+void set_window(std::size_t window, std::size_t action_types);
 HPX_PLAIN_ACTION(set_window, set_window_action)
 
 void on_inject(hpx::id_type to, size_t nbytes, std::size_t nsteps);
@@ -46,12 +49,55 @@ HPX_PLAIN_ACTION(on_inject, on_inject_action)
 void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter);
 HPX_PLAIN_ACTION(on_recv, on_recv_action)
 
+// Distinct action types doing the same as on_recv, used to exercise the
+// aggregation of parcels across action types (--action-types).
+void on_recv_1(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter);
+HPX_PLAIN_ACTION(on_recv_1, on_recv_1_action)
+
+void on_recv_2(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter);
+HPX_PLAIN_ACTION(on_recv_2, on_recv_2_action)
+
+void on_recv_3(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter);
+HPX_PLAIN_ACTION(on_recv_3, on_recv_3_action)
+
 void on_done();
 HPX_PLAIN_ACTION(on_done, on_done_action)
 
-void set_window(std::size_t window_)
+void set_window(std::size_t window_, std::size_t action_types_)
 {
     window = window_;
+    action_types = action_types_;
+}
+
+// send the message using one of the configured action types
+void send_recv(hpx::id_type const& to, std::vector<char>&& data,
+    std::size_t counter, std::size_t seq)
+{
+    switch (seq % action_types)
+    {
+    case 1:
+        hpx::post<on_recv_1_action>(
+            to, hpx::find_here(), std::move(data), counter);
+        break;
+
+    case 2:
+        hpx::post<on_recv_2_action>(
+            to, hpx::find_here(), std::move(data), counter);
+        break;
+
+    case 3:
+        hpx::post<on_recv_3_action>(
+            to, hpx::find_here(), std::move(data), counter);
+        break;
+
+    default:
+        hpx::post<on_recv_action>(
+            to, hpx::find_here(), std::move(data), counter);
+        break;
+    }
 }
 
 void on_inject(hpx::id_type to, std::size_t nbytes, std::size_t nsteps)
@@ -66,7 +112,7 @@ void on_inject(hpx::id_type to, std::size_t nbytes, std::size_t nsteps)
             hpx::this_thread::yield();
         }
         std::vector<char> data(nbytes, 'a');
-        hpx::post<on_recv_action>(to, hpx::find_here(), data, nsteps);
+        send_recv(to, std::move(data), nsteps, i);
     }
 }
 
@@ -88,7 +134,25 @@ void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter)
 
     // send it to remote locality (to)
     std::vector<char> data(in);
-    hpx::post<on_recv_action>(to, hpx::find_here(), std::move(data), counter);
+    send_recv(to, std::move(data), counter, counter);
+}
+
+void on_recv_1(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter)
+{
+    on_recv(std::move(to), in, counter);
+}
+
+void on_recv_2(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter)
+{
+    on_recv(std::move(to), in, counter);
+}
+
+void on_recv_3(
+    hpx::id_type to, std::vector<char> const& in, std::size_t counter)
+{
+    on_recv(std::move(to), in, counter);
 }
 
 hpx::counting_semaphore_var<> semaphore;
@@ -109,6 +173,7 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
     batch_size = b_arg["batch-size"].as<std::size_t>();
     std::size_t const nwarmups = b_arg["nwarmups"].as<std::size_t>();
     std::size_t const niters = b_arg["niters"].as<std::size_t>();
+    action_types = b_arg["action-types"].as<std::size_t>();
 
     if (nsteps == 0)
     {
@@ -122,6 +187,13 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
         return 0;
     }
 
+    if (action_types == 0 || action_types > max_action_types)
+    {
+        std::cout << "action-types must be in [1, " << max_action_types
+                  << "]!" << std::endl;
+        return 0;
+    }
+
     std::vector<hpx::id_type> localities = hpx::find_remote_localities();
 
     hpx::id_type to;
@@ -135,7 +207,7 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
     }
 
     set_window_action act;
-    act(to, window);
+    act(to, window, action_types);
 
     double inject_time = 0;
     double time = 0;
@@ -181,7 +253,8 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
                   << "msg_rate(K/s)=" << msg_rate << std::endl
                   << "bandwidth(MB/s)=" << bandwidth << std::endl
                   << "localities=" << localities.size() << std::endl
-                  << "nsteps=" << nsteps << std::endl;
+                  << "nsteps=" << nsteps << std::endl
+                  << "action_types=" << action_types << std::endl;
     }
     else
     {
@@ -193,7 +266,7 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
                   << ":msg_rate(M/s)=" << msg_rate
                   << ":bandwidth(MB/s)=" << bandwidth
                   << ":localities=" << localities.size() << ":nsteps=" << nsteps
-                  << std::endl;
+                  << ":action_types=" << action_types << std::endl;
     }
 
     hpx::finalize();
@@ -219,7 +292,10 @@ int main(int argc, char* argv[])
         po::value<std::size_t>()->default_value(nwarmups_default),
         "the iteration count of warmup runs")("niters",
         po::value<std::size_t>()->default_value(niters_default),
-        "the iteration count of measurement iterations.")("verbose",
+        "the iteration count of measurement iterations.")("action-types",
+        po::value<std::size_t>()->default_value(action_types_default),
+        "the number of distinct action types used for the messages (1-4)")(
+        "verbose",
         po::value<bool>()->default_value(true),
         "verbosity of output,if false output is for awk");
 
@@ -0,0 +1,249 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark counts the nodes of an unbalanced tree in the spirit of the
+// Unbalanced Tree Search (UTS) benchmark. The tree is a binomial tree: the
+// root has b0 children, every other node has m children with probability q
+// and none otherwise. For q * m close to one the sizes of the subtrees vary
+// wildly, which makes it impossible to balance the work by placing the
+// subtrees upfront.
+//
+// The benchmark compares two strategies:
+//
+//  - placement: the children of the root are distributed evenly across all
+//    localities, each locality then searches the assigned subtrees on its own
+//  - stealing: the search is started on the first locality using stealable
+//    tasks, idle localities steal tasks from busy ones
+//
+// Run it on multiple localities using the TCP parcelport on a single host,
+// for instance:
+//
+//    hpxrun.py -l 4 -t 2 -p tcp bin/unbalanced_tree_search
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct uts_parameters
+{
+    std::uint64_t root = 0;         // seed of the root node
+    std::uint32_t b0 = 0;           // number of children of the root
+    std::uint32_t m = 0;            // number of children of inner nodes
+    double q = 0.0;                 // probability of a node having children
+    std::size_t chunk_size = 0;     // number of nodes handed to new tasks
+    bool steal = false;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & root & b0 & m & q & chunk_size & steal;
+        // clang-format on
+    }
+};
+
+constexpr std::uint64_t splitmix64(std::uint64_t x) noexcept
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+constexpr std::uint64_t child_state(
+    std::uint64_t parent, std::uint32_t i) noexcept
+{
+    return splitmix64(parent ^ (0x632be59bd9b4e019ULL * (i + 1)));
+}
+
+std::uint32_t num_children(
+    uts_parameters const& p, std::uint64_t state) noexcept
+{
+    double const u = static_cast<double>(state >> 11) * 0x1.0p-53;
+    return u < p.q ? p.m : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t search(uts_parameters const& p, std::vector<std::uint64_t> nodes);
+
+HPX_PLAIN_ACTION(search, search_action)
+HPX_ACTION_IS_STEALABLE(search_action)
+
+hpx::future<std::uint64_t> spawn(
+    uts_parameters const& p, std::vector<std::uint64_t>&& nodes)
+{
+    if (p.steal)
+    {
+        return hpx::distributed::experimental::async_stealable<search_action>(
+            p, HPX_MOVE(nodes));
+    }
+    return hpx::async<search_action>(hpx::find_here(), p, HPX_MOVE(nodes));
+}
+
+// count the nodes of the subtrees rooted at the given nodes, hand off the
+// oldest (i.e. closest to the roots) nodes to new tasks whenever the number of
+// nodes waiting to be explored grows too large
+std::uint64_t search(uts_parameters const& p, std::vector<std::uint64_t> nodes)
+{
+    std::vector<hpx::future<std::uint64_t>> spawned;
+    std::uint64_t count = 0;
+
+    while (!nodes.empty())
+    {
+        std::uint64_t const state = nodes.back();
+        nodes.pop_back();
+        ++count;
+
+        std::uint32_t const n = num_children(p, state);
+        for (std::uint32_t i = 0; i != n; ++i)
+        {
+            nodes.push_back(child_state(state, i));
+        }
+
+        if (nodes.size() > 2 * p.chunk_size)
+        {
+            std::vector<std::uint64_t> chunk(
+                nodes.begin(), nodes.begin() + p.chunk_size);
+            nodes.erase(nodes.begin(), nodes.begin() + p.chunk_size);
+            spawned.push_back(spawn(p, HPX_MOVE(chunk)));
+        }
+    }
+
+    for (auto& f : spawned)
+    {
+        count += f.get();
+    }
+    return count;
+}
+
+std::vector<std::uint64_t> root_children(uts_parameters const& p)
+{
+    std::vector<std::uint64_t> children;
+    children.reserve(p.b0);
+    for (std::uint32_t i = 0; i != p.b0; ++i)
+    {
+        children.push_back(child_state(p.root, i));
+    }
+    return children;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t search_placement(uts_parameters const& p)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::vector<std::vector<std::uint64_t>> parts(localities.size());
+
+    std::vector<std::uint64_t> const children = root_children(p);
+    for (std::size_t i = 0; i != children.size(); ++i)
+    {
+        parts[i % localities.size()].push_back(children[i]);
+    }
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(localities.size());
+    for (std::size_t i = 0; i != localities.size(); ++i)
+    {
+        results.push_back(
+            hpx::async<search_action>(localities[i], p, HPX_MOVE(parts[i])));
+    }
+
+    std::uint64_t count = 1;
+    for (auto& f : results)
+    {
+        count += f.get();
+    }
+    return count;
+}
+
+std::uint64_t search_stealing(uts_parameters const& p)
+{
+    return 1 + spawn(p, root_children(p)).get();
+}
+
+template <typename F>
+std::uint64_t measure(char const* name, uts_parameters const& p, F&& f)
+{
+    hpx::chrono::high_resolution_timer timer;
+    std::uint64_t const count = f(p);
+    double const elapsed = timer.elapsed();
+
+    std::cout << name << ": " << count << " nodes, " << elapsed << " [s], "
+              << static_cast<double>(count) / elapsed * 1e-6
+              << " [Mnodes/s]\n"
+              << std::flush;
+    return count;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    uts_parameters p;
+    p.root = vm["seed"].as<std::uint64_t>();
+    p.b0 = vm["b0"].as<std::uint32_t>();
+    p.m = vm["m"].as<std::uint32_t>();
+    p.q = vm["q"].as<double>();
+    p.chunk_size = vm["chunk-size"].as<std::size_t>();
+
+    std::cout << "localities: " << hpx::get_num_localities(hpx::launch::sync)
+              << ", b0: " << p.b0 << ", m: " << p.m << ", q: " << p.q
+              << ", chunk size: " << p.chunk_size << std::endl;
+
+    std::uint64_t const placed = measure("placement", p, &search_placement);
+
+    p.steal = true;
+    std::uint64_t const stolen = measure("stealing ", p, &search_stealing);
+
+    if (placed != stolen)
+    {
+        std::cout << "error: node counts don't match" << std::endl;
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("b0", value<std::uint32_t>()->default_value(2000),
+         "number of children of the root node")
+        ("m", value<std::uint32_t>()->default_value(8),
+         "number of children of inner nodes")
+        ("q", value<double>()->default_value(0.124875),
+         "probability of a node having children (q * m should be close to "
+         "but less than one)")
+        ("seed", value<std::uint64_t>()->default_value(42),
+         "seed of the root node")
+        ("chunk-size", value<std::size_t>()->default_value(32),
+         "number of nodes handed to a newly spawned task")
+        ;
+    // clang-format on
+
+    // all localities take part in stealing
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = {"hpx.distributed_stealing.enable=1"};
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,243 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// hpx_counter_reader prints the performance counter values an HPX application
+// publishes into shared memory when run with --hpx:export-counter. The reader
+// maps the segment read-only and does not interact with the HPX runtime in
+// any way, i.e. it can be run at any time and at any frequency without
+// affecting the observed application.
+//
+// Usage: hpx_counter_reader [options] <pid or segment name>
+//
+//   --interval=N   print the values every N milliseconds (default: print once)
+//   --count=N      stop after printing the values N times
+//   --csv          print one line per sample containing all values
+
+#include <hpx/performance_counters/counter_export_layout.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace layout = hpx::performance_counters::counter_export;
+
+///////////////////////////////////////////////////////////////////////////////
+struct mapped_segment
+{
+    explicit mapped_segment(std::string const& name)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd == -1)
+        {
+            std::cerr << "hpx_counter_reader: could not open shared memory "
+                         "segment "
+                      << name << ": " << std::strerror(errno) << "\n";
+            return;
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == 0 &&
+            static_cast<std::size_t>(st.st_size) >= layout::names_offset())
+        {
+            size = static_cast<std::size_t>(st.st_size);
+            void* p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED)
+                data = static_cast<char const*>(p);
+        }
+        ::close(fd);
+
+        if (data == nullptr)
+        {
+            std::cerr << "hpx_counter_reader: could not map shared memory "
+                         "segment "
+                      << name << "\n";
+        }
+    }
+
+    ~mapped_segment()
+    {
+        if (data != nullptr)
+            ::munmap(const_cast<char*>(data), size);
+    }
+
+    mapped_segment(mapped_segment const&) = delete;
+    mapped_segment& operator=(mapped_segment const&) = delete;
+
+    layout::segment_header const& header() const
+    {
+        return *reinterpret_cast<layout::segment_header const*>(data);
+    }
+
+    layout::name_entry const& name(std::size_t i) const
+    {
+        return reinterpret_cast<layout::name_entry const*>(
+            data + header().names_offset)[i];
+    }
+
+    layout::value_entry const& value(std::size_t i) const
+    {
+        return reinterpret_cast<layout::value_entry const*>(
+            data + header().values_offset)[i];
+    }
+
+    char const* data = nullptr;
+    std::size_t size = 0;
+};
+
+// returns an error message if the segment is not usable
+char const* validate(mapped_segment const& segment)
+{
+    // wait for the writer to publish the header
+    auto const start = std::chrono::steady_clock::now();
+    while (segment.header().magic.load(std::memory_order_acquire) !=
+        layout::magic)
+    {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5))
+            return "the segment was not initialized by an HPX application";
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    layout::segment_header const& header = segment.header();
+    if (header.version != layout::version ||
+        header.name_entry_size != sizeof(layout::name_entry) ||
+        header.value_entry_size != sizeof(layout::value_entry))
+    {
+        return "the segment was created by an incompatible version of HPX";
+    }
+
+    if (layout::segment_size(header.num_counters) > segment.size)
+        return "the segment is truncated";
+
+    return nullptr;
+}
+
+void print_values(mapped_segment const& segment, bool csv, bool& first)
+{
+    layout::segment_header const& header = segment.header();
+    std::size_t const num_counters = header.num_counters;
+
+    if (csv && first)
+    {
+        for (std::size_t i = 0; i != num_counters; ++i)
+            std::cout << (i == 0 ? "" : ",") << segment.name(i).name;
+        std::cout << "\n";
+    }
+    first = false;
+
+    for (std::size_t i = 0; i != num_counters; ++i)
+    {
+        layout::value_sample const s = layout::read(segment.value(i));
+        double const value = layout::get_value(s);
+
+        if (csv)
+        {
+            std::cout << (i == 0 ? "" : ",") << value;
+            continue;
+        }
+
+        layout::name_entry const& name = segment.name(i);
+        std::cout << name.name << "," << s.count << ","
+                  << static_cast<double>(s.time) * 1e-9 << ",[s]," << value;
+        if (name.unit_of_measure[0] != '\0')
+            std::cout << ",[" << name.unit_of_measure << "]";
+        std::cout << "\n";
+    }
+    if (csv)
+        std::cout << "\n";
+    std::cout << std::flush;
+}
+
+void print_usage()
+{
+    std::cerr << "usage: hpx_counter_reader [--interval=N] [--count=N] "
+                 "[--csv] <pid or segment name>\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::size_t interval = 0;
+    std::size_t count = 0;
+    bool csv = false;
+    std::string name;
+
+    for (int i = 1; i != argc; ++i)
+    {
+        std::string const arg(argv[i]);
+        if (arg.compare(0, 11, "--interval=") == 0)
+            interval = std::strtoul(arg.c_str() + 11, nullptr, 10);
+        else if (arg.compare(0, 8, "--count=") == 0)
+            count = std::strtoul(arg.c_str() + 8, nullptr, 10);
+        else if (arg == "--csv")
+            csv = true;
+        else if (arg == "--help" || arg == "-h" || !name.empty())
+        {
+            print_usage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+        else
+            name = arg;
+    }
+
+    if (name.empty())
+    {
+        print_usage();
+        return 1;
+    }
+
+    // a plain number refers to the default segment name of the given process
+    if (name.find_first_not_of("0123456789") == std::string::npos)
+        name = "/hpx_counters." + name;
+    else if (name[0] != '/')
+        name.insert(0, 1, '/');
+
+    mapped_segment const segment(name);
+    if (segment.data == nullptr)
+        return 1;
+
+    if (char const* msg = validate(segment))
+    {
+        std::cerr << "hpx_counter_reader: " << name << ": " << msg << "\n";
+        return 1;
+    }
+
+    if (!csv)
+    {
+        std::cout << "# pid " << segment.header().pid << ", locality "
+                  << segment.header().locality_id << ", "
+                  << segment.header().num_counters << " counters\n";
+    }
+
+    bool first = true;
+    for (std::size_t n = 1; /**/; ++n)
+    {
+        print_values(segment, csv, first);
+
+        auto const state = static_cast<layout::segment_state>(
+            segment.header().state.load(std::memory_order_acquire));
+        if (interval == 0 || (count != 0 && n == count) ||
+            state == layout::segment_state::stopped)
+        {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    }
+
+    return 0;
+}